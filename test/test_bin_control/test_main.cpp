@@ -0,0 +1,165 @@
+/*
+ * Host test and benchmark of binary control messages (wled00/bin_control.h), run with: pio test -e native
+ * The same change is sent as a binary message and as the JSON state request the UI would send.
+ * Both are decoded into the fields handleBinaryControl() and deserializeState() apply, the binary one with decodeBinControl()
+ * as used by handleBinaryControl(). The benchmark compares only this decoding step, applying the fields costs the same for both.
+ */
+
+#include <unity.h>
+#include <chrono>
+#include <string.h>
+#include <stdio.h>
+#include "bin_control.h"
+#include "src/dependencies/json/ArduinoJson-v6.h"
+
+#define SEGMENTS 4
+#define ROUNDS 20000
+
+//the fields both messages set
+struct Decoded {
+  uint8_t on, bri, tt;
+  uint8_t segs;
+  struct {
+    uint8_t id, on, bri, fx, sx, ix, pal;
+    uint8_t col[3][4];
+  } seg[SEGMENTS];
+};
+
+static uint8_t binMsg[sizeof(BinControlHeader) + SEGMENTS * sizeof(BinControlSegment)];
+static char jsonMsg[1024];
+
+static void buildMessages()
+{
+  BinControlHeader h = {BIN_CONTROL_TYPE, BIN_CONTROL_VERSION, 7, BIN_CONTROL_FLAG_ACK,
+                        BIN_CONTROL_ON | BIN_CONTROL_BRI | BIN_CONTROL_TT, 1, 128, 5};
+  memcpy(binMsg, &h, sizeof(h));
+  int len = sprintf(jsonMsg, "{\"on\":true,\"bri\":128,\"tt\":5,\"seg\":[");
+  for (uint8_t i = 0; i < SEGMENTS; i++) {
+    BinControlSegment s = {};
+    s.id = i; s.on = 1; s.bri = 255; s.fx = 9 + i; s.sx = 128; s.ix = 200; s.pal = 11;
+    s.mask = BIN_SEG_ON | BIN_SEG_BRI | BIN_SEG_COL0 | BIN_SEG_COL1 | BIN_SEG_COL2 | BIN_SEG_FX | BIN_SEG_SX | BIN_SEG_IX | BIN_SEG_PAL;
+    for (uint8_t c = 0; c < 3; c++) for (uint8_t k = 0; k < 4; k++) s.col[c][k] = c * 80 + k * 10 + i;
+    memcpy(binMsg + sizeof(h) + i * sizeof(s), &s, sizeof(s));
+    len += sprintf(jsonMsg + len, "%s{\"id\":%u,\"on\":true,\"bri\":255,\"col\":[", i ? "," : "", i);
+    for (uint8_t c = 0; c < 3; c++) {
+      len += sprintf(jsonMsg + len, "%s[%u,%u,%u,%u]", c ? "," : "", s.col[c][0], s.col[c][1], s.col[c][2], s.col[c][3]);
+    }
+    len += sprintf(jsonMsg + len, "],\"fx\":%u,\"sx\":128,\"ix\":200,\"pal\":11}", s.fx);
+  }
+  sprintf(jsonMsg + len, "]}");
+}
+
+//decoded with the helper handleBinaryControl() uses, the fields are then taken as it applies them
+static bool decodeBinary(const uint8_t* data, size_t len, Decoded& d)
+{
+  BinControlMessage msg;
+  if (decodeBinControl(data, len, msg) != BIN_CONTROL_OK || msg.segs > SEGMENTS) return false;
+  d.on = msg.header.on; d.bri = msg.header.bri; d.tt = msg.header.tt;
+  d.segs = msg.segs;
+  for (uint16_t i = 0; i < msg.segs; i++) {
+    BinControlSegment s;
+    msg.segment(i, s);
+    d.seg[i].id = s.id; d.seg[i].on = s.on; d.seg[i].bri = s.bri;
+    d.seg[i].fx = s.fx; d.seg[i].sx = s.sx; d.seg[i].ix = s.ix; d.seg[i].pal = s.pal;
+    memcpy(d.seg[i].col, s.col, sizeof(s.col));
+  }
+  return true;
+}
+
+//the reads deserializeState() and deserializeSegment() do for the same fields
+static bool decodeJson(const char* json, size_t len, Decoded& d, JsonDocument& doc)
+{
+  if (deserializeJson(doc, json, len)) return false;
+  JsonObject root = doc.as<JsonObject>();
+  d.on = root["on"] | false; d.bri = root["bri"] | 0; d.tt = root["tt"] | 0;
+  d.segs = 0;
+  for (JsonObject elem : root["seg"].as<JsonArray>()) {
+    if (d.segs == SEGMENTS) return false;
+    auto& s = d.seg[d.segs++];
+    s.id = elem["id"] | 0; s.on = elem["on"] | false; s.bri = elem["bri"] | 0;
+    s.fx = elem["fx"] | 0; s.sx = elem["sx"] | 0; s.ix = elem["ix"] | 0; s.pal = elem["pal"] | 0;
+    JsonArray colarr = elem["col"];
+    for (uint8_t c = 0; c < 3; c++) {
+      JsonArray colX = colarr[c];
+      for (uint8_t k = 0; k < 4; k++) s.col[c][k] = colX[k] | 0;
+    }
+  }
+  return true;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_check_length_and_version()
+{
+  uint16_t segs;
+  TEST_ASSERT_EQUAL(BIN_CONTROL_OK, checkBinControl(binMsg, sizeof(binMsg), &segs));
+  TEST_ASSERT_EQUAL(SEGMENTS, segs);
+  TEST_ASSERT_EQUAL(BIN_CONTROL_ERR_LENGTH, checkBinControl(binMsg, sizeof(binMsg) -1, &segs));
+  TEST_ASSERT_EQUAL(BIN_CONTROL_ERR_LENGTH, checkBinControl(binMsg, 4, &segs));
+  uint8_t v2[sizeof(BinControlHeader)];
+  memcpy(v2, binMsg, sizeof(v2));
+  v2[1] = BIN_CONTROL_VERSION +1;
+  TEST_ASSERT_EQUAL(BIN_CONTROL_ERR_VERSION, checkBinControl(v2, sizeof(v2), &segs));
+}
+
+void test_decode_records()
+{
+  BinControlMessage msg;
+  TEST_ASSERT_EQUAL(BIN_CONTROL_OK, decodeBinControl(binMsg, sizeof(binMsg), msg));
+  TEST_ASSERT_EQUAL(7, msg.header.seq);
+  TEST_ASSERT_EQUAL(BIN_CONTROL_ON | BIN_CONTROL_BRI | BIN_CONTROL_TT, msg.header.mask);
+  TEST_ASSERT_EQUAL(SEGMENTS, msg.segs);
+  BinControlSegment s;
+  msg.segment(SEGMENTS -1, s);
+  TEST_ASSERT_EQUAL(SEGMENTS -1, s.id);
+  TEST_ASSERT_EQUAL(9 + SEGMENTS -1, s.fx);
+  TEST_ASSERT_EQUAL(BIN_SEG_PAL, s.mask & BIN_SEG_PAL);
+  TEST_ASSERT_EQUAL(2 * 80 + 3 * 10 + SEGMENTS -1, s.col[2][3]);
+  TEST_ASSERT_EQUAL(BIN_CONTROL_ERR_LENGTH, decodeBinControl(binMsg, sizeof(binMsg) -1, msg));
+}
+
+void test_binary_matches_json()
+{
+  Decoded b = {}, j = {};
+  DynamicJsonDocument doc(4096);
+  TEST_ASSERT_TRUE(decodeBinary(binMsg, sizeof(binMsg), b));
+  TEST_ASSERT_TRUE(decodeJson(jsonMsg, strlen(jsonMsg), j, doc));
+  TEST_ASSERT_EQUAL(0, memcmp(&b, &j, sizeof(Decoded)));
+}
+
+void test_benchmark_binary_vs_json()
+{
+  Decoded d;
+  DynamicJsonDocument doc(4096); //reused, like the parser's document (host pointers make it larger than on the ESP)
+  size_t jsonLen = strlen(jsonMsg);
+  volatile uint8_t sink = 0;
+  bool ok = true;
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < ROUNDS; i++) { ok &= decodeBinary(binMsg, sizeof(binMsg), d); sink += d.seg[SEGMENTS -1].fx; }
+  auto t1 = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < ROUNDS; i++) { ok &= decodeJson(jsonMsg, jsonLen, d, doc); sink += d.seg[SEGMENTS -1].fx; }
+  auto t2 = std::chrono::steady_clock::now();
+
+  double binNs  = std::chrono::duration<double, std::nano>(t1 - t0).count() / ROUNDS;
+  double jsonNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / ROUNDS;
+  char msg[160];
+  sprintf(msg, "%u segments: binary %u bytes %.0f ns, JSON %u bytes %.0f ns per message",
+          SEGMENTS, (unsigned)sizeof(binMsg), binNs, (unsigned)jsonLen, jsonNs);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_TRUE(ok);
+  TEST_ASSERT_TRUE(sizeof(binMsg) < jsonLen);
+  TEST_ASSERT_TRUE(binNs < jsonNs);
+}
+
+int main(int argc, char** argv)
+{
+  buildMessages();
+  UNITY_BEGIN();
+  RUN_TEST(test_check_length_and_version);
+  RUN_TEST(test_decode_records);
+  RUN_TEST(test_binary_matches_json);
+  RUN_TEST(test_benchmark_binary_vs_json);
+  return UNITY_END();
+}
@@ -0,0 +1,167 @@
+/*
+ * Host test of the HTTP API tokenizer (wled00/http_api.h), run with: pio test -e native
+ * Each request of the corpus is looked up with the indexOf() patterns handleSet() searched for before,
+ * every key has to be found by both at the same position with the same value.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include <stdlib.h>
+#include "http_api.h"
+
+//patterns of the previous parser, a key was present if found at a position > 0 and its value started 3 characters after it
+//H2, IN, K2, ND, NN and RB were only checked for presence
+struct OldPattern {
+  uint8_t key;
+  const char* pattern;
+  bool value;
+};
+
+static const OldPattern oldPatterns[] = {
+  {API_A, "&A=", true }, {API_AX, "AX=", true }, {API_B, "&B=", true }, {API_B2, "B2=", true }, {API_C2, "C2=", true }, {API_C3, "C3=", true }, {API_CL, "CL=", true }, {API_CT, "CT=", true },
+  {API_CY, "CY=", true }, {API_FP, "FP=", true }, {API_FX, "FX=", true }, {API_G, "&G=", true }, {API_G2, "G2=", true }, {API_GP, "GP=", true }, {API_H2, "H2", false}, {API_HU, "HU=", true },
+  {API_IN, "IN", false}, {API_IX, "IX=", true }, {API_K, "&K=", true }, {API_K2, "K2", false}, {API_LO, "LO=", true }, {API_LX, "LX=", true }, {API_LY, "LY=", true }, {API_M, "&M=", true },
+  {API_MI, "MI=", true }, {API_NB, "NB=", true }, {API_ND, "&ND", false}, {API_NF, "NF=", true }, {API_NL, "NL=", true }, {API_NM, "NM=", true }, {API_NN, "&NN", false}, {API_NT, "NT=", true },
+  {API_NX, "NX=", true }, {API_OL, "OL=", true }, {API_P1, "P1=", true }, {API_P2, "P2=", true }, {API_PL, "PL=", true }, {API_PS, "PS=", true }, {API_PT, "PT=", true }, {API_R, "&R=", true },
+  {API_R2, "R2=", true }, {API_RB, "RB", false}, {API_RD, "RD=", true }, {API_RN, "RN=", true }, {API_RV, "RV=", true }, {API_S, "&S=", true }, {API_S2, "S2=", true }, {API_SA, "SA=", true },
+  {API_SB, "SB=", true }, {API_SC, "SC", true }, {API_SM, "SM=", true }, {API_SN, "SN=", true }, {API_SP, "SP=", true }, {API_SR, "SR", true }, {API_SS, "SS=", true }, {API_ST, "ST=", true },
+  {API_SV, "SV=", true }, {API_SX, "SX=", true }, {API_T, "&T=", true }, {API_TT, "TT=", true }, {API_U0, "U0=", true }, {API_U1, "U1=", true }, {API_W, "&W=", true }, {API_W2, "W2=", true },
+};
+
+//requests as sent by the UI, the docs, home automation integrations, MQTT ("/api") and UDP API calls
+static const char* corpus[] = {
+  "/win",
+  "/win&T=2",
+  "/win&T=0&A=0",
+  "/win&A=128",
+  "/win&A=~10",
+  "/win&A=~-10",
+  "/win&A=~&FX=~-",
+  "/win&FX=5&SX=128&IX=64&FP=3",
+  "/win&FX=~&SX=~20&IX=~-20&FP=~",
+  "/win&R=255&G=0&B=0&W=0",
+  "/win&R2=0&G2=255&B2=0&W2=10",
+  "/win&R=10&G=20&B=30&R2=40&G2=50&B2=60",
+  "/win&CL=hFF0000&C2=h00FF00&C3=h0000FF",
+  "/win&CL=255&C2=65280",
+  "/win&HU=12000&SA=200",
+  "/win&HU=12000&SA=200&H2",
+  "/win&K=4000",
+  "/win&K=4000&K2",
+  "/win&SR=1",
+  "/win&SR",
+  "/win&SC",
+  "/win&SM=1&SS=1&SV=2&S=0&S2=30&GP=1&SP=0",
+  "/win&SS=0&SV=0",
+  "/win&SM=2&A=200&FX=9",
+  "/win&PS=3",
+  "/win&PL=2",
+  "/win&PL=~",
+  "/win&P1=1&P2=5&CY=1&PT=5000",
+  "/win&CY=0",
+  "/win&LX=100200300",
+  "/win&LY=201006000",
+  "/win&LX=100200300&LY=0",
+  "/win&OL=2",
+  "/win&M=1",
+  "/win&SN=1&RN=0&RD=1",
+  "/win&ND&NL=30&NT=0&NF=1",
+  "/win&NL=0",
+  "/win&AX=3",
+  "/win&TT=1000",
+  "/win&RV=1&MI=0",
+  "/win&SB=128",
+  "/win&ST=1611000000",
+  "/win&CT=1",
+  "/win&LO=1",
+  "/win&LO=0&T=1",
+  "/win&RB",
+  "/win&NM=1&NX=1234&NB=1",
+  "/win&U0=5&U1=7",
+  "/win&IN",
+  "/win&IN&A=128&FX=2",
+  "/win&NN&T=1",
+  "/win&A=10&A=20",
+  "/win&FX=5&FX=6",
+  "win&A=100&R=255",
+  "win&T=2&NN",
+  "win&FX=73&SX=100&IX=220&FP=6&CL=h00FF40",
+  "/win&TT=500&A=255&CL=hFFA000&T=1",
+  "/win&A=",
+  "/win&FX",
+  "/win&&A=5",
+  "/win&A=5&",
+};
+
+//the previous parser found keys anywhere in the request, the tokenizer only at the start of a parameter
+struct Divergent {
+  const char* req;
+  uint8_t key;
+};
+static const Divergent divergent[] = {
+  {"/win&NX=SM=2", API_SM},  //key inside a value
+  {"/win&LX=0FX=5", API_FX},
+  {"/win&XSR", API_SR},      //flag inside an unknown parameter
+};
+
+static int oldPosition(const char* req, const char* pattern)
+{
+  const char* p = strstr(req, pattern);
+  return p ? p - req : -1;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_corpus_matches_indexof()
+{
+  for (const char* req : corpus) {
+    uint16_t len = strlen(req);
+    HttpApiRequest api(req, len);
+    for (const OldPattern& o : oldPatterns) {
+      int pos = oldPosition(req, o.pattern);
+      bool oldHas = pos > 0;
+      char msg[96];
+      snprintf(msg, sizeof(msg), "%s, key %s", req, o.pattern);
+      TEST_ASSERT_EQUAL_MESSAGE(oldHas, api.has(o.key), msg);
+      if (!oldHas || !o.value) continue;
+      int oldVal = (pos + 3 > len) ? len : pos + 3; //substring(pos+3)
+      TEST_ASSERT_EQUAL_MESSAGE(oldVal, api.val(o.key) - req, msg);
+      TEST_ASSERT_EQUAL_MESSAGE(atol(req + oldVal), api.num(o.key), msg);
+    }
+  }
+}
+
+void test_absent_key_is_empty()
+{
+  const char* req = "/win&A=128";
+  HttpApiRequest api(req, strlen(req));
+  TEST_ASSERT_FALSE(api.has(API_FX));
+  TEST_ASSERT_EQUAL(0, strlen(api.val(API_FX)));
+  TEST_ASSERT_EQUAL(0, api.num(API_FX));
+}
+
+void test_keys_only_at_parameter_start()
+{
+  for (const Divergent& d : divergent) {
+    HttpApiRequest api(d.req, strlen(d.req));
+    TEST_ASSERT_TRUE_MESSAGE(oldPosition(d.req, oldPatterns[d.key].pattern) > 0, d.req);
+    TEST_ASSERT_FALSE_MESSAGE(api.has(d.key), d.req);
+  }
+}
+
+void test_pattern_table_complete()
+{
+  TEST_ASSERT_EQUAL(API_KEY_COUNT, sizeof(oldPatterns) / sizeof(oldPatterns[0]));
+  for (uint8_t i = 0; i < API_KEY_COUNT; i++) TEST_ASSERT_EQUAL(i, oldPatterns[i].key);
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_pattern_table_complete);
+  RUN_TEST(test_corpus_matches_indexof);
+  RUN_TEST(test_absent_key_is_empty);
+  RUN_TEST(test_keys_only_at_parameter_start);
+  return UNITY_END();
+}
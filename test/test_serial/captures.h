@@ -0,0 +1,87 @@
+#ifndef WLED_TEST_SERIAL_CAPTURES_H
+#define WLED_TEST_SERIAL_CAPTURES_H
+
+/*
+ * Serial streams for test_serial, in the byte format Prismatik (Adalight) and TPM2 senders put on the wire.
+ * Pixel i of frame f is (i*7+f*13, i*29+f*3, 255-i*5-f), except that pixels 2, 3 and 4 have a green of
+ * 0x41 ('A'), 0xC9 (TPM2 start) and 0x36 (TPM2 end), so header bytes inside pixel data are covered.
+ */
+
+#include <stdint.h>
+
+//noise, frames 0 and 1 (10 LEDs), frame 2 with a bad checksum, frame 3 (10 LEDs), frame 4 (100 LEDs)
+const uint8_t captureAdalight[] = {
+  0x00, 0x41, 0x64, 0x0A, 0x41, 0x64, 0x61, 0x00, 0x09, 0x5C, 0x00, 0x00, 0xFF, 0x07, 0x1D, 0xFA,
+  0x0E, 0x41, 0xF5, 0x15, 0xC9, 0xF0, 0x1C, 0x36, 0xEB, 0x23, 0x91, 0xE6, 0x2A, 0xAE, 0xE1, 0x31,
+  0xCB, 0xDC, 0x38, 0xE8, 0xD7, 0x3F, 0x05, 0xD2, 0x41, 0x64, 0x61, 0x00, 0x09, 0x5C, 0x0D, 0x03,
+  0xFE, 0x14, 0x20, 0xF9, 0x1B, 0x41, 0xF4, 0x22, 0xC9, 0xEF, 0x29, 0x36, 0xEA, 0x30, 0x94, 0xE5,
+  0x37, 0xB1, 0xE0, 0x3E, 0xCE, 0xDB, 0x45, 0xEB, 0xD6, 0x4C, 0x08, 0xD1, 0x41, 0x64, 0x61, 0x00,
+  0x09, 0x5D, 0x1A, 0x06, 0xFD, 0x21, 0x23, 0xF8, 0x28, 0x41, 0xF3, 0x2F, 0xC9, 0xEE, 0x36, 0x36,
+  0xE9, 0x3D, 0x97, 0xE4, 0x44, 0xB4, 0xDF, 0x4B, 0xD1, 0xDA, 0x52, 0xEE, 0xD5, 0x59, 0x0B, 0xD0,
+  0x41, 0x64, 0x61, 0x00, 0x09, 0x5C, 0x27, 0x09, 0xFC, 0x2E, 0x26, 0xF7, 0x35, 0x41, 0xF2, 0x3C,
+  0xC9, 0xED, 0x43, 0x36, 0xE8, 0x4A, 0x9A, 0xE3, 0x51, 0xB7, 0xDE, 0x58, 0xD4, 0xD9, 0x5F, 0xF1,
+  0xD4, 0x66, 0x0E, 0xCF, 0x41, 0x64, 0x61, 0x00, 0x63, 0x36, 0x34, 0x0C, 0xFB, 0x3B, 0x29, 0xF6,
+  0x42, 0x41, 0xF1, 0x49, 0xC9, 0xEC, 0x50, 0x36, 0xE7, 0x57, 0x9D, 0xE2, 0x5E, 0xBA, 0xDD, 0x65,
+  0xD7, 0xD8, 0x6C, 0xF4, 0xD3, 0x73, 0x11, 0xCE, 0x7A, 0x2E, 0xC9, 0x81, 0x4B, 0xC4, 0x88, 0x68,
+  0xBF, 0x8F, 0x85, 0xBA, 0x96, 0xA2, 0xB5, 0x9D, 0xBF, 0xB0, 0xA4, 0xDC, 0xAB, 0xAB, 0xF9, 0xA6,
+  0xB2, 0x16, 0xA1, 0xB9, 0x33, 0x9C, 0xC0, 0x50, 0x97, 0xC7, 0x6D, 0x92, 0xCE, 0x8A, 0x8D, 0xD5,
+  0xA7, 0x88, 0xDC, 0xC4, 0x83, 0xE3, 0xE1, 0x7E, 0xEA, 0xFE, 0x79, 0xF1, 0x1B, 0x74, 0xF8, 0x38,
+  0x6F, 0xFF, 0x55, 0x6A, 0x06, 0x72, 0x65, 0x0D, 0x8F, 0x60, 0x14, 0xAC, 0x5B, 0x1B, 0xC9, 0x56,
+  0x22, 0xE6, 0x51, 0x29, 0x03, 0x4C, 0x30, 0x20, 0x47, 0x37, 0x3D, 0x42, 0x3E, 0x5A, 0x3D, 0x45,
+  0x77, 0x38, 0x4C, 0x94, 0x33, 0x53, 0xB1, 0x2E, 0x5A, 0xCE, 0x29, 0x61, 0xEB, 0x24, 0x68, 0x08,
+  0x1F, 0x6F, 0x25, 0x1A, 0x76, 0x42, 0x15, 0x7D, 0x5F, 0x10, 0x84, 0x7C, 0x0B, 0x8B, 0x99, 0x06,
+  0x92, 0xB6, 0x01, 0x99, 0xD3, 0xFC, 0xA0, 0xF0, 0xF7, 0xA7, 0x0D, 0xF2, 0xAE, 0x2A, 0xED, 0xB5,
+  0x47, 0xE8, 0xBC, 0x64, 0xE3, 0xC3, 0x81, 0xDE, 0xCA, 0x9E, 0xD9, 0xD1, 0xBB, 0xD4, 0xD8, 0xD8,
+  0xCF, 0xDF, 0xF5, 0xCA, 0xE6, 0x12, 0xC5, 0xED, 0x2F, 0xC0, 0xF4, 0x4C, 0xBB, 0xFB, 0x69, 0xB6,
+  0x02, 0x86, 0xB1, 0x09, 0xA3, 0xAC, 0x10, 0xC0, 0xA7, 0x17, 0xDD, 0xA2, 0x1E, 0xFA, 0x9D, 0x25,
+  0x17, 0x98, 0x2C, 0x34, 0x93, 0x33, 0x51, 0x8E, 0x3A, 0x6E, 0x89, 0x41, 0x8B, 0x84, 0x48, 0xA8,
+  0x7F, 0x4F, 0xC5, 0x7A, 0x56, 0xE2, 0x75, 0x5D, 0xFF, 0x70, 0x64, 0x1C, 0x6B, 0x6B, 0x39, 0x66,
+  0x72, 0x56, 0x61, 0x79, 0x73, 0x5C, 0x80, 0x90, 0x57, 0x87, 0xAD, 0x52, 0x8E, 0xCA, 0x4D, 0x95,
+  0xE7, 0x48, 0x9C, 0x04, 0x43, 0xA3, 0x21, 0x3E, 0xAA, 0x3E, 0x39, 0xB1, 0x5B, 0x34, 0xB8, 0x78,
+  0x2F, 0xBF, 0x95, 0x2A, 0xC6, 0xB2, 0x25, 0xCD, 0xCF, 0x20, 0xD4, 0xEC, 0x1B, 0xDB, 0x09, 0x16,
+  0xE2, 0x26, 0x11, 0xE9, 0x43, 0x0C
+};
+
+//ping, frame 0 (10 LEDs), command 0x0A, frame 1 (10 LEDs, 1 padding byte), frame 2 with a bad end byte, frame 3 (100 LEDs)
+const uint8_t captureTpm2[] = {
+  0xC9, 0xAA, 0x00, 0x00, 0x36, 0xC9, 0xDA, 0x00, 0x1E, 0x00, 0x00, 0xFF, 0x07, 0x1D, 0xFA, 0x0E,
+  0x41, 0xF5, 0x15, 0xC9, 0xF0, 0x1C, 0x36, 0xEB, 0x23, 0x91, 0xE6, 0x2A, 0xAE, 0xE1, 0x31, 0xCB,
+  0xDC, 0x38, 0xE8, 0xD7, 0x3F, 0x05, 0xD2, 0x36, 0xC9, 0xC0, 0x00, 0x02, 0x0A, 0x01, 0x36, 0xC9,
+  0xDA, 0x00, 0x1F, 0x0D, 0x03, 0xFE, 0x14, 0x20, 0xF9, 0x1B, 0x41, 0xF4, 0x22, 0xC9, 0xEF, 0x29,
+  0x36, 0xEA, 0x30, 0x94, 0xE5, 0x37, 0xB1, 0xE0, 0x3E, 0xCE, 0xDB, 0x45, 0xEB, 0xD6, 0x4C, 0x08,
+  0xD1, 0x55, 0x36, 0xC9, 0xDA, 0x00, 0x1E, 0x1A, 0x06, 0xFD, 0x21, 0x23, 0xF8, 0x28, 0x41, 0xF3,
+  0x2F, 0xC9, 0xEE, 0x36, 0x36, 0xE9, 0x3D, 0x97, 0xE4, 0x44, 0xB4, 0xDF, 0x4B, 0xD1, 0xDA, 0x52,
+  0xEE, 0xD5, 0x59, 0x0B, 0xD0, 0x00, 0xC9, 0xDA, 0x01, 0x2C, 0x27, 0x09, 0xFC, 0x2E, 0x26, 0xF7,
+  0x35, 0x41, 0xF2, 0x3C, 0xC9, 0xED, 0x43, 0x36, 0xE8, 0x4A, 0x9A, 0xE3, 0x51, 0xB7, 0xDE, 0x58,
+  0xD4, 0xD9, 0x5F, 0xF1, 0xD4, 0x66, 0x0E, 0xCF, 0x6D, 0x2B, 0xCA, 0x74, 0x48, 0xC5, 0x7B, 0x65,
+  0xC0, 0x82, 0x82, 0xBB, 0x89, 0x9F, 0xB6, 0x90, 0xBC, 0xB1, 0x97, 0xD9, 0xAC, 0x9E, 0xF6, 0xA7,
+  0xA5, 0x13, 0xA2, 0xAC, 0x30, 0x9D, 0xB3, 0x4D, 0x98, 0xBA, 0x6A, 0x93, 0xC1, 0x87, 0x8E, 0xC8,
+  0xA4, 0x89, 0xCF, 0xC1, 0x84, 0xD6, 0xDE, 0x7F, 0xDD, 0xFB, 0x7A, 0xE4, 0x18, 0x75, 0xEB, 0x35,
+  0x70, 0xF2, 0x52, 0x6B, 0xF9, 0x6F, 0x66, 0x00, 0x8C, 0x61, 0x07, 0xA9, 0x5C, 0x0E, 0xC6, 0x57,
+  0x15, 0xE3, 0x52, 0x1C, 0x00, 0x4D, 0x23, 0x1D, 0x48, 0x2A, 0x3A, 0x43, 0x31, 0x57, 0x3E, 0x38,
+  0x74, 0x39, 0x3F, 0x91, 0x34, 0x46, 0xAE, 0x2F, 0x4D, 0xCB, 0x2A, 0x54, 0xE8, 0x25, 0x5B, 0x05,
+  0x20, 0x62, 0x22, 0x1B, 0x69, 0x3F, 0x16, 0x70, 0x5C, 0x11, 0x77, 0x79, 0x0C, 0x7E, 0x96, 0x07,
+  0x85, 0xB3, 0x02, 0x8C, 0xD0, 0xFD, 0x93, 0xED, 0xF8, 0x9A, 0x0A, 0xF3, 0xA1, 0x27, 0xEE, 0xA8,
+  0x44, 0xE9, 0xAF, 0x61, 0xE4, 0xB6, 0x7E, 0xDF, 0xBD, 0x9B, 0xDA, 0xC4, 0xB8, 0xD5, 0xCB, 0xD5,
+  0xD0, 0xD2, 0xF2, 0xCB, 0xD9, 0x0F, 0xC6, 0xE0, 0x2C, 0xC1, 0xE7, 0x49, 0xBC, 0xEE, 0x66, 0xB7,
+  0xF5, 0x83, 0xB2, 0xFC, 0xA0, 0xAD, 0x03, 0xBD, 0xA8, 0x0A, 0xDA, 0xA3, 0x11, 0xF7, 0x9E, 0x18,
+  0x14, 0x99, 0x1F, 0x31, 0x94, 0x26, 0x4E, 0x8F, 0x2D, 0x6B, 0x8A, 0x34, 0x88, 0x85, 0x3B, 0xA5,
+  0x80, 0x42, 0xC2, 0x7B, 0x49, 0xDF, 0x76, 0x50, 0xFC, 0x71, 0x57, 0x19, 0x6C, 0x5E, 0x36, 0x67,
+  0x65, 0x53, 0x62, 0x6C, 0x70, 0x5D, 0x73, 0x8D, 0x58, 0x7A, 0xAA, 0x53, 0x81, 0xC7, 0x4E, 0x88,
+  0xE4, 0x49, 0x8F, 0x01, 0x44, 0x96, 0x1E, 0x3F, 0x9D, 0x3B, 0x3A, 0xA4, 0x58, 0x35, 0xAB, 0x75,
+  0x30, 0xB2, 0x92, 0x2B, 0xB9, 0xAF, 0x26, 0xC0, 0xCC, 0x21, 0xC7, 0xE9, 0x1C, 0xCE, 0x06, 0x17,
+  0xD5, 0x23, 0x12, 0xDC, 0x40, 0x0D, 0x36
+};
+
+//Adalight frame 5, TPM2 frame 6, Adalight frame 7, 10 LEDs each
+const uint8_t captureMixed[] = {
+  0x41, 0x64, 0x61, 0x00, 0x09, 0x5C, 0x41, 0x0F, 0xFA, 0x48, 0x2C, 0xF5, 0x4F, 0x41, 0xF0, 0x56,
+  0xC9, 0xEB, 0x5D, 0x36, 0xE6, 0x64, 0xA0, 0xE1, 0x6B, 0xBD, 0xDC, 0x72, 0xDA, 0xD7, 0x79, 0xF7,
+  0xD2, 0x80, 0x14, 0xCD, 0xC9, 0xDA, 0x00, 0x1E, 0x4E, 0x12, 0xF9, 0x55, 0x2F, 0xF4, 0x5C, 0x41,
+  0xEF, 0x63, 0xC9, 0xEA, 0x6A, 0x36, 0xE5, 0x71, 0xA3, 0xE0, 0x78, 0xC0, 0xDB, 0x7F, 0xDD, 0xD6,
+  0x86, 0xFA, 0xD1, 0x8D, 0x17, 0xCC, 0x36, 0x41, 0x64, 0x61, 0x00, 0x09, 0x5C, 0x5B, 0x15, 0xF8,
+  0x62, 0x32, 0xF3, 0x69, 0x41, 0xEE, 0x70, 0xC9, 0xE9, 0x77, 0x36, 0xE4, 0x7E, 0xA6, 0xDF, 0x85,
+  0xC3, 0xDA, 0x8C, 0xE0, 0xD5, 0x93, 0xFD, 0xD0, 0x9A, 0x1A, 0xCB
+};
+
+#endif
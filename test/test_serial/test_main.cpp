@@ -0,0 +1,163 @@
+/*
+ * Host test of the Adalight/TPM2 stream parser (wled00/wled_serial.h), run with: pio test -e native
+ * Adalight results are compared with the byte at a time state machine handleSerial() used before,
+ * TPM2 results with the frames the captures were made from.
+ * Every capture is fed whole and in chunks of several sizes, which must not change the result.
+ */
+
+#include <unity.h>
+#include <vector>
+#include "wled_serial.h"
+#include "captures.h"
+
+//collects shown frames, pixels a frame did not set keep their value like on the strip
+class RecordingSink : public SerialStreamSink {
+  public:
+    std::vector<uint8_t> leds = std::vector<uint8_t>(300 * 3, 0);
+    std::vector<std::vector<uint8_t>> frames;
+    uint16_t pings = 0;
+
+    void pixels(uint16_t start, const uint8_t* rgb, uint16_t count)
+    {
+      for (uint16_t i = 0; i < count; i++) {
+        if (start + i >= 300) return;
+        for (uint8_t c = 0; c < 3; c++) leds[(start + i) * 3 + c] = rgb[i * 3 + c];
+      }
+    }
+    void frame() { frames.push_back(leds); }
+    void ping() { pings++; }
+};
+
+//Adalight part of the handleSerial() state machine before the parser was added, one pixel per byte triplet
+static void referenceAdalight(const uint8_t* buf, size_t len, SerialStreamSink& sink)
+{
+  enum { Header_A, Header_d, Header_a, Header_CountHi, Header_CountLo, Header_CountCheck, Data_Red, Data_Green, Data_Blue } state = Header_A;
+  uint16_t count = 0, pixel = 0;
+  uint8_t check = 0, rgb[3];
+  for (size_t i = 0; i < len; i++) {
+    uint8_t next = buf[i];
+    switch (state) {
+      case Header_A: if (next == 'A') state = Header_d; break;
+      case Header_d: state = (next == 'd') ? Header_a : Header_A; break;
+      case Header_a: state = (next == 'a') ? Header_CountHi : Header_A; break;
+      case Header_CountHi: pixel = 0; count = next * 0x100; check = next; state = Header_CountLo; break;
+      case Header_CountLo: count += next + 1; check = check ^ next ^ 0x55; state = Header_CountCheck; break;
+      case Header_CountCheck: state = (check == next) ? Data_Red : Header_A; break;
+      case Data_Red: rgb[0] = next; state = Data_Green; break;
+      case Data_Green: rgb[1] = next; state = Data_Blue; break;
+      case Data_Blue:
+        rgb[2] = next;
+        sink.pixels(pixel++, rgb, 1);
+        if (--count > 0) state = Data_Red;
+        else { sink.frame(); state = Header_A; }
+        break;
+    }
+  }
+}
+
+//pixel i of frame f in the captures
+static void capturePixel(uint8_t f, uint16_t i, uint8_t* rgb)
+{
+  rgb[0] = i * 7 + f * 13;
+  rgb[1] = (i == 2) ? 0x41 : (i == 3) ? 0xC9 : (i == 4) ? 0x36 : (uint8_t)(i * 29 + f * 3);
+  rgb[2] = 255 - i * 5 - f;
+}
+
+static void assertFrame(const std::vector<uint8_t>& leds, uint8_t f, uint16_t count)
+{
+  uint8_t rgb[3];
+  for (uint16_t i = 0; i < count; i++) {
+    capturePixel(f, i, rgb);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(rgb, &leds[i * 3], 3);
+  }
+}
+
+static const size_t chunkSizes[] = {1, 2, 3, 4, 5, 7, 64, 256, 100000};
+
+static void feedChunked(SerialStreamParser& parser, const uint8_t* buf, size_t len, size_t chunk)
+{
+  for (size_t i = 0; i < len; i += chunk) parser.feed(buf + i, (len - i < chunk) ? len - i : chunk);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_adalight_matches_reference()
+{
+  RecordingSink expected;
+  referenceAdalight(captureAdalight, sizeof(captureAdalight), expected);
+  TEST_ASSERT_EQUAL(4, expected.frames.size()); //frame 2 has a bad checksum
+
+  for (size_t chunk : chunkSizes) {
+    RecordingSink sink;
+    SerialStreamParser parser(sink);
+    feedChunked(parser, captureAdalight, sizeof(captureAdalight), chunk);
+    TEST_ASSERT_EQUAL(expected.frames.size(), sink.frames.size());
+    for (size_t f = 0; f < expected.frames.size(); f++) TEST_ASSERT_TRUE(expected.frames[f] == sink.frames[f]);
+    TEST_ASSERT_EQUAL(0, sink.pings);
+    TEST_ASSERT_TRUE(parser.getState() == SerialStreamParser::State::Header_A);
+  }
+}
+
+void test_adalight_frames()
+{
+  RecordingSink sink;
+  SerialStreamParser parser(sink);
+  parser.feed(captureAdalight, sizeof(captureAdalight));
+  TEST_ASSERT_EQUAL(4, sink.frames.size());
+  assertFrame(sink.frames[0], 0, 10);
+  assertFrame(sink.frames[1], 1, 10);
+  assertFrame(sink.frames[2], 3, 10);
+  assertFrame(sink.frames[3], 4, 100);
+}
+
+void test_tpm2_frames()
+{
+  for (size_t chunk : chunkSizes) {
+    RecordingSink sink;
+    SerialStreamParser parser(sink);
+    feedChunked(parser, captureTpm2, sizeof(captureTpm2), chunk);
+    TEST_ASSERT_EQUAL(1, sink.pings);
+    TEST_ASSERT_EQUAL(3, sink.frames.size()); //the command is skipped, frame 2 has a bad end byte
+    assertFrame(sink.frames[0], 0, 10);
+    assertFrame(sink.frames[1], 1, 10);       //the padding byte is discarded
+    assertFrame(sink.frames[2], 3, 100);
+    TEST_ASSERT_TRUE(parser.getState() == SerialStreamParser::State::Header_A);
+  }
+}
+
+void test_mixed_stream()
+{
+  for (size_t chunk : chunkSizes) {
+    RecordingSink sink;
+    SerialStreamParser parser(sink);
+    feedChunked(parser, captureMixed, sizeof(captureMixed), chunk);
+    TEST_ASSERT_EQUAL(3, sink.frames.size());
+    assertFrame(sink.frames[0], 5, 10);
+    assertFrame(sink.frames[1], 6, 10);
+    assertFrame(sink.frames[2], 7, 10);
+  }
+}
+
+void test_reset_drops_partial_frame()
+{
+  RecordingSink sink;
+  SerialStreamParser parser(sink);
+  parser.feed(captureAdalight, 30); //inside the pixels of frame 0
+  TEST_ASSERT_TRUE(parser.getState() == SerialStreamParser::State::Data);
+  parser.reset();
+  parser.feed(captureMixed, sizeof(captureMixed));
+  TEST_ASSERT_EQUAL(3, sink.frames.size());
+  assertFrame(sink.frames[0], 5, 10);
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_adalight_matches_reference);
+  RUN_TEST(test_adalight_frames);
+  RUN_TEST(test_tpm2_frames);
+  RUN_TEST(test_mixed_stream);
+  RUN_TEST(test_reset_drops_partial_frame);
+  return UNITY_END();
+}
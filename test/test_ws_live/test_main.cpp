@@ -0,0 +1,116 @@
+/*
+ * Host test of the binary liveview encoding (wled00/ws_live.h), run with: pio test -e native
+ * A sequence of frames is encoded the way serveLiveLedsBinary() does for a delta client,
+ * and replayed onto a client side copy, which has to match the source pixels after every frame.
+ */
+
+#include <unity.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "ws_live.h"
+
+#define SAMPLED 600
+
+static uint32_t pixels[SAMPLED];   //the strip
+static uint8_t last[SAMPLED * 3];  //the encoder's reference
+static uint8_t client[SAMPLED * 3];
+static uint8_t buf[WS_BIN_LIVE_HEADER + SAMPLED * 3];
+
+//what the liveview page does with a frame
+static bool replay(const uint8_t* msg, size_t len, uint8_t* dst)
+{
+  if (len < WS_BIN_LIVE_HEADER || msg[0] != WS_BIN_LIVE) return false;
+  uint16_t sampled = (msg[2] << 8) | msg[3];
+  size_t i = WS_BIN_LIVE_HEADER;
+  if (!(msg[1] & WS_BIN_LIVE_DELTA)) {
+    if (len != i + (size_t)sampled * 3) return false;
+    memcpy(dst, msg + i, (size_t)sampled * 3);
+    return true;
+  }
+  while (i < len) {
+    if (i + 3 > len) return false;
+    uint16_t start = (msg[i] << 8) | msg[i +1];
+    uint8_t run = msg[i +2];
+    i += 3;
+    if (!run || start + run > sampled || i + run * 3 > len) return false;
+    memcpy(dst + start * 3, msg + i, run * 3);
+    i += run * 3;
+  }
+  return true;
+}
+
+//encodes the strip and replays the frame onto the client's copy, which then has to match the strip
+static bool sendFrame(bool delta, size_t* len = nullptr)
+{
+  size_t n = encodeLiveFrame(buf, SAMPLED, 1, last, delta, [](uint16_t p) { return pixels[p]; });
+  if (len) *len = n;
+  if (!replay(buf, n, client)) return false;
+  for (uint16_t p = 0; p < SAMPLED; p++) {
+    uint32_t c = (client[p*3] << 16) | (client[p*3 +1] << 8) | client[p*3 +2];
+    if (c != pixels[p]) return false;
+  }
+  return true;
+}
+
+void setUp()
+{
+  srand(1);
+  for (uint16_t p = 0; p < SAMPLED; p++) pixels[p] = rand() & 0xFFFFFF;
+  memset(last, 0, sizeof(last));
+  memset(client, 0, sizeof(client));
+  sendFrame(false); //a client starts with a full frame
+}
+
+void tearDown() {}
+
+void test_unchanged_frame_is_empty()
+{
+  size_t len;
+  TEST_ASSERT_TRUE(sendFrame(true, &len));
+  TEST_ASSERT_EQUAL(WS_BIN_LIVE_HEADER, len);
+  TEST_ASSERT_EQUAL(WS_BIN_LIVE_DELTA, buf[1] & WS_BIN_LIVE_DELTA);
+}
+
+void test_sparse_changes()
+{
+  for (uint8_t f = 0; f < 50; f++) {
+    for (uint8_t k = 0; k < 8; k++) pixels[rand() % SAMPLED] = rand() & 0xFFFFFF;
+    size_t len;
+    TEST_ASSERT_TRUE(sendFrame(true, &len));
+    TEST_ASSERT_EQUAL(WS_BIN_LIVE_DELTA, buf[1] & WS_BIN_LIVE_DELTA);
+    TEST_ASSERT_TRUE(len < WS_BIN_LIVE_HEADER + SAMPLED * 3);
+  }
+}
+
+void test_runs_longer_than_255()
+{
+  for (uint16_t p = 10; p < 10 + 300; p++) pixels[p] ^= 0x010101;
+  TEST_ASSERT_TRUE(sendFrame(true));
+  TEST_ASSERT_EQUAL(WS_BIN_LIVE_DELTA, buf[1] & WS_BIN_LIVE_DELTA);
+  TEST_ASSERT_TRUE(sendFrame(true));
+}
+
+//frames where the delta is given up half way, followed by deltas against them
+void test_full_frame_fallback()
+{
+  for (uint8_t f = 0; f < 20; f++) {
+    if (f % 3 == 0) {
+      for (uint16_t p = 0; p < SAMPLED; p++) pixels[p] = rand() & 0xFFFFFF;
+    } else {
+      for (uint16_t p = 0; p < SAMPLED; p += 7) pixels[p] = rand() & 0xFFFFFF;
+    }
+    TEST_ASSERT_TRUE(sendFrame(true));
+    TEST_ASSERT_EQUAL((f % 3 == 0) ? 0 : WS_BIN_LIVE_DELTA, buf[1] & WS_BIN_LIVE_DELTA);
+  }
+}
+
+int main(int argc, char** argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_unchanged_frame_is_empty);
+  RUN_TEST(test_sparse_changes);
+  RUN_TEST(test_runs_longer_than_255);
+  RUN_TEST(test_full_frame_fallback);
+  return UNITY_END();
+}
@@ -0,0 +1,125 @@
+/**
+ * Stand-in Art-Net console for testing ArtPoll / ArtPollReply node discovery
+ *
+ * > node tools/artnet_console.js [target]
+ *
+ * target is the IP of a WLED node or a broadcast address (default 255.255.255.255).
+ * The script binds UDP port 6454, like a console, so nothing else on this machine may be using it.
+ *
+ * Checks:
+ * 1) every node answers, with one reply per group of up to 4 universes
+ * 2) a second poll sent right after the first is ignored (rate limit per console)
+ * 3) a poll after the rate limit interval is answered again
+ * The per console limit can be checked by running the script on two machines at the same time, both have to get replies.
+ * Exits with 1 if a check fails.
+ */
+
+const dgram = require("dgram");
+
+const ARTNET_PORT = 6454;
+const OP_POLL = 0x2000;
+const OP_POLL_REPLY = 0x2100;
+const REPLY_INTERVAL = 1000; // ARTNET_POLL_REPLY_INTERVAL in const.h
+const WAIT = 1500;
+
+const target = process.argv[2] || "255.255.255.255";
+const socket = dgram.createSocket({ type: "udp4", reuseAddr: true });
+let replies = [];
+let failed = false;
+
+function check(ok, text) {
+  console.log((ok ? "  ok   " : "  FAIL ") + text);
+  if (!ok) failed = true;
+}
+
+function artPoll() {
+  const p = Buffer.alloc(14);
+  p.write("Art-Net\0", 0, "latin1");
+  p.writeUInt16LE(OP_POLL, 8);
+  p.writeUInt16BE(14, 10); // protocol version
+  p[12] = 0x00; // TalkToMe: reply to polls only
+  p[13] = 0x00; // priority
+  return p;
+}
+
+function str(msg, start, len) {
+  const s = msg.toString("latin1", start, start + len);
+  const end = s.indexOf("\0");
+  return end < 0 ? s : s.substring(0, end);
+}
+
+function parseReply(msg, rinfo) {
+  if (msg.length < 207 || str(msg, 0, 8) !== "Art-Net" || msg.readUInt16LE(8) !== OP_POLL_REPLY) return null;
+  const ports = msg[173];
+  const universes = [];
+  for (let i = 0; i < ports && i < 4; i++) {
+    universes.push((msg[18] << 8) | (msg[19] << 4) | (msg[190 + i] & 0x0f));
+  }
+  return {
+    from: rinfo.address,
+    ip: [msg[10], msg[11], msg[12], msg[13]].join("."),
+    version: msg[16] + "." + msg[17],
+    shortName: str(msg, 26, 18),
+    longName: str(msg, 44, 64),
+    report: str(msg, 108, 64),
+    ports: ports,
+    universes: universes,
+    received: universes.map((u, i) => (msg[182 + i] & 0x80) !== 0),
+    bindIndex: msg.length > 211 ? msg[211] : 0,
+    length: msg.length,
+  };
+}
+
+socket.on("message", (msg, rinfo) => {
+  const r = parseReply(msg, rinfo);
+  if (r) replies.push(r);
+});
+
+//sends count polls 100 ms apart and collects the replies
+function poll(count) {
+  replies = [];
+  for (let i = 0; i < count; i++) setTimeout(() => socket.send(artPoll(), ARTNET_PORT, target), i * 100);
+  return new Promise((resolve) => setTimeout(() => resolve(replies), WAIT));
+}
+
+function byNode(list) {
+  const nodes = {};
+  for (const r of list) (nodes[r.ip] = nodes[r.ip] || []).push(r);
+  return nodes;
+}
+
+async function run() {
+  console.log("Polling " + target + " twice");
+  const first = byNode(await poll(2));
+  const ips = Object.keys(first);
+  check(ips.length > 0, ips.length + " node(s) answered");
+  for (const ip of ips) {
+    const list = first[ip].sort((a, b) => a.bindIndex - b.bindIndex);
+    console.log("\n" + ip + " \"" + list[0].shortName + "\" (" + list[0].longName + "), firmware " + list[0].version);
+    console.log("  " + list[0].report);
+    check(list.every((r) => r.length >= 239), "replies are full size");
+    check(list.every((r) => r.ip === r.from), "reported IP matches sender");
+    check(list.every((r) => r.ports <= 4), "at most 4 ports per reply");
+    check(list.every((r, i) => r.bindIndex === i + 1), "bind indexes count up from 1, second poll was not answered");
+    const universes = [].concat(...list.map((r) => r.universes));
+    console.log("  universes: " + (universes.length ? universes.join(", ") : "none"));
+    check(universes.every((u, i) => i === 0 || u === universes[i - 1] + 1), "universes are consecutive");
+    const seen = [].concat(...list.map((r) => r.received));
+    console.log("  data received: " + seen.map((s) => (s ? "yes" : "no")).join(", "));
+  }
+  if (!ips.length) return;
+
+  await new Promise((resolve) => setTimeout(resolve, REPLY_INTERVAL));
+  console.log("\nPolling after the rate limit interval");
+  const again = byNode(await poll(1));
+  check(ips.every((ip) => again[ip] && again[ip].length === first[ip].length), "all nodes answered again");
+}
+
+socket.bind(ARTNET_PORT, () => {
+  socket.setBroadcast(true);
+  run().then(() => {
+    socket.close();
+    console.log(failed ? "\nFAILED" : "\nPASSED");
+    process.exit(failed ? 1 : 0);
+  });
+});
@@ -165,6 +165,21 @@ ${result}
 
 `;
     return s.mangle ? s.mangle(chunk) : chunk;
+  } else if (s.method == "gzip") {
+    const buf = fs.readFileSync(srcDir + "/" + s.file);
+    let str = filter(buf.toString("utf-8"), s.filter);
+    if (s.mangle) str = s.mangle(str);
+    const result = zlib.gzipSync(str, { level: zlib.constants.Z_BEST_COMPRESSION });
+    const chunk = `
+// Autogenerated from ${srcDir}/${s.file}, do not edit!!
+const uint16_t ${s.name}_length = ${result.length};
+const uint8_t ${s.name}[] PROGMEM = {
+${hexdump(result)}
+};
+`;
+    if (s.ifdef) return `\n#ifdef ${s.ifdef}${chunk}#endif\n`;
+    if (s.ifndef) return `\n#ifndef ${s.ifndef}${chunk}#endif\n`;
+    return chunk;
   } else {
     console.warn("Unknown method: " + s.method);
     return undefined;
@@ -196,142 +211,86 @@ function writeChunks(srcDir, specs, resultFile) {
 
 writeHtmlGzipped("wled00/data/index.htm", "wled00/html_ui.h");
 
+//settings pages are static, the values are filled in by GetV() from /settings/s.js
+const settingsCss = filter(fs.readFileSync("wled00/data/style.css", "utf-8"), "css-minify");
+function settingsPage(str, subPage) {
+  return str
+    .replace(/\<link rel="stylesheet".*\>/gms, "")
+    .replace(/\<style\>.*\<\/style\>/gms, () => `<style>${settingsCss}</style>`)
+    .replace(
+      /function GetV().*\<\/script\>/gms,
+      `</script><script src="/settings/s.js?p=${subPage}"></script>`
+    );
+}
+
 writeChunks(
   "wled00/data",
   [
     {
-      file: "style.css",
-      name: "PAGE_settingsCss",
-      prepend: "=====(<style>",
-      append: "</style>)=====",
-      method: "plaintext",
-      filter: "css-minify",
+      file: "settings.htm",
+      name: "PAGE_settings",
+      method: "gzip",
+      filter: "html-minify",
+      ifdef: "WLED_ENABLE_DMX",
+      mangle: (str) =>
+        str.replace(/User Interface\<\/button\>\<\/form\>/gms, "User Interface\<\/button\>\<\/form\><form action=/settings/dmx><button type=submit>DMX Output</button></form>"),
     },
     {
       file: "settings.htm",
       name: "PAGE_settings",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) =>
-        str
-          .replace("%", "%%")
-          .replace(/User Interface\<\/button\>\<\/form\>/gms, "User Interface\<\/button\>\<\/form\>%DMXMENU%"),
+      ifndef: "WLED_ENABLE_DMX",
     },
     {
       file: "settings_wifi.htm",
       name: "PAGE_settings_wifi",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) =>
-        str
-          .replace(/\<link rel="stylesheet".*\>/gms, "")
-          .replace(/\<style\>.*\<\/style\>/gms, "%CSS%%SCSS%")
-          .replace(
-            /function GetV().*\<\/script\>/gms,
-            "function GetV() {var d=document;\n"
-          ),
+      mangle: (str) => settingsPage(str, 1),
     },
     {
       file: "settings_leds.htm",
       name: "PAGE_settings_leds",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) =>
-        str
-          .replace(/\<link rel="stylesheet".*\>/gms, "")
-          .replace(/\<style\>.*\<\/style\>/gms, "%CSS%%SCSS%")
-          .replace(
-            /function GetV().*\<\/script\>/gms,
-            "function GetV() {var d=document;\n"
-          ),
+      mangle: (str) => settingsPage(str, 2),
     },
     {
       file: "settings_dmx.htm",
       name: "PAGE_settings_dmx",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) => {
-        const nocss = str
-          .replace(/\<link rel="stylesheet".*\>/gms, "")
-          .replace(/\<style\>.*\<\/style\>/gms, "%CSS%%SCSS%")
-          .replace(
-            /function GetV().*\<\/script\>/gms,
-            "function GetV() {var d=document;\n"
-          );
-        return `
-#ifdef WLED_ENABLE_DMX
-${nocss}
-#else
-const char PAGE_settings_dmx[] PROGMEM = R"=====()=====";
-#endif
-`;
-      },
+      ifdef: "WLED_ENABLE_DMX",
+      mangle: (str) => settingsPage(str, 7),
     },
     {
       file: "settings_ui.htm",
       name: "PAGE_settings_ui",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) =>
-        str
-          .replace(/\<link rel="stylesheet".*\>/gms, "")
-          .replace(/\<style\>.*\<\/style\>/gms, "%CSS%%SCSS%")
-          .replace(
-            /function GetV().*\<\/script\>/gms,
-            "function GetV() {var d=document;\n"
-          ),
+      mangle: (str) => settingsPage(str, 3),
     },
     {
       file: "settings_sync.htm",
       name: "PAGE_settings_sync",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) =>
-        str
-          .replace(/\<link rel="stylesheet".*\>/gms, "")
-          .replace(/\<style\>.*\<\/style\>/gms, "%CSS%%SCSS%")
-          .replace(/function GetV().*\<\/script\>/gms, "function GetV() {\n"),
+      mangle: (str) => settingsPage(str, 4),
     },
     {
       file: "settings_time.htm",
       name: "PAGE_settings_time",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) =>
-        str
-          .replace(/\<link rel="stylesheet".*\>/gms, "")
-          .replace(/\<style\>.*\<\/style\>/gms, "%CSS%%SCSS%")
-          .replace(/function GetV().*\<\/script\>/gms, "function GetV() {\n"),
+      mangle: (str) => settingsPage(str, 5),
     },
     {
       file: "settings_sec.htm",
       name: "PAGE_settings_sec",
-      prepend: "=====(",
-      append: ")=====",
-      method: "plaintext",
+      method: "gzip",
       filter: "html-minify",
-      mangle: (str) =>
-        str
-          .replace(/\<link rel="stylesheet".*\>/gms, "")
-          .replace(/\<style\>.*\<\/style\>/gms, "%CSS%%SCSS%")
-          .replace(
-            /function GetV().*\<\/script\>/gms,
-            "function GetV() {var d=document;\n"
-          ),
+      mangle: (str) => settingsPage(str, 6),
     },
   ],
   "wled00/html_settings.h"
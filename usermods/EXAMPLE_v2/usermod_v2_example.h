@@ -20,6 +20,19 @@
  * 2. Register the usermod by adding #include "usermod_filename.h" in the top and registerUsermod(new MyUsermodClass()) in the bottom of usermods_list.cpp
  */
 
+//an effect registered in addEffects() below. It renders the segment currently being serviced,
+//SEGENV.data (currentRuntime().data) holds the dataLen bytes declared when registering
+static uint16_t mode_example_fade(WS2812FX& fx)
+{
+  WS2812FX::Segment_runtime& env = fx.currentRuntime();
+  uint8_t* level = env.data;
+  for (uint16_t i = 0; i < fx.currentLength(); i++) {
+    fx.setPixelColor(i, fx.color_from_palette(i * 255 / fx.currentLength() + *level, false, true, 0));
+  }
+  *level += 1 + (fx.currentSegment().speed >> 5);
+  return FRAMETIME;
+}
+
 //class name. Use something descriptive and leave the ": public Usermod" part :)
 class MyExampleUsermod : public Usermod {
   private:
@@ -37,6 +50,17 @@ class MyExampleUsermod : public Usermod {
     }
 
 
+    /*
+     * addEffects() is called once at boot, before setup() and before the boot preset is applied.
+     * Effects registered here get the ids after the built-in ones, show up in the effect list
+     * and are called like the built-in effects. See WS2812FX::addEffect() in FX.h.
+     */
+    void addEffects() {
+      //name, parameters used (see WLED_FX_LIST), default palette, bytes of SEGENV.data
+      strip.addEffect(mode_example_fade, PSTR("Example Fade"), PSTR("sx,pal"), 0, 1);
+    }
+
+
     /*
      * connected() is called every time the WiFi is (re)connected
      * Use it to initialize network interfaces
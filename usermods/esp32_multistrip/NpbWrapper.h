@@ -316,6 +316,17 @@ public:
     SetPixelColorRaw(indexPixel, col);
   }
 
+  // pixels are spread over several buses, so there is no single buffer to write into
+  void SetPixelsRaw(uint16_t indexPixel, const uint8_t* data, uint16_t count, uint8_t stride, const uint8_t* lut = nullptr)
+  {
+    for (uint16_t i = 0; i < count; i++) {
+      RgbwColor c(data[0], data[1], data[2], (stride > 3) ? data[3] : 0);
+      if (lut) { c.R = lut[c.R]; c.G = lut[c.G]; c.B = lut[c.B]; c.W = lut[c.W]; }
+      SetPixelColor(indexPixel + i, c);
+      data += stride;
+    }
+  }
+
   void SetBrightness(byte b)
   {
     switch (_type)
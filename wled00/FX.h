@@ -67,10 +67,13 @@
   #define MAX_NUM_TRANSITIONS  8
   /* How much data bytes all segments combined may allocate */
   #define MAX_SEGMENT_DATA  2048
+  /* Effects usermods can register at runtime */
+  #define MAX_USERMOD_EFFECTS  4
 #else
   #define MAX_NUM_SEGMENTS    16
   #define MAX_NUM_TRANSITIONS 16
   #define MAX_SEGMENT_DATA  8192
+  #define MAX_USERMOD_EFFECTS  8
 #endif
 
 #define LED_SKIP_AMOUNT  1
@@ -118,127 +121,157 @@
 #define IS_REVERSE      ((SEGMENT.options & REVERSE     ) == REVERSE     )
 #define IS_SELECTED     ((SEGMENT.options & SELECTED    ) == SELECTED    )
 
-#define MODE_COUNT  118
-
-#define FX_MODE_STATIC                   0
-#define FX_MODE_BLINK                    1
-#define FX_MODE_BREATH                   2
-#define FX_MODE_COLOR_WIPE               3
-#define FX_MODE_COLOR_WIPE_RANDOM        4
-#define FX_MODE_RANDOM_COLOR             5
-#define FX_MODE_COLOR_SWEEP              6
-#define FX_MODE_DYNAMIC                  7
-#define FX_MODE_RAINBOW                  8
-#define FX_MODE_RAINBOW_CYCLE            9
-#define FX_MODE_SCAN                    10
-#define FX_MODE_DUAL_SCAN               11
-#define FX_MODE_FADE                    12
-#define FX_MODE_THEATER_CHASE           13
-#define FX_MODE_THEATER_CHASE_RAINBOW   14
-#define FX_MODE_RUNNING_LIGHTS          15
-#define FX_MODE_SAW                     16
-#define FX_MODE_TWINKLE                 17
-#define FX_MODE_DISSOLVE                18
-#define FX_MODE_DISSOLVE_RANDOM         19
-#define FX_MODE_SPARKLE                 20
-#define FX_MODE_FLASH_SPARKLE           21
-#define FX_MODE_HYPER_SPARKLE           22
-#define FX_MODE_STROBE                  23
-#define FX_MODE_STROBE_RAINBOW          24
-#define FX_MODE_MULTI_STROBE            25
-#define FX_MODE_BLINK_RAINBOW           26
-#define FX_MODE_ANDROID                 27
-#define FX_MODE_CHASE_COLOR             28
-#define FX_MODE_CHASE_RANDOM            29
-#define FX_MODE_CHASE_RAINBOW           30
-#define FX_MODE_CHASE_FLASH             31
-#define FX_MODE_CHASE_FLASH_RANDOM      32
-#define FX_MODE_CHASE_RAINBOW_WHITE     33
-#define FX_MODE_COLORFUL                34
-#define FX_MODE_TRAFFIC_LIGHT           35
-#define FX_MODE_COLOR_SWEEP_RANDOM      36
-#define FX_MODE_RUNNING_COLOR           37
-#define FX_MODE_AURORA                  38
-#define FX_MODE_RUNNING_RANDOM          39
-#define FX_MODE_LARSON_SCANNER          40
-#define FX_MODE_COMET                   41
-#define FX_MODE_FIREWORKS               42
-#define FX_MODE_RAIN                    43
-#define FX_MODE_TETRIX                  44
-#define FX_MODE_FIRE_FLICKER            45
-#define FX_MODE_GRADIENT                46
-#define FX_MODE_LOADING                 47
-#define FX_MODE_POLICE                  48
-#define FX_MODE_POLICE_ALL              49
-#define FX_MODE_TWO_DOTS                50
-#define FX_MODE_TWO_AREAS               51
-#define FX_MODE_CIRCUS_COMBUSTUS        52
-#define FX_MODE_HALLOWEEN               53
-#define FX_MODE_TRICOLOR_CHASE          54
-#define FX_MODE_TRICOLOR_WIPE           55
-#define FX_MODE_TRICOLOR_FADE           56
-#define FX_MODE_LIGHTNING               57
-#define FX_MODE_ICU                     58
-#define FX_MODE_MULTI_COMET             59
-#define FX_MODE_DUAL_LARSON_SCANNER     60
-#define FX_MODE_RANDOM_CHASE            61
-#define FX_MODE_OSCILLATE               62
-#define FX_MODE_PRIDE_2015              63
-#define FX_MODE_JUGGLE                  64
-#define FX_MODE_PALETTE                 65
-#define FX_MODE_FIRE_2012               66
-#define FX_MODE_COLORWAVES              67
-#define FX_MODE_BPM                     68
-#define FX_MODE_FILLNOISE8              69
-#define FX_MODE_NOISE16_1               70
-#define FX_MODE_NOISE16_2               71
-#define FX_MODE_NOISE16_3               72
-#define FX_MODE_NOISE16_4               73
-#define FX_MODE_COLORTWINKLE            74
-#define FX_MODE_LAKE                    75
-#define FX_MODE_METEOR                  76
-#define FX_MODE_METEOR_SMOOTH           77
-#define FX_MODE_RAILWAY                 78
-#define FX_MODE_RIPPLE                  79
-#define FX_MODE_TWINKLEFOX              80
-#define FX_MODE_TWINKLECAT              81
-#define FX_MODE_HALLOWEEN_EYES          82
-#define FX_MODE_STATIC_PATTERN          83
-#define FX_MODE_TRI_STATIC_PATTERN      84
-#define FX_MODE_SPOTS                   85
-#define FX_MODE_SPOTS_FADE              86
-#define FX_MODE_GLITTER                 87
-#define FX_MODE_CANDLE                  88
-#define FX_MODE_STARBURST               89
-#define FX_MODE_EXPLODING_FIREWORKS     90
-#define FX_MODE_BOUNCINGBALLS           91
-#define FX_MODE_SINELON                 92
-#define FX_MODE_SINELON_DUAL            93
-#define FX_MODE_SINELON_RAINBOW         94
-#define FX_MODE_POPCORN                 95
-#define FX_MODE_DRIP                    96
-#define FX_MODE_PLASMA                  97
-#define FX_MODE_PERCENT                 98
-#define FX_MODE_RIPPLE_RAINBOW          99
-#define FX_MODE_HEARTBEAT              100
-#define FX_MODE_PACIFICA               101
-#define FX_MODE_CANDLE_MULTI           102
-#define FX_MODE_SOLID_GLITTER          103
-#define FX_MODE_SUNRISE                104
-#define FX_MODE_PHASED                 105
-#define FX_MODE_TWINKLEUP              106
-#define FX_MODE_NOISEPAL               107
-#define FX_MODE_SINEWAVE               108
-#define FX_MODE_PHASEDNOISE            109
-#define FX_MODE_FLOW                   110
-#define FX_MODE_CHUNCHUN               111
-#define FX_MODE_DANCING_SHADOWS        112
-#define FX_MODE_WASHING_MACHINE        113
-#define FX_MODE_CANDY_CANE             114
-#define FX_MODE_BLENDS                 115
-#define FX_MODE_TV_SIMULATOR           116
-#define FX_MODE_DYNAMIC_SMOOTH         117
+/*
+ * Effect registry. Adding an effect takes an entry here and the mode function in FX.cpp,
+ * the FX_MODE_ ids, the mode function declarations, the dispatch table and the names served by /json are generated from it.
+ * Entry: id (FX_MODE_ suffix), mode function, name, parameters the effect uses, default palette.
+ * Parameters: sx speed, ix intensity, pal palette, c1-c3 colors, 2d needs a matrix, ar audio reactive.
+ * A color is listed if the effect reads it, also through fade_out() (fades to color 2) or color_from_palette() with mcol 0-2
+ * on the Default palette. Palettes built from the colors are covered by pal.
+ * The default palette is used if the segment palette is 0 (Default), 0 here means the global default (Party).
+ * Ids are stored in presets, new effects are appended.
+ */
+#define WLED_FX_LIST(FX) \
+  FX(STATIC,                mode_static,                "Solid",               "c1",                  0) \
+  FX(BLINK,                 mode_blink,                 "Blink",               "sx,ix,pal,c1,c2",     0) \
+  FX(BREATH,                mode_breath,                "Breathe",             "sx,pal,c1,c2",        0) \
+  FX(COLOR_WIPE,            mode_color_wipe,            "Wipe",                "sx,ix,pal,c1,c2",     0) \
+  FX(COLOR_WIPE_RANDOM,     mode_color_wipe_random,     "Wipe Random",         "sx,ix",               0) \
+  FX(RANDOM_COLOR,          mode_random_color,          "Random Colors",       "sx,ix",               0) \
+  FX(COLOR_SWEEP,           mode_color_sweep,           "Sweep",               "sx,ix,pal,c1,c2",     0) \
+  FX(DYNAMIC,               mode_dynamic,               "Dynamic",             "sx,ix",               0) \
+  FX(RAINBOW,               mode_rainbow,               "Colorloop",           "sx,ix",               0) \
+  FX(RAINBOW_CYCLE,         mode_rainbow_cycle,         "Rainbow",             "sx,ix",               0) \
+  FX(SCAN,                  mode_scan,                  "Scan",                "sx,ix,pal,c1,c2",     0) \
+  FX(DUAL_SCAN,             mode_dual_scan,             "Scan Dual",           "sx,ix,pal,c1,c2,c3",  0) \
+  FX(FADE,                  mode_fade,                  "Fade",                "sx,pal,c1,c2",        0) \
+  FX(THEATER_CHASE,         mode_theater_chase,         "Theater",             "sx,ix,pal,c1,c2",     0) \
+  FX(THEATER_CHASE_RAINBOW, mode_theater_chase_rainbow, "Theater Rainbow",     "sx,ix,c2",            0) \
+  FX(RUNNING_LIGHTS,        mode_running_lights,        "Running",             "sx,ix,pal,c1,c2",     0) \
+  FX(SAW,                   mode_saw,                   "Saw",                 "sx,ix,pal,c1,c2",     0) \
+  FX(TWINKLE,               mode_twinkle,               "Twinkle",             "sx,ix,pal,c1,c2",     0) \
+  FX(DISSOLVE,              mode_dissolve,              "Dissolve",            "sx,ix,pal,c1,c2",     0) \
+  FX(DISSOLVE_RANDOM,       mode_dissolve_random,       "Dissolve Rnd",        "sx,ix,c2",            0) \
+  FX(SPARKLE,               mode_sparkle,               "Sparkle",             "sx,pal,c1,c2",        0) \
+  FX(FLASH_SPARKLE,         mode_flash_sparkle,         "Sparkle Dark",        "sx,ix,pal,c1,c2",     0) \
+  FX(HYPER_SPARKLE,         mode_hyper_sparkle,         "Sparkle+",            "sx,ix,pal,c1,c2",     0) \
+  FX(STROBE,                mode_strobe,                "Strobe",              "sx,pal,c1,c2",        0) \
+  FX(STROBE_RAINBOW,        mode_strobe_rainbow,        "Strobe Rainbow",      "sx,c2",               0) \
+  FX(MULTI_STROBE,          mode_multi_strobe,          "Strobe Mega",         "sx,ix,pal,c1,c2",     0) \
+  FX(BLINK_RAINBOW,         mode_blink_rainbow,         "Blink Rainbow",       "sx,ix,c2",            0) \
+  FX(ANDROID,               mode_android,               "Android",             "sx,ix,pal,c1,c2",     0) \
+  FX(CHASE_COLOR,           mode_chase_color,           "Chase",               "sx,ix,pal,c1,c2,c3",  0) \
+  FX(CHASE_RANDOM,          mode_chase_random,          "Chase Random",        "sx,ix,c1,c3",         0) \
+  FX(CHASE_RAINBOW,         mode_chase_rainbow,         "Chase Rainbow",       "sx,ix,c1,c2",         0) \
+  FX(CHASE_FLASH,           mode_chase_flash,           "Chase Flash",         "sx,pal,c1,c2",        0) \
+  FX(CHASE_FLASH_RANDOM,    mode_chase_flash_random,    "Chase Flash Rnd",     "sx,c1,c2",            0) \
+  FX(CHASE_RAINBOW_WHITE,   mode_chase_rainbow_white,   "Rainbow Runner",      "sx,ix,c1",            0) \
+  FX(COLORFUL,              mode_colorful,              "Colorful",            "sx,ix,pal,c1,c2,c3",  0) \
+  FX(TRAFFIC_LIGHT,         mode_traffic_light,         "Traffic Light",       "sx,ix,pal,c2",        0) \
+  FX(COLOR_SWEEP_RANDOM,    mode_color_sweep_random,    "Sweep Random",        "sx,ix",               0) \
+  FX(RUNNING_COLOR,         mode_running_color,         "Running 2",           "sx,ix,pal,c1,c2",     0) \
+  FX(AURORA,                mode_aurora,                "Aurora",              "sx,ix,pal,c1,c2,c3",  0) \
+  FX(RUNNING_RANDOM,        mode_running_random,        "Stream",              "sx,ix",               0) \
+  FX(LARSON_SCANNER,        mode_larson_scanner,        "Scanner",             "sx,ix,pal,c1,c2",     0) \
+  FX(COMET,                 mode_comet,                 "Lighthouse",          "sx,ix,pal,c1,c2",     0) \
+  FX(FIREWORKS,             mode_fireworks,             "Fireworks",           "sx,ix,pal,c1,c2",     0) \
+  FX(RAIN,                  mode_rain,                  "Rain",                "sx,ix,pal,c1,c2",     0) \
+  FX(TETRIX,                mode_tetrix,                "Tetrix",              "sx,ix,pal,c1,c2",     0) \
+  FX(FIRE_FLICKER,          mode_fire_flicker,          "Fire Flicker",        "sx,ix,pal,c1",        0) \
+  FX(GRADIENT,              mode_gradient,              "Gradient",            "sx,ix,pal,c1,c2",     0) \
+  FX(LOADING,               mode_loading,               "Loading",             "sx,ix,pal,c1,c2",     0) \
+  FX(POLICE,                mode_police,                "Police",              "sx,ix,c2",            0) \
+  FX(POLICE_ALL,            mode_police_all,            "Police All",          "sx,ix",               0) \
+  FX(TWO_DOTS,              mode_two_dots,              "Two Dots",            "sx,ix,c1,c2,c3",      0) \
+  FX(TWO_AREAS,             mode_two_areas,             "Two Areas",           "sx,ix,c1,c2",         0) \
+  FX(CIRCUS_COMBUSTUS,      mode_circus_combustus,      "Circus",              "sx,ix,pal,c2",        0) \
+  FX(HALLOWEEN,             mode_halloween,             "Halloween",           "sx,ix",               0) \
+  FX(TRICOLOR_CHASE,        mode_tricolor_chase,        "Tri Chase",           "sx,ix,pal,c1,c2,c3",  0) \
+  FX(TRICOLOR_WIPE,         mode_tricolor_wipe,         "Tri Wipe",            "sx,pal,c1,c2,c3",     0) \
+  FX(TRICOLOR_FADE,         mode_tricolor_fade,         "Tri Fade",            "sx,pal,c1,c2,c3",     0) \
+  FX(LIGHTNING,             mode_lightning,             "Lightning",           "sx,ix,pal,c1,c2",     0) \
+  FX(ICU,                   mode_icu,                   "ICU",                 "sx,ix,pal,c1,c2",     0) \
+  FX(MULTI_COMET,           mode_multi_comet,           "Multi Comet",         "sx,ix,pal,c1,c2,c3",  0) \
+  FX(DUAL_LARSON_SCANNER,   mode_dual_larson_scanner,   "Scanner Dual",        "sx,ix,pal,c1,c2,c3",  0) \
+  FX(RANDOM_CHASE,          mode_random_chase,          "Stream 2",            "sx",                  0) \
+  FX(OSCILLATE,             mode_oscillate,             "Oscillate",           "sx,ix,c1,c2,c3",      0) \
+  FX(PRIDE_2015,            mode_pride_2015,            "Pride 2015",          "sx",                  0) \
+  FX(JUGGLE,                mode_juggle,                "Juggle",              "sx,ix,pal,c2",        0) \
+  FX(PALETTE,               mode_palette,               "Palette",             "sx,pal",              0) \
+  FX(FIRE_2012,             mode_fire_2012,             "Fire 2012",           "sx,ix,pal",          35) \
+  FX(COLORWAVES,            mode_colorwaves,            "Colorwaves",          "sx,ix,pal",          26) \
+  FX(BPM,                   mode_bpm,                   "Bpm",                 "sx,pal",              0) \
+  FX(FILLNOISE8,            mode_fillnoise8,            "Fill Noise",          "sx,pal",              9) \
+  FX(NOISE16_1,             mode_noise16_1,             "Noise 1",             "sx,pal",             20) \
+  FX(NOISE16_2,             mode_noise16_2,             "Noise 2",             "sx,pal",             43) \
+  FX(NOISE16_3,             mode_noise16_3,             "Noise 3",             "sx,pal",             35) \
+  FX(NOISE16_4,             mode_noise16_4,             "Noise 4",             "sx,pal",             26) \
+  FX(COLORTWINKLE,          mode_colortwinkle,          "Colortwinkles",       "sx,ix,pal",           0) \
+  FX(LAKE,                  mode_lake,                  "Lake",                "sx,pal",              0) \
+  FX(METEOR,                mode_meteor,                "Meteor",              "sx,ix,pal",           4) \
+  FX(METEOR_SMOOTH,         mode_meteor_smooth,         "Meteor Smooth",       "sx,ix,pal",           4) \
+  FX(RAILWAY,               mode_railway,               "Railway",             "sx,ix,pal",           4) \
+  FX(RIPPLE,                mode_ripple,                "Ripple",              "sx,ix,pal,c2",        4) \
+  FX(TWINKLEFOX,            mode_twinklefox,            "Twinklefox",          "sx,ix,pal,c2",        4) \
+  FX(TWINKLECAT,            mode_twinklecat,            "Twinklecat",          "sx,ix,pal,c2",        4) \
+  FX(HALLOWEEN_EYES,        mode_halloween_eyes,        "Halloween Eyes",      "sx,ix,pal,c1,c2",     4) \
+  FX(STATIC_PATTERN,        mode_static_pattern,        "Solid Pattern",       "sx,ix,pal,c1,c2",     4) \
+  FX(TRI_STATIC_PATTERN,    mode_tri_static_pattern,    "Solid Pattern Tri",   "ix,c1,c2,c3",         4) \
+  FX(SPOTS,                 mode_spots,                 "Spots",               "sx,ix,pal,c1,c2",     4) \
+  FX(SPOTS_FADE,            mode_spots_fade,            "Spots Fade",          "sx,ix,pal,c1,c2",     4) \
+  FX(GLITTER,               mode_glitter,               "Glitter",             "sx,ix,pal",          11) \
+  FX(CANDLE,                mode_candle,                "Candle",              "sx,ix,pal,c1,c2",     4) \
+  FX(STARBURST,             mode_starburst,             "Fireworks Starburst", "sx,ix,c2",            4) \
+  FX(EXPLODING_FIREWORKS,   mode_exploding_fireworks,   "Fireworks 1D",        "sx,ix,pal,c1",        4) \
+  FX(BOUNCINGBALLS,         mode_bouncing_balls,        "Bouncing Balls",      "sx,ix,pal,c1,c2,c3",  4) \
+  FX(SINELON,               mode_sinelon,               "Sinelon",             "sx,ix,pal,c1,c2",     4) \
+  FX(SINELON_DUAL,          mode_sinelon_dual,          "Sinelon Dual",        "sx,ix,pal,c1,c2,c3",  4) \
+  FX(SINELON_RAINBOW,       mode_sinelon_rainbow,       "Sinelon Rainbow",     "sx,ix,c2",            4) \
+  FX(POPCORN,               mode_popcorn,               "Popcorn",             "sx,ix,pal,c1,c2,c3",  4) \
+  FX(DRIP,                  mode_drip,                  "Drip",                "sx,ix,c1,c2",         4) \
+  FX(PLASMA,                mode_plasma,                "Plasma",              "sx,ix,pal",           4) \
+  FX(PERCENT,               mode_percent,               "Percent",             "sx,ix,pal,c1,c2",     4) \
+  FX(RIPPLE_RAINBOW,        mode_ripple_rainbow,        "Ripple Rainbow",      "sx,ix,pal",           4) \
+  FX(HEARTBEAT,             mode_heartbeat,             "Heartbeat",           "sx,ix,pal,c1,c2",     4) \
+  FX(PACIFICA,              mode_pacifica,              "Pacifica",            "sx,ix,pal",           4) \
+  FX(CANDLE_MULTI,          mode_candle_multi,          "Candle Multi",        "sx,ix,pal,c1,c2",     4) \
+  FX(SOLID_GLITTER,         mode_solid_glitter,         "Solid Glitter",       "ix,c1",               4) \
+  FX(SUNRISE,               mode_sunrise,               "Sunrise",             "sx,ix,pal",          35) \
+  FX(PHASED,                mode_phased,                "Phased",              "sx,ix,pal,c1,c2",     4) \
+  FX(TWINKLEUP,             mode_twinkleup,             "Twinkleup",           "sx,ix,pal,c1,c2",     4) \
+  FX(NOISEPAL,              mode_noisepal,              "Noise Pal",           "sx,ix,pal",           4) \
+  FX(SINEWAVE,              mode_sinewave,              "Sine",                "sx,ix,pal,c1,c2",     4) \
+  FX(PHASEDNOISE,           mode_phased_noise,          "Phased Noise",        "sx,ix,pal,c1,c2",     4) \
+  FX(FLOW,                  mode_flow,                  "Flow",                "sx,ix,pal",           6) \
+  FX(CHUNCHUN,              mode_chunchun,              "Chunchun",            "sx,ix,pal,c1,c2",     4) \
+  FX(DANCING_SHADOWS,       mode_dancing_shadows,       "Dancing Shadows",     "sx,ix,pal,c1",        4) \
+  FX(WASHING_MACHINE,       mode_washing_machine,       "Washing Machine",     "sx,ix,pal",           4) \
+  FX(CANDY_CANE,            mode_candy_cane,            "Candy Cane",          "sx,ix",               4) \
+  FX(BLENDS,                mode_blends,                "Blends",              "sx,ix,pal",           4) \
+  FX(TV_SIMULATOR,          mode_tv_simulator,          "TV Simulator",        "",                    4) \
+  FX(DYNAMIC_SMOOTH,        mode_dynamic_smooth,        "Dynamic Smooth",      "sx,ix",               4)
+
+/*
+ * Usermods can add effects at compile time: build with -D WLED_FX_USERMOD_HEADER=\"path/to/header.h\" and
+ * define WLED_FX_USERMOD_LIST(FX) there, in the same format. The mode functions are members of WS2812FX
+ * like the built-in ones, define them (uint16_t WS2812FX::mode_name(void) {...}) in the usermod included by usermods_list.cpp.
+ */
+#ifdef WLED_FX_USERMOD_HEADER
+  #include WLED_FX_USERMOD_HEADER
+#endif
+#ifndef WLED_FX_USERMOD_LIST
+  #define WLED_FX_USERMOD_LIST(FX)
+#endif
+#define WLED_FX_ALL(FX) WLED_FX_LIST(FX) WLED_FX_USERMOD_LIST(FX)
 
+enum {
+  #define FX_ENUM(id, fn, name, uses, pal) FX_MODE_##id,
+  WLED_FX_ALL(FX_ENUM)
+  #undef FX_ENUM
+  MODE_COUNT
+};
+static_assert(MODE_COUNT <= 255, "effect ids are 8 bit");
+static_assert(FX_MODE_DYNAMIC_SMOOTH == 117, "built-in effect ids changed, they are stored in presets");
 
 class WS2812FX {
   typedef uint16_t (WS2812FX::*mode_ptr)(void);
@@ -458,126 +491,6 @@ class WS2812FX {
 
     WS2812FX() {
       WS2812FX::instance = this;
-      //assign each member of the _mode[] array to its respective function reference 
-      _mode[FX_MODE_STATIC]                  = &WS2812FX::mode_static;
-      _mode[FX_MODE_BLINK]                   = &WS2812FX::mode_blink;
-      _mode[FX_MODE_COLOR_WIPE]              = &WS2812FX::mode_color_wipe;
-      _mode[FX_MODE_COLOR_WIPE_RANDOM]       = &WS2812FX::mode_color_wipe_random;
-      _mode[FX_MODE_RANDOM_COLOR]            = &WS2812FX::mode_random_color;
-      _mode[FX_MODE_COLOR_SWEEP]             = &WS2812FX::mode_color_sweep;
-      _mode[FX_MODE_DYNAMIC]                 = &WS2812FX::mode_dynamic;
-      _mode[FX_MODE_RAINBOW]                 = &WS2812FX::mode_rainbow;
-      _mode[FX_MODE_RAINBOW_CYCLE]           = &WS2812FX::mode_rainbow_cycle;
-      _mode[FX_MODE_SCAN]                    = &WS2812FX::mode_scan;
-      _mode[FX_MODE_DUAL_SCAN]               = &WS2812FX::mode_dual_scan;
-      _mode[FX_MODE_FADE]                    = &WS2812FX::mode_fade;
-      _mode[FX_MODE_THEATER_CHASE]           = &WS2812FX::mode_theater_chase;
-      _mode[FX_MODE_THEATER_CHASE_RAINBOW]   = &WS2812FX::mode_theater_chase_rainbow;
-      _mode[FX_MODE_SAW]                     = &WS2812FX::mode_saw;
-      _mode[FX_MODE_TWINKLE]                 = &WS2812FX::mode_twinkle;
-      _mode[FX_MODE_DISSOLVE]                = &WS2812FX::mode_dissolve;
-      _mode[FX_MODE_DISSOLVE_RANDOM]         = &WS2812FX::mode_dissolve_random;
-      _mode[FX_MODE_SPARKLE]                 = &WS2812FX::mode_sparkle;
-      _mode[FX_MODE_FLASH_SPARKLE]           = &WS2812FX::mode_flash_sparkle;
-      _mode[FX_MODE_HYPER_SPARKLE]           = &WS2812FX::mode_hyper_sparkle;
-      _mode[FX_MODE_STROBE]                  = &WS2812FX::mode_strobe;
-      _mode[FX_MODE_STROBE_RAINBOW]          = &WS2812FX::mode_strobe_rainbow;
-      _mode[FX_MODE_MULTI_STROBE]            = &WS2812FX::mode_multi_strobe;
-      _mode[FX_MODE_BLINK_RAINBOW]           = &WS2812FX::mode_blink_rainbow;
-      _mode[FX_MODE_ANDROID]                 = &WS2812FX::mode_android;
-      _mode[FX_MODE_CHASE_COLOR]             = &WS2812FX::mode_chase_color;
-      _mode[FX_MODE_CHASE_RANDOM]            = &WS2812FX::mode_chase_random;
-      _mode[FX_MODE_CHASE_RAINBOW]           = &WS2812FX::mode_chase_rainbow;
-      _mode[FX_MODE_CHASE_FLASH]             = &WS2812FX::mode_chase_flash;
-      _mode[FX_MODE_CHASE_FLASH_RANDOM]      = &WS2812FX::mode_chase_flash_random;
-      _mode[FX_MODE_CHASE_RAINBOW_WHITE]     = &WS2812FX::mode_chase_rainbow_white;
-      _mode[FX_MODE_COLORFUL]                = &WS2812FX::mode_colorful;
-      _mode[FX_MODE_TRAFFIC_LIGHT]           = &WS2812FX::mode_traffic_light;
-      _mode[FX_MODE_COLOR_SWEEP_RANDOM]      = &WS2812FX::mode_color_sweep_random;
-      _mode[FX_MODE_RUNNING_COLOR]           = &WS2812FX::mode_running_color;
-      _mode[FX_MODE_AURORA]                  = &WS2812FX::mode_aurora;
-      _mode[FX_MODE_RUNNING_RANDOM]          = &WS2812FX::mode_running_random;
-      _mode[FX_MODE_LARSON_SCANNER]          = &WS2812FX::mode_larson_scanner;
-      _mode[FX_MODE_COMET]                   = &WS2812FX::mode_comet;
-      _mode[FX_MODE_FIREWORKS]               = &WS2812FX::mode_fireworks;
-      _mode[FX_MODE_RAIN]                    = &WS2812FX::mode_rain;
-      _mode[FX_MODE_TETRIX]                  = &WS2812FX::mode_tetrix;
-      _mode[FX_MODE_FIRE_FLICKER]            = &WS2812FX::mode_fire_flicker;
-      _mode[FX_MODE_GRADIENT]                = &WS2812FX::mode_gradient;
-      _mode[FX_MODE_LOADING]                 = &WS2812FX::mode_loading;
-      _mode[FX_MODE_POLICE]                  = &WS2812FX::mode_police;
-      _mode[FX_MODE_POLICE_ALL]              = &WS2812FX::mode_police_all;
-      _mode[FX_MODE_TWO_DOTS]                = &WS2812FX::mode_two_dots;
-      _mode[FX_MODE_TWO_AREAS]               = &WS2812FX::mode_two_areas;
-      _mode[FX_MODE_CIRCUS_COMBUSTUS]        = &WS2812FX::mode_circus_combustus;
-      _mode[FX_MODE_HALLOWEEN]               = &WS2812FX::mode_halloween;
-      _mode[FX_MODE_TRICOLOR_CHASE]          = &WS2812FX::mode_tricolor_chase;
-      _mode[FX_MODE_TRICOLOR_WIPE]           = &WS2812FX::mode_tricolor_wipe;
-      _mode[FX_MODE_TRICOLOR_FADE]           = &WS2812FX::mode_tricolor_fade;
-      _mode[FX_MODE_BREATH]                  = &WS2812FX::mode_breath;
-      _mode[FX_MODE_RUNNING_LIGHTS]          = &WS2812FX::mode_running_lights;
-      _mode[FX_MODE_LIGHTNING]               = &WS2812FX::mode_lightning;
-      _mode[FX_MODE_ICU]                     = &WS2812FX::mode_icu;
-      _mode[FX_MODE_MULTI_COMET]             = &WS2812FX::mode_multi_comet;
-      _mode[FX_MODE_DUAL_LARSON_SCANNER]     = &WS2812FX::mode_dual_larson_scanner;
-      _mode[FX_MODE_RANDOM_CHASE]            = &WS2812FX::mode_random_chase;
-      _mode[FX_MODE_OSCILLATE]               = &WS2812FX::mode_oscillate;
-      _mode[FX_MODE_FIRE_2012]               = &WS2812FX::mode_fire_2012;
-      _mode[FX_MODE_PRIDE_2015]              = &WS2812FX::mode_pride_2015;
-      _mode[FX_MODE_BPM]                     = &WS2812FX::mode_bpm;
-      _mode[FX_MODE_JUGGLE]                  = &WS2812FX::mode_juggle;
-      _mode[FX_MODE_PALETTE]                 = &WS2812FX::mode_palette;
-      _mode[FX_MODE_COLORWAVES]              = &WS2812FX::mode_colorwaves;
-      _mode[FX_MODE_FILLNOISE8]              = &WS2812FX::mode_fillnoise8;
-      _mode[FX_MODE_NOISE16_1]               = &WS2812FX::mode_noise16_1;
-      _mode[FX_MODE_NOISE16_2]               = &WS2812FX::mode_noise16_2;
-      _mode[FX_MODE_NOISE16_3]               = &WS2812FX::mode_noise16_3;
-      _mode[FX_MODE_NOISE16_4]               = &WS2812FX::mode_noise16_4;
-      _mode[FX_MODE_COLORTWINKLE]            = &WS2812FX::mode_colortwinkle;
-      _mode[FX_MODE_LAKE]                    = &WS2812FX::mode_lake;
-      _mode[FX_MODE_METEOR]                  = &WS2812FX::mode_meteor;
-      _mode[FX_MODE_METEOR_SMOOTH]           = &WS2812FX::mode_meteor_smooth;
-      _mode[FX_MODE_RAILWAY]                 = &WS2812FX::mode_railway;
-      _mode[FX_MODE_RIPPLE]                  = &WS2812FX::mode_ripple;
-      _mode[FX_MODE_TWINKLEFOX]              = &WS2812FX::mode_twinklefox;
-      _mode[FX_MODE_TWINKLECAT]              = &WS2812FX::mode_twinklecat;
-      _mode[FX_MODE_HALLOWEEN_EYES]          = &WS2812FX::mode_halloween_eyes;
-      _mode[FX_MODE_STATIC_PATTERN]          = &WS2812FX::mode_static_pattern;
-      _mode[FX_MODE_TRI_STATIC_PATTERN]      = &WS2812FX::mode_tri_static_pattern;
-      _mode[FX_MODE_SPOTS]                   = &WS2812FX::mode_spots;
-      _mode[FX_MODE_SPOTS_FADE]              = &WS2812FX::mode_spots_fade;
-      _mode[FX_MODE_GLITTER]                 = &WS2812FX::mode_glitter;
-      _mode[FX_MODE_CANDLE]                  = &WS2812FX::mode_candle;
-      _mode[FX_MODE_STARBURST]               = &WS2812FX::mode_starburst;
-      _mode[FX_MODE_EXPLODING_FIREWORKS]     = &WS2812FX::mode_exploding_fireworks;
-      _mode[FX_MODE_BOUNCINGBALLS]           = &WS2812FX::mode_bouncing_balls;
-      _mode[FX_MODE_SINELON]                 = &WS2812FX::mode_sinelon;
-      _mode[FX_MODE_SINELON_DUAL]            = &WS2812FX::mode_sinelon_dual;
-      _mode[FX_MODE_SINELON_RAINBOW]         = &WS2812FX::mode_sinelon_rainbow;
-      _mode[FX_MODE_POPCORN]                 = &WS2812FX::mode_popcorn;
-      _mode[FX_MODE_DRIP]                    = &WS2812FX::mode_drip;
-      _mode[FX_MODE_PLASMA]                  = &WS2812FX::mode_plasma;
-      _mode[FX_MODE_PERCENT]                 = &WS2812FX::mode_percent;
-      _mode[FX_MODE_RIPPLE_RAINBOW]          = &WS2812FX::mode_ripple_rainbow;
-      _mode[FX_MODE_HEARTBEAT]               = &WS2812FX::mode_heartbeat;
-      _mode[FX_MODE_PACIFICA]                = &WS2812FX::mode_pacifica;
-      _mode[FX_MODE_CANDLE_MULTI]            = &WS2812FX::mode_candle_multi;
-      _mode[FX_MODE_SOLID_GLITTER]           = &WS2812FX::mode_solid_glitter;
-      _mode[FX_MODE_SUNRISE]                 = &WS2812FX::mode_sunrise;
-      _mode[FX_MODE_PHASED]                  = &WS2812FX::mode_phased;
-      _mode[FX_MODE_TWINKLEUP]               = &WS2812FX::mode_twinkleup;
-      _mode[FX_MODE_NOISEPAL]                = &WS2812FX::mode_noisepal;
-      _mode[FX_MODE_SINEWAVE]                = &WS2812FX::mode_sinewave;
-      _mode[FX_MODE_PHASEDNOISE]             = &WS2812FX::mode_phased_noise;
-      _mode[FX_MODE_FLOW]                    = &WS2812FX::mode_flow;
-      _mode[FX_MODE_CHUNCHUN]                = &WS2812FX::mode_chunchun;
-      _mode[FX_MODE_DANCING_SHADOWS]         = &WS2812FX::mode_dancing_shadows;
-      _mode[FX_MODE_WASHING_MACHINE]         = &WS2812FX::mode_washing_machine;
-      _mode[FX_MODE_CANDY_CANE]              = &WS2812FX::mode_candy_cane;
-      _mode[FX_MODE_BLENDS]                  = &WS2812FX::mode_blends;
-      _mode[FX_MODE_TV_SIMULATOR]            = &WS2812FX::mode_tv_simulator;
-      _mode[FX_MODE_DYNAMIC_SMOOTH]          = &WS2812FX::mode_dynamic_smooth;
-
       _brightness = DEFAULT_BRIGHTNESS;
       currentPalette = CRGBPalette16(CRGB::Black);
       targetPalette = CloudColors_p;
@@ -608,8 +521,9 @@ class WS2812FX {
       resetSegments(),
       setPixelColor(uint16_t n, uint32_t c),
       setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0),
+      setRealtimePixels(uint16_t start, const uint8_t* data, uint16_t count, uint8_t stride, bool gamma),
       show(void),
-      setRgbwPwm(void),
+      setRgbwPwm(bool gammaCol),
       setColorOrder(uint8_t co),
       setPixelSegment(uint8_t n);
 
@@ -671,127 +585,35 @@ class WS2812FX {
     WS2812FX::Segment*
       getSegments(void);
 
-    // builtin modes
-    uint16_t
-      mode_static(void),
-      mode_blink(void),
-      mode_blink_rainbow(void),
-      mode_strobe(void),
-      mode_strobe_rainbow(void),
-      mode_color_wipe(void),
-      mode_color_sweep(void),
-      mode_color_wipe_random(void),
-      mode_color_sweep_random(void),
-      mode_random_color(void),
-      mode_dynamic(void),
-      mode_breath(void),
-      mode_fade(void),
-      mode_scan(void),
-      mode_dual_scan(void),
-      mode_theater_chase(void),
-      mode_theater_chase_rainbow(void),
-      mode_rainbow(void),
-      mode_rainbow_cycle(void),
-      mode_running_lights(void),
-      mode_saw(void),
-      mode_twinkle(void),
-      mode_dissolve(void),
-      mode_dissolve_random(void),
-      mode_sparkle(void),
-      mode_flash_sparkle(void),
-      mode_hyper_sparkle(void),
-      mode_multi_strobe(void),
-      mode_android(void),
-      mode_chase_color(void),
-      mode_chase_random(void),
-      mode_chase_rainbow(void),
-      mode_chase_flash(void),
-      mode_chase_flash_random(void),
-      mode_chase_rainbow_white(void),
-      mode_colorful(void),
-      mode_traffic_light(void),
-      mode_running_color(void),
-      mode_aurora(void),
-      mode_running_random(void),
-      mode_larson_scanner(void),
-      mode_comet(void),
-      mode_fireworks(void),
-      mode_rain(void),
-      mode_tetrix(void),
-      mode_halloween(void),
-      mode_fire_flicker(void),
-      mode_gradient(void),
-      mode_loading(void),
-      mode_police(void),
-      mode_police_all(void),
-      mode_two_dots(void),
-      mode_two_areas(void),
-      mode_circus_combustus(void),
-      mode_bicolor_chase(void),
-      mode_tricolor_chase(void),
-      mode_tricolor_wipe(void),
-      mode_tricolor_fade(void),
-      mode_lightning(void),
-      mode_icu(void),
-      mode_multi_comet(void),
-      mode_dual_larson_scanner(void),
-      mode_random_chase(void),
-      mode_oscillate(void),
-      mode_fire_2012(void),
-      mode_pride_2015(void),
-      mode_bpm(void),
-      mode_juggle(void),
-      mode_palette(void),
-      mode_colorwaves(void),
-      mode_fillnoise8(void),
-      mode_noise16_1(void),
-      mode_noise16_2(void),
-      mode_noise16_3(void),
-      mode_noise16_4(void),
-      mode_colortwinkle(void),
-      mode_lake(void),
-      mode_meteor(void),
-      mode_meteor_smooth(void),
-      mode_railway(void),
-      mode_ripple(void),
-      mode_twinklefox(void),
-      mode_twinklecat(void),
-      mode_halloween_eyes(void),
-      mode_static_pattern(void),
-      mode_tri_static_pattern(void),
-      mode_spots(void),
-      mode_spots_fade(void),
-      mode_glitter(void),
-      mode_candle(void),
-      mode_starburst(void),
-      mode_exploding_fireworks(void),
-      mode_bouncing_balls(void),
-      mode_sinelon(void),
-      mode_sinelon_dual(void),
-      mode_sinelon_rainbow(void),
-      mode_popcorn(void),
-      mode_drip(void),
-      mode_plasma(void),
-      mode_percent(void),
-      mode_ripple_rainbow(void),
-      mode_heartbeat(void),
-      mode_pacifica(void),
-      mode_candle_multi(void),
-      mode_solid_glitter(void),
-      mode_sunrise(void),
-      mode_phased(void),
-      mode_twinkleup(void),
-      mode_noisepal(void),
-      mode_sinewave(void),
-      mode_phased_noise(void),
-      mode_flow(void),
-      mode_chunchun(void),
-      mode_dancing_shadows(void),
-      mode_washing_machine(void),
-      mode_candy_cane(void),
-      mode_blends(void),
-      mode_tv_simulator(void),
-      mode_dynamic_smooth(void);
+    /*
+     * Effects registered by usermods at runtime (Usermod::addEffects()), with ids following the built-in ones.
+     * The function is called from service() like a mode function, for the segment the accessors below refer to.
+     * SEGENV.data is allocated with dataLen bytes before the call, mode_static() runs instead if that fails.
+     * name and uses (see WLED_FX_LIST) are not copied, they must stay valid (PSTR() or static strings) and contain no quotes.
+     */
+    typedef uint16_t (*effect_function)(WS2812FX& fx);
+    typedef struct UsermodEffect {
+      effect_function fn;
+      const char* name;
+      const char* uses;
+      uint16_t dataLen;
+      uint8_t palette; //default palette
+    } usermod_effect;
+
+    uint8_t addEffect(effect_function fn, const char* name, const char* uses = "", uint8_t palette = 0, uint16_t dataLen = 0); //returns the id, 255 if full
+    const UsermodEffect* getUsermodEffect(uint8_t id); //nullptr for built-in effects
+    uint8_t getUsermodEffectCount(void) { return _usermodEffectCount; }
+
+    //state of the segment being rendered, for effects outside the class
+    WS2812FX::Segment& currentSegment(void) { return SEGMENT; }
+    WS2812FX::Segment_runtime& currentRuntime(void) { return SEGENV; }
+    uint16_t currentLength(void) { return SEGLEN; }
+    uint32_t segmentColor(uint8_t slot) { return slot < NUM_COLORS ? SEGCOLOR(slot) : 0; }
+
+    // mode functions, see WLED_FX_LIST
+    #define FX_DECL(id, fn, name, uses, pal) uint16_t fn(void);
+    WLED_FX_ALL(FX_DECL)
+    #undef FX_DECL
 
   private:
     NeoPixelWrapper *bus;
@@ -816,7 +638,16 @@ class WS2812FX {
       _skipFirstMode,
       _triggered;
 
-    mode_ptr _mode[MODE_COUNT]; // SRAM footprint: 4 bytes per element
+    //registry entry, the table is in flash
+    struct Effect {
+      mode_ptr fn;
+      uint8_t palette; //default palette
+    };
+    static const Effect _effects[MODE_COUNT];
+
+    UsermodEffect _usermodEffects[MAX_USERMOD_EFFECTS];
+    uint8_t _usermodEffectCount = 0;
+    uint16_t runUsermodEffect(void);
 
     show_callback _callback = nullptr;
 
@@ -859,6 +690,12 @@ class WS2812FX {
     uint32_t _analogLastShow = 0;
     RgbwColor _analogLastColor = 0;
     uint8_t _analogLastBri = 0;
+    bool _analogLastGammaCol = false;
+    uint8_t _analogBri = DEFAULT_BRIGHTNESS; //brightness before 8 bit gamma
+    uint16_t _pwmGammaT[256] = {0};          //16 bit gamma table for PWM output
+
+    uint16_t pwmDuty(uint16_t c16, uint32_t bri16);
+    void calcPwmGammaTable(float gamma);
     #endif
     
     uint8_t _segment_index = 0;
@@ -878,21 +715,20 @@ class WS2812FX {
       transitionProgress(uint8_t tNr);
 };
 
-//10 names per line
-const char JSON_mode_names[] PROGMEM = R"=====([
-"Solid","Blink","Breathe","Wipe","Wipe Random","Random Colors","Sweep","Dynamic","Colorloop","Rainbow",
-"Scan","Scan Dual","Fade","Theater","Theater Rainbow","Running","Saw","Twinkle","Dissolve","Dissolve Rnd",
-"Sparkle","Sparkle Dark","Sparkle+","Strobe","Strobe Rainbow","Strobe Mega","Blink Rainbow","Android","Chase","Chase Random",
-"Chase Rainbow","Chase Flash","Chase Flash Rnd","Rainbow Runner","Colorful","Traffic Light","Sweep Random","Running 2","Aurora","Stream",
-"Scanner","Lighthouse","Fireworks","Rain","Tetrix","Fire Flicker","Gradient","Loading","Police","Police All",
-"Two Dots","Two Areas","Circus","Halloween","Tri Chase","Tri Wipe","Tri Fade","Lightning","ICU","Multi Comet",
-"Scanner Dual","Stream 2","Oscillate","Pride 2015","Juggle","Palette","Fire 2012","Colorwaves","Bpm","Fill Noise",
-"Noise 1","Noise 2","Noise 3","Noise 4","Colortwinkles","Lake","Meteor","Meteor Smooth","Railway","Ripple",
-"Twinklefox","Twinklecat","Halloween Eyes","Solid Pattern","Solid Pattern Tri","Spots","Spots Fade","Glitter","Candle","Fireworks Starburst",
-"Fireworks 1D","Bouncing Balls","Sinelon","Sinelon Dual","Sinelon Rainbow","Popcorn","Drip","Plasma","Percent","Ripple Rainbow",
-"Heartbeat","Pacifica","Candle Multi", "Solid Glitter","Sunrise","Phased","Twinkleup","Noise Pal", "Sine","Phased Noise",
-"Flow","Chunchun","Dancing Shadows","Washing Machine","Candy Cane","Blends","TV Simulator","Dynamic Smooth"
-])=====";
+//names as a JSON array, generated from WLED_FX_ALL. Each name is followed by a comma, so the last one
+//is too and the array is only valid JSON without it (see JsonStream), parsers counting commas are not affected
+const char JSON_mode_names[] PROGMEM = "["
+  #define FX_JSON_NAME(id, fn, name, uses, pal) "\"" name "\","
+  WLED_FX_ALL(FX_JSON_NAME)
+  #undef FX_JSON_NAME
+  "]";
+
+//[["name","uses","pal"],[name, uses, default palette] per effect], the column names come first so the entries can be concatenated
+const char JSON_mode_data[] PROGMEM = "[[\"name\",\"uses\",\"pal\"]"
+  #define FX_JSON_DATA(id, fn, name, uses, pal) ",[\"" name "\",\"" uses "\"," #pal "]"
+  WLED_FX_ALL(FX_JSON_DATA)
+  #undef FX_JSON_DATA
+  "]";
 
 
 const char JSON_palette_names[] PROGMEM = R"=====([
@@ -27,6 +27,13 @@
 #include "FX.h"
 #include "palettes.h"
 
+//effect registry, mode function and default palette by FX_MODE_ id. In flash, read with memcpy_P()/pgm_read_byte()
+const WS2812FX::Effect WS2812FX::_effects[MODE_COUNT] PROGMEM = {
+  #define FX_ENTRY(id, fn, name, uses, pal) { &WS2812FX::fn, pal },
+  WLED_FX_ALL(FX_ENTRY)
+  #undef FX_ENTRY
+};
+
 //enable custom per-LED mapping. This can allow for better effects on matrices or special displays
 //#define WLED_CUSTOM_LED_MAPPING
 
@@ -105,7 +112,13 @@ void WS2812FX::service() {
         }
         for (uint8_t c = 0; c < 3; c++) _colors_t[c] = gamma32(_colors_t[c]);
         handle_palette();
-        delay = (this->*_mode[SEGMENT.mode])(); //effect function
+        if (SEGMENT.mode < MODE_COUNT) {
+          Effect fx;
+          memcpy_P(&fx, &_effects[SEGMENT.mode], sizeof(fx));
+          delay = (this->*fx.fn)(); //effect function
+        } else {
+          delay = runUsermodEffect();
+        }
         if (SEGMENT.mode != FX_MODE_HALLOWEEN_EYES) SEGENV.call++;
       }
 
@@ -218,6 +231,37 @@ void WS2812FX::setPixelColor(uint16_t i, byte r, byte g, byte b, byte w)
 }
 
 
+extern byte gammaT[];
+
+/*
+ * Bulk version of setPixelColor() for realtime data (no segments), R,G,B(,W) packed with the given stride.
+ * Runs that need no reversing, remapping or white calculation are passed to the bus in one go.
+ */
+void WS2812FX::setRealtimePixels(uint16_t start, const uint8_t* data, uint16_t count, uint8_t stride, bool gamma)
+{
+  const uint8_t* lut = gamma ? gammaT : nullptr;
+  uint16_t skip = _skipFirstMode ? LED_SKIP_AMOUNT : 0;
+
+  #ifndef WLED_CUSTOM_LED_MAPPING
+  if (!reverseMode && !_useRgbw) {
+    bus->SetPixelsRaw(start + skip, data, count, stride, lut);
+    if (skip && start == 0) {
+      for (uint16_t j = 0; j < skip; j++) {
+        bus->SetPixelColor(j, RgbwColor(0, 0, 0, 0));
+      }
+    }
+    return;
+  }
+  #endif
+
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t w = (stride > 3) ? data[3] : 0;
+    if (lut) setPixelColor(start + i, lut[data[0]], lut[data[1]], lut[data[2]], lut[w]);
+    else     setPixelColor(start + i, data[0], data[1], data[2], w);
+    data += stride;
+  }
+}
+
 //DISCLAIMER
 //The following function attemps to calculate the current LED power usage,
 //and will limit the brightness to stay below a set amperage threshold.
@@ -331,7 +375,7 @@ void WS2812FX::trigger() {
 void WS2812FX::setMode(uint8_t segid, uint8_t m) {
   if (segid >= MAX_NUM_SEGMENTS) return;
    
-  if (m >= MODE_COUNT) m = MODE_COUNT - 1;
+  if (m >= getModeCount()) m = getModeCount() - 1;
 
   if (_segments[segid].mode != m) 
   {
@@ -342,7 +386,33 @@ void WS2812FX::setMode(uint8_t segid, uint8_t m) {
 
 uint8_t WS2812FX::getModeCount()
 {
-  return MODE_COUNT;
+  return MODE_COUNT + _usermodEffectCount;
+}
+
+uint8_t WS2812FX::addEffect(effect_function fn, const char* name, const char* uses, uint8_t palette, uint16_t dataLen)
+{
+  if (!fn || !name || _usermodEffectCount >= MAX_USERMOD_EFFECTS || getModeCount() >= 255) return 255;
+  UsermodEffect& fx = _usermodEffects[_usermodEffectCount];
+  fx.fn = fn;
+  fx.name = name;
+  fx.uses = uses ? uses : "";
+  fx.dataLen = dataLen;
+  fx.palette = palette;
+  return MODE_COUNT + _usermodEffectCount++;
+}
+
+const WS2812FX::UsermodEffect* WS2812FX::getUsermodEffect(uint8_t id)
+{
+  if (id < MODE_COUNT || id >= getModeCount()) return nullptr;
+  return &_usermodEffects[id - MODE_COUNT];
+}
+
+//SEGENV.data is allocated with the size the usermod declared, the effect can rely on it
+uint16_t WS2812FX::runUsermodEffect()
+{
+  UsermodEffect& fx = _usermodEffects[SEGMENT.mode - MODE_COUNT];
+  if (fx.dataLen && !SEGENV.allocateData(fx.dataLen)) return mode_static(); //allocation failed
+  return fx.fn(*this);
 }
 
 uint8_t WS2812FX::getPaletteCount()
@@ -411,6 +481,9 @@ void WS2812FX::setColor(uint8_t slot, uint32_t c) {
 }
 
 void WS2812FX::setBrightness(uint8_t b) {
+  #ifdef WLED_USE_ANALOG_LEDS
+  _analogBri = b; //PWM output applies its own high resolution gamma
+  #endif
   if (gammaCorrectBri) b = gamma8(b);
   if (_brightness == b) return;
   _brightness = b;
@@ -835,21 +908,9 @@ void WS2812FX::handle_palette(void)
   byte paletteIndex = SEGMENT.palette;
   if (paletteIndex == 0) //default palette. Differs depending on effect
   {
-    switch (SEGMENT.mode)
-    {
-      case FX_MODE_FIRE_2012  : paletteIndex = 35; break; //heat palette
-      case FX_MODE_COLORWAVES : paletteIndex = 26; break; //landscape 33
-      case FX_MODE_FILLNOISE8 : paletteIndex =  9; break; //ocean colors
-      case FX_MODE_NOISE16_1  : paletteIndex = 20; break; //Drywet
-      case FX_MODE_NOISE16_2  : paletteIndex = 43; break; //Blue cyan yellow
-      case FX_MODE_NOISE16_3  : paletteIndex = 35; break; //heat palette
-      case FX_MODE_NOISE16_4  : paletteIndex = 26; break; //landscape 33
-      case FX_MODE_GLITTER    : paletteIndex = 11; break; //rainbow colors
-      case FX_MODE_SUNRISE    : paletteIndex = 35; break; //heat palette
-      case FX_MODE_FLOW       : paletteIndex =  6; break; //party
-    }
+    if (SEGMENT.mode < MODE_COUNT) paletteIndex = pgm_read_byte(&_effects[SEGMENT.mode].palette); //see WLED_FX_LIST
+    else paletteIndex = _usermodEffects[SEGMENT.mode - MODE_COUNT].palette;
   }
-  if (SEGMENT.mode >= FX_MODE_METEOR && paletteIndex == 0) paletteIndex = 4;
   
   switch (paletteIndex)
   {
@@ -968,42 +1029,73 @@ bool WS2812FX::segmentsAreIdentical(Segment* a, Segment* b)
 }
 
 #ifdef WLED_USE_ANALOG_LEDS     
-void WS2812FX::setRgbwPwm(void) {
+/*
+ * Writes the color of pixel PWM_INDEX to the analog outputs.
+ * The pixel buffer holds colors without gamma in analog builds, gammaCol applies the 16 bit color gamma per channel here.
+ */
+void WS2812FX::setRgbwPwm(bool gammaCol) {
   uint32_t nowUp = millis(); // Be aware, millis() rolls over every 49 days
-  if (nowUp - _analogLastShow < MIN_SHOW_DELAY) return;
-
-  _analogLastShow = nowUp;
+  uint32_t sinceLast = nowUp - _analogLastShow;
+  if (sinceLast < MIN_SHOW_DELAY) return;
 
   RgbwColor c;
   uint32_t col = bus->GetPixelColorRgbw(PWM_INDEX);
   c.R = col >> 16; c.G = col >> 8; c.B = col; c.W = col >> 24;
 
-  byte b = getBrightness();
-  if (c == _analogLastColor && b == _analogLastBri) return;
-  
+  byte b = _analogBri;
+  if (c == _analogLastColor && b == _analogLastBri && gammaCol == _analogLastGammaCol) return;
+
+  //gamma is applied at 16 bit instead of through the 8 bit table, which collapses the lowest levels
+  if (!_pwmGammaT[255]) calcPwmGammaTable(2.8);
+  uint32_t bri16 = gammaCorrectBri ? _pwmGammaT[b] : b * 257;
+  uint16_t r16 = gammaCol ? _pwmGammaT[c.R] : c.R * 257;
+  uint16_t g16 = gammaCol ? _pwmGammaT[c.G] : c.G * 257;
+  uint16_t b16 = gammaCol ? _pwmGammaT[c.B] : c.B * 257;
+  uint16_t w16 = gammaCol ? _pwmGammaT[c.W] : c.W * 257;
+
+  //if values are changing continuously (transition or effect), let the hardware glide over most of the update interval.
+  //The fade has to end before the next update, a channel still fading is not written and the update is retried next loop
+  uint16_t fadeMs = (sinceLast < 100) ? (sinceLast * 3) >> 2 : 0;
+  bool written;
+
   // check color values for Warm / Cold white mix (for RGBW)  // EsplanexaDevice.cpp
   #ifdef WLED_USE_5CH_LEDS
     if        (c.R == 255 && c.G == 255 && c.B == 255 && c.W == 255) {  
-      bus->SetRgbwPwm(0, 0, 0,                  0, c.W * b / 255);
+      written = bus->SetRgbwPwm(0, 0, 0,                         0, pwmDuty(w16, bri16),     fadeMs);
     } else if (c.R == 127 && c.G == 127 && c.B == 127 && c.W == 255) {  
-      bus->SetRgbwPwm(0, 0, 0, c.W * b / 512, c.W * b / 255);
+      written = bus->SetRgbwPwm(0, 0, 0, pwmDuty(w16, bri16) >> 1, pwmDuty(w16, bri16),      fadeMs);
     } else if (c.R ==   0 && c.G ==   0 && c.B ==   0 && c.W == 255) {  
-      bus->SetRgbwPwm(0, 0, 0, c.W * b / 255,                  0);
+      written = bus->SetRgbwPwm(0, 0, 0, pwmDuty(w16, bri16),                              0, fadeMs);
     } else if (c.R == 130 && c.G ==  90 && c.B ==   0 && c.W == 255) {  
-      bus->SetRgbwPwm(0, 0, 0, c.W * b / 255, c.W * b / 512);
+      written = bus->SetRgbwPwm(0, 0, 0, pwmDuty(w16, bri16),      pwmDuty(w16, bri16) >> 1, fadeMs);
     } else if (c.R == 255 && c.G == 153 && c.B ==   0 && c.W == 255) {  
-      bus->SetRgbwPwm(0, 0, 0, c.W * b / 255,                  0);
+      written = bus->SetRgbwPwm(0, 0, 0, pwmDuty(w16, bri16),                              0, fadeMs);
     } else {  // not only white colors
-      bus->SetRgbwPwm(c.R * b / 255, c.G * b / 255, c.B * b / 255, c.W * b / 255);
+      written = bus->SetRgbwPwm(pwmDuty(r16, bri16), pwmDuty(g16, bri16), pwmDuty(b16, bri16), pwmDuty(w16, bri16), 0, fadeMs);
     }
   #else
-    bus->SetRgbwPwm(c.R * b / 255, c.G * b / 255, c.B * b / 255, c.W * b / 255);
+    written = bus->SetRgbwPwm(pwmDuty(r16, bri16), pwmDuty(g16, bri16), pwmDuty(b16, bri16), pwmDuty(w16, bri16), 0, fadeMs);
   #endif   
+  if (!written) return;
+  _analogLastShow = nowUp;
   _analogLastColor = c;
   _analogLastBri = b;
+  _analogLastGammaCol = gammaCol;
+}
+
+//scales a 16 bit channel by a 16 bit brightness to the full PWM resolution
+uint16_t WS2812FX::pwmDuty(uint16_t c16, uint32_t bri16) {
+  uint32_t v = ((uint32_t)c16 * bri16) / 65535;
+  return (v * WLED_PWM_MAX + 32767) / 65535;
+}
+
+void WS2812FX::calcPwmGammaTable(float gamma) {
+  for (uint16_t i = 0; i < 256; i++) {
+    _pwmGammaT[i] = (uint16_t)(pow((float)i / 255.0, gamma) * 65535 + 0.5);
+  }
 }
 #else
-void WS2812FX::setRgbwPwm() {}
+void WS2812FX::setRgbwPwm(bool gammaCol) {}
 #endif
 
 //gamma 2.8 lookup table used for color correction
@@ -1034,6 +1126,9 @@ void WS2812FX::calcGammaTable(float gamma)
   for (uint16_t i = 0; i < 256; i++) {
     gammaT[i] = gamma8_cal(i, gamma);
   }
+  #ifdef WLED_USE_ANALOG_LEDS
+  calcPwmGammaTable(gamma);
+  #endif
 }
 
 uint8_t WS2812FX::gamma8(uint8_t b)
@@ -1043,6 +1138,9 @@ uint8_t WS2812FX::gamma8(uint8_t b)
 
 uint32_t WS2812FX::gamma32(uint32_t color)
 {
+  #ifdef WLED_USE_ANALOG_LEDS
+  return color; //setRgbwPwm() applies color gamma at 16 bit
+  #endif
   if (!gammaCorrectCol) return color;
   uint8_t w = (color >> 24);
   uint8_t r = (color >> 16);
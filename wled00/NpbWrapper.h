@@ -11,6 +11,8 @@
 //#define USE_LPD8806 // Uncomment for using LPD8806
 //#define USE_TM1814  // Uncomment for using TM1814 LEDs (make sure you have NeoPixelBus v2.5.7 or newer)
 //#define USE_P9813   // Uncomment for using P9813 LEDs (make sure you have NeoPixelBus v2.5.8 or newer)
+//#define WLED_USE_HW_SPI     // APA102/WS2801: use the hardware SPI peripheral instead of bit-banging, clock fixed at compile time (SPI_CLOCK_KHZ)
+//#define WLED_USE_APA102_HDR // APA102: use the 5-bit global brightness field for extra dynamic range at low brightness
 //#define WLED_USE_ANALOG_LEDS //Uncomment for using "dumb" PWM controlled LEDs (see pins below, default R: gpio5, G: 12, B: 15, W: 13)
 //#define WLED_USE_H801 //H801 controller. Please uncomment #define WLED_USE_ANALOG_LEDS as well
 //#define WLED_USE_5CH_LEDS  //5 Channel H801 for cold and warm white
@@ -51,6 +53,12 @@
 //END CONFIGURATION
 
 #if defined(USE_APA102) || defined(USE_WS2801) || defined(USE_LPD8806) || defined(USE_P9813)
+ #if defined(WLED_USE_HW_SPI) && defined(ESP8266) && (defined(USE_APA102) || defined(USE_WS2801))
+  #undef CLKPIN   // ESP8266 hardware SPI (HSPI) is hard-wired to these pins
+  #undef DATAPIN
+  #define CLKPIN 14
+  #define DATAPIN 13
+ #endif
  #ifndef CLKPIN
   #define CLKPIN 0
  #endif
@@ -62,6 +70,39 @@
  #endif
 #endif
 
+#if defined(WLED_USE_HW_SPI) && (defined(USE_APA102) || defined(USE_WS2801))
+ #define WLED_SPI_HW_BUS
+ #ifndef SPI_CLOCK_KHZ
+  #ifdef USE_APA102
+   #define SPI_CLOCK_KHZ 10000 //APA102 is fine with 10-20 MHz on short wires
+  #else
+   #define SPI_CLOCK_KHZ 2000  //WS2801 is specified for 25 MHz but rarely works above a few MHz
+  #endif
+ #endif
+ //NeoPixelBus 2.6 only has fixed speed SPI methods without DMA, use the fastest one not above SPI_CLOCK_KHZ.
+ //The clock can not be changed at runtime.
+ #if SPI_CLOCK_KHZ >= 20000
+  #define PIXELMETHOD_SPI_APA102 DotStarSpi20MhzMethod
+  #define PIXELMETHOD_SPI_WS2801 NeoWs2801Spi20MhzMethod
+ #elif SPI_CLOCK_KHZ >= 10000
+  #define PIXELMETHOD_SPI_APA102 DotStarSpi10MhzMethod
+  #define PIXELMETHOD_SPI_WS2801 NeoWs2801Spi10MhzMethod
+ #elif SPI_CLOCK_KHZ >= 2000
+  #define PIXELMETHOD_SPI_APA102 DotStarSpi2MhzMethod
+  #define PIXELMETHOD_SPI_WS2801 NeoWs2801Spi2MhzMethod
+ #elif SPI_CLOCK_KHZ >= 1000
+  #define PIXELMETHOD_SPI_APA102 DotStarSpi1MhzMethod
+  #define PIXELMETHOD_SPI_WS2801 NeoWs2801Spi1MhzMethod
+ #else
+  #define PIXELMETHOD_SPI_APA102 DotStarSpi500KhzMethod
+  #define PIXELMETHOD_SPI_WS2801 NeoWs2801Spi500KhzMethod
+ #endif
+#endif
+
+#if defined(WLED_USE_APA102_HDR) && !defined(USE_APA102)
+ #undef WLED_USE_APA102_HDR
+#endif
+
 #ifdef WLED_USE_ANALOG_LEDS
   //PWM pins - PINs 15,13,12,14 (W2 = 04)are used with H801 Wifi LED Controller
   #ifdef WLED_USE_H801
@@ -112,12 +153,37 @@
   #endif
   #undef RLYPIN
   #define RLYPIN -1 //disable as pin 12 is used by analog LEDs
+
+  //PWM resolution and frequency. On ESP32, frequency * 2^bits must not exceed the 80MHz LEDC clock
+  //ESP8266 PWM is generated in software, analogWriteRange() takes up to 16 bit, 12 bit still leaves ~20 CPU cycles per step at 880Hz
+  #ifndef WLED_PWM_BITS
+    #ifdef ARDUINO_ARCH_ESP32
+      #define WLED_PWM_BITS 13
+    #else
+      #define WLED_PWM_BITS 12
+    #endif
+  #endif
+  #ifndef WLED_PWM_FREQ
+    #ifdef ARDUINO_ARCH_ESP32
+      #define WLED_PWM_FREQ 5000
+    #else
+      #define WLED_PWM_FREQ 880  //PWM frequency proven as good for LEDs
+    #endif
+  #endif
+  #define WLED_PWM_MAX ((1UL << WLED_PWM_BITS) - 1)
+  #ifdef ARDUINO_ARCH_ESP32
+    #include "driver/ledc.h"
+  #endif
 #endif
 
 //automatically uses the right driver method for each platform
 #ifdef ARDUINO_ARCH_ESP32
- #ifdef USE_APA102
+ #if defined(USE_APA102) && defined(WLED_SPI_HW_BUS)
+  #define PIXELMETHOD PIXELMETHOD_SPI_APA102
+ #elif defined(USE_APA102)
   #define PIXELMETHOD DotStarMethod
+ #elif defined(USE_WS2801) && defined(WLED_SPI_HW_BUS)
+  #define PIXELMETHOD PIXELMETHOD_SPI_WS2801
  #elif defined(USE_WS2801)
   #define PIXELMETHOD NeoWs2801Method
  #elif defined(USE_LPD8806)
@@ -131,8 +197,12 @@
  #endif
 #else //esp8266
  //autoselect the right method depending on strip pin
- #ifdef USE_APA102
+ #if defined(USE_APA102) && defined(WLED_SPI_HW_BUS)
+  #define PIXELMETHOD PIXELMETHOD_SPI_APA102
+ #elif defined(USE_APA102)
   #define PIXELMETHOD DotStarMethod
+ #elif defined(USE_WS2801) && defined(WLED_SPI_HW_BUS)
+  #define PIXELMETHOD PIXELMETHOD_SPI_WS2801
  #elif defined(USE_WS2801)
   #define PIXELMETHOD NeoWs2801Method
  #elif defined(USE_LPD8806)
@@ -153,7 +223,10 @@
 
 
 //you can now change the color order in the web settings
-#ifdef USE_APA102
+#if defined(USE_APA102) && defined(WLED_USE_APA102_HDR)
+ #define PIXELFEATURE3 DotStarLbgrFeature //luminance byte is driven by the HDR encoder
+ #define PIXELFEATURE4 DotStarLbgrFeature
+#elif defined(USE_APA102)
  #define PIXELFEATURE3 DotStarBgrFeature
  #define PIXELFEATURE4 DotStarLbgrFeature
 #elif defined(USE_LPD8806)
@@ -171,10 +244,12 @@
 #else
  #define PIXELFEATURE3 NeoGrbFeature
  #define PIXELFEATURE4 NeoGrbwFeature
+ #define PIXELFEATURE_NEO_GRB //buffer is plain G,R,B(,W) bytes, so realtime data can be written into it directly
 #endif
 
 
 #include <NeoPixelBrightnessBus.h>
+#include <new>
 #include "const.h"
 
 enum NeoPixelType
@@ -210,41 +285,76 @@ public:
     switch (_type)
     {
       case NeoPixelType_Grb:
+      #if defined(WLED_SPI_HW_BUS)
+        _pGrb = new NeoPixelBrightnessBus<PIXELFEATURE3,PIXELMETHOD>(countPixels);
+        #ifdef ARDUINO_ARCH_ESP32
+        _pGrb->Begin(CLKPIN, -1, DATAPIN, -1);
+        #else
+        _pGrb->Begin();
+        #endif
+      #else
       #if defined(USE_APA102) || defined(USE_WS2801) || defined(USE_LPD8806) || defined(USE_P9813)
         _pGrb = new NeoPixelBrightnessBus<PIXELFEATURE3,PIXELMETHOD>(countPixels, CLKPIN, DATAPIN);
       #else
         _pGrb = new NeoPixelBrightnessBus<PIXELFEATURE3,PIXELMETHOD>(countPixels, LEDPIN);
       #endif
         _pGrb->Begin();
+      #endif
       break;
 
       case NeoPixelType_Grbw:
+      #if defined(WLED_SPI_HW_BUS)
+        _pGrbw = new NeoPixelBrightnessBus<PIXELFEATURE4,PIXELMETHOD>(countPixels);
+        #ifdef ARDUINO_ARCH_ESP32
+        _pGrbw->Begin(CLKPIN, -1, DATAPIN, -1);
+        #else
+        _pGrbw->Begin();
+        #endif
+      #else
       #if defined(USE_APA102) || defined(USE_WS2801) || defined(USE_LPD8806) || defined(USE_P9813)
         _pGrbw = new NeoPixelBrightnessBus<PIXELFEATURE4,PIXELMETHOD>(countPixels, CLKPIN, DATAPIN);
       #else
         _pGrbw = new NeoPixelBrightnessBus<PIXELFEATURE4,PIXELMETHOD>(countPixels, LEDPIN);
       #endif
         _pGrbw->Begin();
+      #endif
       break;
     }
 
+    #ifdef WLED_USE_APA102_HDR
+      //brightness is folded into the 5-bit global field per pixel instead of scaling the 8-bit channels
+      switch (_type) {
+        case NeoPixelType_Grb:  _pGrb->SetBrightness(255);  break;
+        case NeoPixelType_Grbw: _pGrbw->SetBrightness(255); break;
+      }
+      //unscaled colors are kept and encoded once per Show(), so brightness changes (ABL) cost nothing until then
+      _hdrSrc = new (std::nothrow) RgbColor[countPixels];
+      _hdrCount = _hdrSrc ? countPixels : 0;
+      _hdrBri = 255;
+      _hdrDirty = false;
+    #endif
+
     #ifdef WLED_USE_ANALOG_LEDS 
+      for (uint8_t i = 0; i < 5; i++) _pwmDuty[i] = 0;
       #ifdef ARDUINO_ARCH_ESP32
-        ledcSetup(0, 5000, 8);
+        ledcSetup(0, WLED_PWM_FREQ, WLED_PWM_BITS);
         ledcAttachPin(RPIN, 0);
-        ledcSetup(1, 5000, 8);
+        ledcSetup(1, WLED_PWM_FREQ, WLED_PWM_BITS);
         ledcAttachPin(GPIN, 1);
-        ledcSetup(2, 5000, 8);        
+        ledcSetup(2, WLED_PWM_FREQ, WLED_PWM_BITS);        
         ledcAttachPin(BPIN, 2);
         if(_type == NeoPixelType_Grbw) 
         {
-          ledcSetup(3, 5000, 8);        
+          ledcSetup(3, WLED_PWM_FREQ, WLED_PWM_BITS);        
           ledcAttachPin(WPIN, 3);
           #ifdef WLED_USE_5CH_LEDS
-            ledcSetup(4, 5000, 8);        
+            ledcSetup(4, WLED_PWM_FREQ, WLED_PWM_BITS);        
             ledcAttachPin(W2PIN, 4);
           #endif
         }
+        //LEDC channels 0-7 are the high speed group; the fade ISR lets the hardware ramp duty between updates
+        static bool fadeInstalled = false;
+        if (!fadeInstalled) fadeInstalled = (ledc_fade_func_install(0) == ESP_OK);
       #else  // ESP8266
         //init PWM pins
         pinMode(RPIN, OUTPUT);
@@ -257,45 +367,71 @@ public:
             pinMode(W2PIN, OUTPUT);
           #endif
         }
-        analogWriteRange(255);  //same range as one RGB channel
-        analogWriteFreq(880);   //PWM frequency proven as good for LEDs
+        analogWriteRange(WLED_PWM_MAX);
+        analogWriteFreq(WLED_PWM_FREQ);
       #endif 
     #endif
   }
 
 #ifdef WLED_USE_ANALOG_LEDS      
-    void SetRgbwPwm(uint8_t r, uint8_t g, uint8_t b, uint8_t w, uint8_t w2=0)
+    /*
+     * Sets PWM duty (0 to WLED_PWM_MAX) of each analog channel. Channels are only written if their duty changed.
+     * On ESP32, a fadeMs > 0 lets the LEDC hardware ramp from the current to the new duty over that time.
+     * Returns false without writing anything while a changed channel is still fading, call again later.
+     */
+    bool SetRgbwPwm(uint16_t r, uint16_t g, uint16_t b, uint16_t w, uint16_t w2=0, uint16_t fadeMs=0)
     {
+      uint8_t channels = 3;
+      if (_type == NeoPixelType_Grbw) {
+        #ifdef WLED_USE_5CH_LEDS
+          channels = 5;
+        #else
+          channels = 4;
+        #endif
+      }
+      uint16_t duty[5] = {r, g, b, w, w2};
+      #ifndef ARDUINO_ARCH_ESP32
+      const uint8_t pins[5] = {RPIN, GPIN, BPIN, WPIN,
+        #ifdef W2PIN
+          W2PIN
+        #else
+          0
+        #endif
+      };
+      #endif
       #ifdef ARDUINO_ARCH_ESP32
-        ledcWrite(0, r);
-        ledcWrite(1, g);
-        ledcWrite(2, b);
-        switch (_type) {
-          case NeoPixelType_Grb:                                                  break;
-          #ifdef WLED_USE_5CH_LEDS
-            case NeoPixelType_Grbw: ledcWrite(3, w); ledcWrite(4, w2);            break;
-          #else
-            case NeoPixelType_Grbw: ledcWrite(3, w);                              break;
-          #endif
-        }        
-      #else   // ESP8266
-        analogWrite(RPIN, r);
-        analogWrite(GPIN, g);
-        analogWrite(BPIN, b);
-        switch (_type) {
-          case NeoPixelType_Grb:                                                  break;
-          #ifdef WLED_USE_5CH_LEDS
-            case NeoPixelType_Grbw: analogWrite(WPIN, w); analogWrite(W2PIN, w2); break;
-          #else
-            case NeoPixelType_Grbw: analogWrite(WPIN, w);                         break;
-          #endif
-        }
-      #endif 
+      //both LEDC calls below block until a fade still running on the channel ends, so do not call them before
+      unsigned long now = millis();
+      for (uint8_t i = 0; i < channels; i++) {
+        uint16_t d = (duty[i] > WLED_PWM_MAX) ? WLED_PWM_MAX : duty[i];
+        if (d != _pwmDuty[i] && (long)(now - _pwmFadeEnd[i]) < 0) return false;
+      }
+      #endif
+      for (uint8_t i = 0; i < channels; i++) {
+        if (duty[i] > WLED_PWM_MAX) duty[i] = WLED_PWM_MAX;
+        if (duty[i] == _pwmDuty[i]) continue;
+        _pwmDuty[i] = duty[i];
+        #ifdef ARDUINO_ARCH_ESP32
+          //never mix these with ledcWrite(), which races the fade ISR
+          if (fadeMs) {
+            ledc_set_fade_time_and_start(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)i, duty[i], fadeMs, LEDC_FADE_NO_WAIT);
+            _pwmFadeEnd[i] = now + fadeMs +1;
+          } else {
+            ledc_set_duty_and_update(LEDC_HIGH_SPEED_MODE, (ledc_channel_t)i, duty[i], 0);
+          }
+        #else   // ESP8266
+          analogWrite(pins[i], duty[i]);
+        #endif
+      }
+      return true;
     }
 #endif
 
   void Show()
   {
+    #ifdef WLED_USE_APA102_HDR
+    if (_hdrDirty) encodeHdrPixels();
+    #endif
     switch (_type)
     {
       case NeoPixelType_Grb:  _pGrb->Show();  break;
@@ -340,9 +476,23 @@ public:
     }
     col.W = c.W;
 
+    #ifdef WLED_USE_APA102_HDR
+    if (indexPixel < _hdrCount) { //encoded in Show()
+      _hdrSrc[indexPixel] = RgbColor(col.R, col.G, col.B);
+      _hdrDirty = true;
+      return;
+    }
+    if (_hdrSrc) return;
+    col = encodeHdr(col, _hdrBri); //no memory for the unscaled colors, encode right away
+    #endif
+
     switch (_type) {
       case NeoPixelType_Grb: {
+        #ifdef WLED_USE_APA102_HDR
+        _pGrb->SetPixelColor(indexPixel, col);
+        #else
         _pGrb->SetPixelColor(indexPixel, RgbColor(col.R,col.G,col.B));
+        #endif
       }
       break;
       case NeoPixelType_Grbw: {
@@ -356,12 +506,64 @@ public:
     } 
   }
 
+  /*
+   * Sets count consecutive pixels from packed R,G,B(,W) data (stride 3 or 4), optionally through a lookup table.
+   * For plain GRB(W) buses at full bus brightness the bytes are written straight into the pixel buffer.
+   */
+  void SetPixelsRaw(uint16_t indexPixel, const uint8_t* data, uint16_t count, uint8_t stride, const uint8_t* lut = nullptr)
+  {
+    #if defined(PIXELFEATURE_NEO_GRB) && !defined(COLOR_ORDER_OVERRIDE)
+    uint8_t* buf = nullptr;
+    uint8_t bpp = 3;
+    uint16_t len = 0;
+    switch (_type) {
+      case NeoPixelType_Grb:  if (_pGrb->GetBrightness()  == 255) { buf = _pGrb->Pixels();  len = _pGrb->PixelCount(); } break;
+      case NeoPixelType_Grbw: if (_pGrbw->GetBrightness() == 255) { buf = _pGrbw->Pixels(); len = _pGrbw->PixelCount(); bpp = 4; } break;
+    }
+    if (buf) {
+      if (indexPixel >= len) return;
+      if (count > len - indexPixel) count = len - indexPixel;
+      //source channel (0 = R, 1 = G, 2 = B) of each byte in the buffer, per color order. Same mapping as SetPixelColor()
+      static const uint8_t wireOrder[6][3] = {{1,0,2}, {0,1,2}, {2,0,1}, {0,2,1}, {2,1,0}, {1,2,0}};
+      const uint8_t* o = wireOrder[(_colorOrder < 5) ? _colorOrder : 5];
+      buf += indexPixel * bpp;
+      for (uint16_t i = 0; i < count; i++) {
+        if (lut) {
+          buf[0] = lut[data[o[0]]]; buf[1] = lut[data[o[1]]]; buf[2] = lut[data[o[2]]];
+          if (bpp > 3) buf[3] = (stride > 3) ? lut[data[3]] : 0;
+        } else {
+          buf[0] = data[o[0]]; buf[1] = data[o[1]]; buf[2] = data[o[2]];
+          if (bpp > 3) buf[3] = (stride > 3) ? data[3] : 0;
+        }
+        buf += bpp; data += stride;
+      }
+      switch (_type) {
+        case NeoPixelType_Grb:  _pGrb->Dirty();  break;
+        case NeoPixelType_Grbw: _pGrbw->Dirty(); break;
+      }
+      return;
+    }
+    #endif
+    for (uint16_t i = 0; i < count; i++) {
+      RgbwColor c(data[0], data[1], data[2], (stride > 3) ? data[3] : 0);
+      if (lut) { c.R = lut[c.R]; c.G = lut[c.G]; c.B = lut[c.B]; c.W = lut[c.W]; }
+      SetPixelColor(indexPixel + i, c);
+      data += stride;
+    }
+  }
+
   void SetBrightness(byte b)
   {
+    #ifdef WLED_USE_APA102_HDR
+    if (b == _hdrBri) return;
+    _hdrBri = b;
+    _hdrDirty = true;
+    #else
     switch (_type) {
       case NeoPixelType_Grb: _pGrb->SetBrightness(b);   break;
       case NeoPixelType_Grbw:_pGrbw->SetBrightness(b);  break;
     }
+    #endif
   }
 
   void SetColorOrder(byte colorOrder) {
@@ -374,22 +576,23 @@ public:
 
   RgbwColor GetPixelColorRaw(uint16_t indexPixel) const
   {
+    #ifdef WLED_USE_APA102_HDR
+    if (indexPixel >= _hdrCount) return 0;
+    return RgbwColor(_hdrSrc[indexPixel].R, _hdrSrc[indexPixel].G, _hdrSrc[indexPixel].B, 0);
+    #else
     switch (_type) {
       case NeoPixelType_Grb:  return _pGrb->GetPixelColor(indexPixel);  break;
       case NeoPixelType_Grbw: return _pGrbw->GetPixelColor(indexPixel); break;
     }
     return 0;
+    #endif
   }
 
   // NOTE:  Due to feature differences, some support RGBW but the method name
   // here needs to be unique, thus GetPixeColorRgbw
   uint32_t GetPixelColorRgbw(uint16_t indexPixel) const
   {
-    RgbwColor col(0,0,0,0);
-    switch (_type) {
-      case NeoPixelType_Grb:  col = _pGrb->GetPixelColor(indexPixel);  break;
-      case NeoPixelType_Grbw: col = _pGrbw->GetPixelColor(indexPixel); break;
-    }
+    RgbwColor col = GetPixelColorRaw(indexPixel);
 
     uint8_t co = _colorOrder;
     #ifdef COLOR_ORDER_OVERRIDE
@@ -428,12 +631,58 @@ private:
 
   byte _colorOrder = 0;
 
+  #ifdef WLED_USE_ANALOG_LEDS
+  uint16_t _pwmDuty[5] = {0};
+  #ifdef ARDUINO_ARCH_ESP32
+  unsigned long _pwmFadeEnd[5] = {0}; //millis() when the last fade started on the channel has ended
+  #endif
+  #endif
+
+  #ifdef WLED_USE_APA102_HDR
+  byte _hdrBri = 255;
+  bool _hdrDirty = false; //colors or brightness changed since the bus buffer was encoded
+  RgbColor* _hdrSrc = nullptr;
+  uint16_t _hdrCount = 0;
+
+  //encodes the unscaled colors into the bus buffer, from the source so repeated brightness changes do not drift
+  void encodeHdrPixels()
+  {
+    for (uint16_t i = 0; i < _hdrCount; i++) {
+      RgbwColor col = encodeHdr(RgbwColor(_hdrSrc[i].R, _hdrSrc[i].G, _hdrSrc[i].B, 0), _hdrBri);
+      switch (_type) {
+        case NeoPixelType_Grb:  _pGrb->SetPixelColor(i, col);  break;
+        case NeoPixelType_Grbw: _pGrbw->SetPixelColor(i, col); break;
+      }
+    }
+    _hdrDirty = false;
+  }
+
+  /*
+   * Encodes an 8-bit color at brightness bri into 8-bit channels plus the APA102 5-bit global field (in W).
+   * The smallest global level that still fits the brightest channel is chosen, so dim colors keep
+   * (up to 5 bits) more resolution than scaling the 8-bit channels alone. White has no APA102 channel.
+   */
+  static RgbwColor encodeHdr(RgbwColor c, byte bri)
+  {
+    uint32_t r = c.R * bri, g = c.G * bri, b = c.B * bri; //0-65025
+    uint32_t m = r; if (g > m) m = g; if (b > m) m = b;
+    if (m == 0) return RgbwColor(0,0,0,0);
+    uint32_t l = (m * 31 + 65024) / 65025; //1-31
+    uint32_t div = l * 255, half = div >> 1;
+    r = (r * 31 + half) / div; g = (g * 31 + half) / div; b = (b * 31 + half) / div;
+    return RgbwColor(r > 255 ? 255 : r, g > 255 ? 255 : g, b > 255 ? 255 : b, l);
+  }
+  #endif
+
   void cleanup()
   {
     switch (_type) {
       case NeoPixelType_Grb:  delete _pGrb ; _pGrb  = NULL; break;
       case NeoPixelType_Grbw: delete _pGrbw; _pGrbw = NULL; break;
     }
+    #ifdef WLED_USE_APA102_HDR
+    delete[] _hdrSrc; _hdrSrc = nullptr; _hdrCount = 0;
+    #endif
   }
 };
 #endif
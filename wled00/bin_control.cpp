@@ -0,0 +1,88 @@
+#include "wled.h"
+#include "bin_control.h"
+
+/*
+ * Binary control messages (see bin_control.h), the counterpart of deserializeState() for the fields they carry
+ */
+
+static bool applyBinControlSegment(const BinControlSegment& s)
+{
+  if (s.id >= strip.getMaxSegments()) return false;
+  WS2812FX::Segment& seg = strip.getSegment(s.id);
+  if (!seg.isActive()) return false;
+  bool main = (s.id == strip.getMainSegmentId());
+
+  if (s.mask & BIN_SEG_BRI) {
+    if (s.bri) seg.setOpacity(s.bri, s.id);
+    seg.setOption(SEG_OPTION_ON, s.bri > 0, s.id);
+  }
+  if (s.mask & BIN_SEG_ON) seg.setOption(SEG_OPTION_ON, s.on, s.id);
+
+  for (byte i = 0; i < 3; i++) {
+    if (!(s.mask & (BIN_SEG_COL0 << i))) continue;
+    const uint8_t* c = s.col[i];
+    if (main && i < 2) { //temporary, to make transition work on main segment
+      byte* dest = i ? colSec : col;
+      dest[0] = c[0]; dest[1] = c[1]; dest[2] = c[2]; dest[3] = c[3];
+    } else {
+      seg.setColor(i, ((uint32_t)c[3] << 24) | ((uint32_t)c[0] << 16) | ((uint32_t)c[1] << 8) | c[2], s.id);
+      if (seg.mode == FX_MODE_STATIC) strip.trigger(); //instant refresh
+    }
+  }
+
+  //effects and palettes out of range are ignored, like in UDP notifications
+  bool fx  = (s.mask & BIN_SEG_FX)  && s.fx  < strip.getModeCount();
+  bool pal = (s.mask & BIN_SEG_PAL) && s.pal < strip.getPaletteCount();
+  if (main) { //strip object gets updated via colorUpdated()
+    if (fx)                   effectCurrent   = s.fx;
+    if (s.mask & BIN_SEG_SX)  effectSpeed     = s.sx;
+    if (s.mask & BIN_SEG_IX)  effectIntensity = s.ix;
+    if (pal)                  effectPalette   = s.pal;
+  } else {
+    if (fx && s.fx != seg.mode) strip.setMode(s.id, s.fx);
+    if (s.mask & BIN_SEG_SX)  seg.speed     = s.sx;
+    if (s.mask & BIN_SEG_IX)  seg.intensity = s.ix;
+    if (pal)                  seg.palette   = s.pal;
+  }
+  return true;
+}
+
+//applies a binary control message, returns the length of the acknowledgement written to ack (0 if none was requested)
+size_t handleBinaryControl(const uint8_t* data, size_t len, uint8_t* ack)
+{
+  BinControlMessage msg;
+  uint8_t status = decodeBinControl(data, len, msg);
+
+  if (status == BIN_CONTROL_OK) {
+    const BinControlHeader& h = msg.header;
+    strip.applyToAllSelected = false;
+
+    if (h.mask & BIN_CONTROL_BRI) bri = h.bri;
+    if (h.mask & BIN_CONTROL_ON) {
+      if (!h.on != !bri) toggleOnOff();
+    }
+    if (h.mask & BIN_CONTROL_TT) {
+      transitionDelayTemp = h.tt * 100;
+      jsonTransitionOnce = true;
+    }
+    strip.setTransition(transitionDelayTemp);
+
+    for (uint16_t i = 0; i < msg.segs; i++) {
+      BinControlSegment s;
+      msg.segment(i, s);
+      if (!applyBinControlSegment(s)) status = BIN_CONTROL_ERR_SEGMENT;
+    }
+    colorUpdated((h.flags & BIN_CONTROL_FLAG_NO_NOTIFY) ? NOTIFIER_CALL_MODE_NO_NOTIFY : NOTIFIER_CALL_MODE_DIRECT_CHANGE);
+  }
+
+  if (len < 4 || !(data[3] & BIN_CONTROL_FLAG_ACK)) return 0;
+  BinControlAck a = {};
+  a.type = BIN_CONTROL_TYPE;
+  a.version = BIN_CONTROL_VERSION;
+  a.seq = data[2];
+  a.flags = BIN_CONTROL_FLAG_REPLY;
+  a.status = status;
+  a.revision = stateRevision;
+  memcpy(ack, &a, sizeof(a));
+  return sizeof(a);
+}
@@ -0,0 +1,122 @@
+#ifndef WLED_BIN_CONTROL_H
+#define WLED_BIN_CONTROL_H
+
+/*
+ * Compact binary control messages, accepted over UDP (notifier port) and as binary WebSocket messages.
+ * Covers the state a slider or remote changes most often (on, brightness, colors, effect, speed, intensity, palette)
+ * in a fixed little endian layout, so it is applied with a few field reads instead of parsing JSON.
+ * Independent of Arduino, so the layout can be checked on a host.
+ *
+ * Message: BinControlHeader followed by any number of BinControlSegment records.
+ * Fields are only applied if their bit is set in the mask of the header or the record.
+ * If BIN_CONTROL_FLAG_ACK is set, a BinControlAck is sent back with the same sequence number.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define BIN_CONTROL_TYPE    0xB0  //first byte, distinct from the WLED notifier, realtime, TPM2 and JSON/HTTP API packets
+#define BIN_CONTROL_VERSION 1
+
+//header flags
+#define BIN_CONTROL_FLAG_ACK       0x01  //request an acknowledgement
+#define BIN_CONTROL_FLAG_NO_NOTIFY 0x02  //do not send a UDP notification for this change
+#define BIN_CONTROL_FLAG_REPLY     0x80  //set in acknowledgements
+
+//header mask
+#define BIN_CONTROL_ON  0x01
+#define BIN_CONTROL_BRI 0x02
+#define BIN_CONTROL_TT  0x04  //transition for this change only, in 100ms
+
+//segment mask
+#define BIN_SEG_ON   0x0001
+#define BIN_SEG_BRI  0x0002
+#define BIN_SEG_COL0 0x0004
+#define BIN_SEG_COL1 0x0008
+#define BIN_SEG_COL2 0x0010
+#define BIN_SEG_FX   0x0020
+#define BIN_SEG_SX   0x0040
+#define BIN_SEG_IX   0x0080
+#define BIN_SEG_PAL  0x0100
+
+//acknowledgement status
+#define BIN_CONTROL_OK          0
+#define BIN_CONTROL_ERR_VERSION 1  //unsupported version, nothing applied
+#define BIN_CONTROL_ERR_LENGTH  2  //not a header plus whole segment records, nothing applied
+#define BIN_CONTROL_ERR_SEGMENT 3  //a record referenced a segment that does not exist, the others were applied
+
+struct __attribute__((packed)) BinControlHeader {
+  uint8_t type;     //BIN_CONTROL_TYPE
+  uint8_t version;  //BIN_CONTROL_VERSION
+  uint8_t seq;      //echoed in the acknowledgement
+  uint8_t flags;
+  uint8_t mask;
+  uint8_t on;
+  uint8_t bri;
+  uint8_t tt;
+};
+
+struct __attribute__((packed)) BinControlSegment {
+  uint8_t id;
+  uint8_t on;
+  uint16_t mask;
+  uint8_t bri;
+  uint8_t fx;
+  uint8_t sx;
+  uint8_t ix;
+  uint8_t pal;
+  uint8_t reserved[3];
+  uint8_t col[3][4]; //RGBW
+};
+
+struct __attribute__((packed)) BinControlAck {
+  uint8_t type;
+  uint8_t version;
+  uint8_t seq;
+  uint8_t flags;     //BIN_CONTROL_FLAG_REPLY
+  uint8_t status;
+  uint8_t reserved[3];
+  uint32_t revision; //state revision after applying, as sent in WebSocket state messages
+};
+
+static_assert(sizeof(BinControlHeader) == 8, "binary control header layout");
+static_assert(sizeof(BinControlSegment) == 24, "binary control segment layout");
+static_assert(sizeof(BinControlAck) == 12, "binary control ack layout");
+
+//returns BIN_CONTROL_OK if the message is well formed, the number of segment records is written to segs
+inline uint8_t checkBinControl(const uint8_t* data, size_t len, uint16_t* segs)
+{
+  *segs = 0;
+  if (len < sizeof(BinControlHeader)) return BIN_CONTROL_ERR_LENGTH;
+  if (data[1] != BIN_CONTROL_VERSION) return BIN_CONTROL_ERR_VERSION;
+  len -= sizeof(BinControlHeader);
+  if (len % sizeof(BinControlSegment)) return BIN_CONTROL_ERR_LENGTH;
+  *segs = len / sizeof(BinControlSegment);
+  return BIN_CONTROL_OK;
+}
+
+//a message accepted by decodeBinControl(), pointing into the received data
+struct BinControlMessage {
+  BinControlHeader header;
+  uint16_t segs;            //number of segment records
+  const uint8_t* records;
+
+  //copies record i out, records are not aligned
+  void segment(uint16_t i, BinControlSegment& s) const
+  {
+    memcpy(&s, records + (size_t)i * sizeof(BinControlSegment), sizeof(s));
+  }
+};
+
+//checks the message and reads its header, returns BIN_CONTROL_OK if msg can be applied
+inline uint8_t decodeBinControl(const uint8_t* data, size_t len, BinControlMessage& msg)
+{
+  uint8_t status = checkBinControl(data, len, &msg.segs);
+  if (status != BIN_CONTROL_OK) return status;
+  memcpy(&msg.header, data, sizeof(msg.header));
+  msg.records = data + sizeof(BinControlHeader);
+  return BIN_CONTROL_OK;
+}
+
+#endif
@@ -206,6 +206,12 @@ void deserializeConfig() {
   CJSON(arlsForceMaxBri, if_live[F("maxbri")]);
   CJSON(arlsDisableGammaCorrection, if_live[F("no-gc")]); // false
   CJSON(arlsOffset, if_live[F("offset")]); // 0
+  CJSON(realtimeBufferFrames, if_live[F("buf")]); // 0
+  if (realtimeBufferFrames > 4) realtimeBufferFrames = 4;
+  if (realtimeBufferFrames == 1) realtimeBufferFrames = 2;
+  CJSON(realtimeInterpolate, if_live[F("interp")]); // false
+  CJSON(serialBaud, if_live[F("baud")]); // 115200
+  if (serialBaud < 9600 || serialBaud > 3000000) serialBaud = 115200;
 
   CJSON(alexaEnabled, interfaces[F("va")][F("alexa")]); // false
 
@@ -537,6 +543,9 @@ void serializeConfig() {
   if_live[F("maxbri")] = arlsForceMaxBri;
   if_live[F("no-gc")] = arlsDisableGammaCorrection;
   if_live[F("offset")] = arlsOffset;
+  if_live[F("buf")] = realtimeBufferFrames;
+  if_live[F("interp")] = realtimeInterpolate;
+  if_live[F("baud")] = serialBaud;
 
   JsonObject if_va = interfaces.createNestedObject("va");
   if_va[F("alexa")] = alexaEnabled;
@@ -61,6 +61,7 @@
 #define REALTIME_MODE_ARTNET      6
 #define REALTIME_MODE_TPM2NET     7
 #define REALTIME_MODE_DDP         8
+#define REALTIME_MODE_WEBSOCKET   9
 
 //realtime override modes
 #define REALTIME_OVERRIDE_NONE    0
@@ -173,10 +174,28 @@
 
 #define MAX_LEDS_DMA 500
 
+// liveview resolution, JSON is limited to this, binary liveview clients may ask for more
+#define MAX_LIVE_LEDS 180
+
 // string temp buffer (now stored in stack locally)
 #define OMAX 2048
 
-#define E131_MAX_UNIVERSE_COUNT 9
+#define ASSET_ETAG_SLOTS 16 //static assets whose content hash is cached
+
+#define E131_FRAME_TIMEOUT 50       //ms, an E1.31/Art-Net frame missing universes is shown after this time
+#define E131_SYNC_TIMEOUT 4000      //ms, frames wait for sync packets while the source has sent one in this time
+#define ARTNET_POLL_REPLY_INTERVAL 1000 //ms, ArtPolls from the same console arriving faster than this are not answered again
+#define DDP_TIMECODE_FRAMES 4       //timecoded DDP frames queued in the realtime ring until they are due
+#define RTBUF_MAX_RING 5            //ring slots for the deepest queue (4 frames and the one being received)
+
+// UART receive buffer for Adalight/TPM2, holds about 5 ms of data at 3 Mbaud
+#ifndef WLED_SERIAL_RX_BUFFER_SIZE
+  #ifdef ESP8266
+    #define WLED_SERIAL_RX_BUFFER_SIZE 1024
+  #else
+    #define WLED_SERIAL_RX_BUFFER_SIZE 2048
+  #endif
+#endif
 
 #define ABL_MILLIAMPS_DEFAULT 850; // auto lower brightness to stay close to milliampere limit
 
@@ -190,4 +209,34 @@
   #define JSON_BUFFER_SIZE 16384
 #endif
 
+// Buffers of the incremental state parser, the "seg" array and its "i" entries are applied piece by piece
+#define JSON_PARSER_DEPTH 10
+#define JSON_PARSER_PIX_SIZE 48
+#define JSON_PARSER_SEG_SIZE 512
+#ifdef ESP8266
+  #define JSON_PARSER_REST_SIZE 1024
+  #define JSON_PARSER_DOC_SIZE 1024
+#else
+  #define JSON_PARSER_REST_SIZE 2048
+  #define JSON_PARSER_DOC_SIZE 2048
+#endif
+
+// Web requests holding a JSON document or parser at the same time, the last slot is kept for state changes (POST)
+// further requests, or any while the free heap is below the minimum, are answered with 503 and Retry-After
+#ifdef ESP8266
+  #define WEB_MAX_HEAVY_REQUESTS 2
+  #define WEB_HEAVY_MIN_HEAP 8192
+#else
+  #define WEB_MAX_HEAVY_REQUESTS 4
+  #define WEB_HEAVY_MIN_HEAP 16384
+#endif
+#define WEB_RETRY_AFTER "1" //seconds
+
+// Size of the per section documents when streaming /json, bounded by the info object
+#ifdef ESP8266
+  #define JSON_STREAM_DOC_SIZE 2048
+#else
+  #define JSON_STREAM_DOC_SIZE 3072
+#endif
+
 #endif
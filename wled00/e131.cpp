@@ -8,51 +8,418 @@
  * E1.31 handler
  */
 
-//DDP protocol support, called by handleE131Packet
-//handles RGB data only
-void handleDDPPacket(e131_packet_t* p) {
-  int lastPushSeq = e131LastSequenceNumber[0];
-  
-  //reject late packets belonging to previous frame (assuming 4 packets max. before push)
-  if (e131SkipOutOfSequence && lastPushSeq) {
-    int sn = p->sequenceNum & 0xF;
-    if (sn) {
-      if (lastPushSeq > 5) {
-        if (sn > (lastPushSeq -5) && sn < lastPushSeq) return;
-      } else {
-        if (sn > (10 + lastPushSeq) || sn < lastPushSeq) return;
-      }
+//E1.31/Art-Net frame assembly
+//pixels of each universe go to a staging slot as they arrive. The frame is handed to the strip once all expected universes
+//are in, when a sync packet arrives, or when E131_FRAME_TIMEOUT passes. This avoids tearing across universes
+//there are two slots, the one being assembled and the last complete frame, which the main loop copies to the strip
+//DDP frames take the same path, each push hands over a frame
+
+#ifdef ARDUINO_ARCH_ESP32
+static SemaphoreHandle_t e131Mutex = nullptr;
+#endif
+
+//packets are handled in the AsyncUDP task on ESP32, so frame state shared with the main loop is only touched holding this lock
+void e131Lock() {
+  #ifdef ARDUINO_ARCH_ESP32
+  if (!e131Mutex) e131Mutex = xSemaphoreCreateMutex(); //first taken by the main loop, before e131.begin()
+  xSemaphoreTake(e131Mutex, portMAX_DELAY);
+  #endif
+}
+
+void e131Unlock() {
+  #ifdef ARDUINO_ARCH_ESP32
+  xSemaphoreGive(e131Mutex);
+  #endif
+}
+
+static byte* e131StagingSlot(byte slot) {
+  return e131Staging + (uint32_t)slot * e131StagingLeds * e131StagingBpp;
+}
+
+//bytes per LED to stage for the current DMX mode, 0 for modes that do not carry pixels
+static byte e131PixelBytes() {
+  switch (DMXMode) {
+    case DMX_MODE_MULTIPLE_RGB:
+    case DMX_MODE_MULTIPLE_DRGB: return 3;
+    case DMX_MODE_SINGLE_RGB:
+    case DMX_MODE_SINGLE_DRGB:
+    case DMX_MODE_MULTIPLE_RGBW: return 4;
+  }
+  return 0;
+}
+
+//(re)allocates the staging slots if the LED count or pixel format changed
+static void initE131Staging() {
+  byte bpp = e131PixelBytes();
+  if (!bpp && realtimeMode == REALTIME_MODE_DDP) bpp = 4; //DDP is received in every DMX mode
+  if (bpp == e131StagingBpp && ledCount == e131StagingLeds) return;
+  byte* fresh = bpp ? (byte*)calloc((uint32_t)2 * ledCount, bpp) : nullptr;
+  if (bpp && !fresh) DEBUG_PRINTLN(F("E1.31 staging allocation failed, writing universes to the strip directly."));
+  e131Lock();
+  byte* old = e131Staging;
+  e131Staging = fresh;
+  e131StagingLeds = ledCount;
+  e131StagingBpp = bpp;
+  e131AssembleSlot = 0;
+  e131FrameReady = false;
+  e131Unlock();
+  free(old);
+}
+
+//writes pixels of a received universe to the frame being assembled
+static void e131SetPixels(uint16_t start, const byte* data, uint16_t count, byte stride) {
+  if (!e131Staging) { //no memory for staging, fall back to the strip buffer
+    setRealtimePixels(start, data, count, stride);
+    return;
+  }
+  if (start >= e131StagingLeds) return;
+  if (count > e131StagingLeds - start) count = e131StagingLeds - start;
+  byte bpp = e131StagingBpp;
+  byte* p = e131StagingSlot(e131AssembleSlot) + (uint32_t)start * bpp;
+  if (stride == bpp) {
+    memcpy(p, data, (uint32_t)count * bpp);
+    return;
+  }
+  for (uint16_t i = 0; i < count; i++) {
+    p[0] = data[0]; p[1] = data[1]; p[2] = data[2];
+    if (bpp > 3) p[3] = (stride > 3) ? data[3] : 0;
+    p += bpp; data += stride;
+  }
+}
+
+//number of universes that make up one frame in the current DMX mode
+uint8_t e131UniversesPerFrame() {
+  if (DMXMode < DMX_MODE_MULTIPLE_RGB) return 1;
+  const uint16_t dmxChannelsPerLed = (DMXMode == DMX_MODE_MULTIPLE_RGBW) ? 4 : 3;
+  const uint16_t ledsPerUniverse = (DMXMode == DMX_MODE_MULTIPLE_RGBW) ? MAX_4_CH_LEDS_PER_UNIVERSE : MAX_3_CH_LEDS_PER_UNIVERSE;
+  uint16_t ledsInFirstUniverse = (MAX_CHANNELS_PER_UNIVERSE - DMXAddress) / dmxChannelsPerLed;
+  if (ledCount <= ledsInFirstUniverse) return 1;
+  uint16_t universes = 1 + (ledCount - ledsInFirstUniverse + ledsPerUniverse -1) / ledsPerUniverse;
+  return (universes > 255) ? 255 : universes;
+}
+
+//settings initE131Universes() was last run for
+static uint16_t e131CfgLeds = 0, e131CfgUniverse = 0, e131CfgAddress = 0, e131CfgProxy = 0;
+static byte e131CfgMode = 0;
+
+static bool e131ConfigChanged() {
+  #ifdef WLED_ENABLE_DMX
+  if (e131CfgProxy != e131ProxyUniverse) return true;
+  #endif
+  return e131CfgLeds != ledCount || e131CfgUniverse != e131Universe || e131CfgAddress != DMXAddress || e131CfgMode != DMXMode;
+}
+
+//(re)allocates per-universe tracking for the current LED count and DMX mode
+//and limits reception (multicast groups and the packet filter) to these universes
+void initE131Universes() {
+  e131CfgLeds = ledCount; e131CfgUniverse = e131Universe; e131CfgAddress = DMXAddress; e131CfgMode = DMXMode;
+  initE131Staging();
+  uint8_t needed = e131UniversesPerFrame();
+  #ifdef WLED_ENABLE_DMX
+  e131CfgProxy = e131ProxyUniverse;
+  e131.setUniverses(e131Universe, needed, e131ProxyUniverse);
+  #else
+  e131.setUniverses(e131Universe, needed);
+  #endif
+  if (needed == e131UniverseCount && e131UniverseStats) return;
+  E131UniverseStats* stats = new E131UniverseStats[needed]();
+  //packet handling only uses the table holding the lock, so the old one is free once it has been swapped out
+  e131Lock();
+  E131UniverseStats* old = e131UniverseStats;
+  e131UniverseStats = stats;
+  e131UniverseCount = stats ? needed : 0; //universes are ignored if allocation failed
+  e131FrameUniverses = 0;
+  e131Unlock();
+  delete[] old;
+  DEBUG_PRINT(F("E1.31 universes: "));
+  DEBUG_PRINTLN(e131UniverseCount);
+}
+
+void e131ResetFrame() {
+  e131FrameNumber++;
+  if (!e131FrameNumber) { //0 marks universes never received
+    e131FrameNumber = 1;
+    //after wrapping, a universe last seen 255 frames ago would look like it was received for this frame already
+    for (uint8_t i = 0; i < e131UniverseCount; i++) e131UniverseStats[i].frame = 0;
+  }
+  e131FrameUniverses = 0;
+}
+
+bool e131SyncActive() {
+  return e131SyncLastSeen && millis() - e131SyncLastSeen < E131_SYNC_TIMEOUT;
+}
+
+//swaps the staging slots, the assembled frame becomes the one the main loop copies to the strip
+//the next frame starts as a copy of this one, so universes missing from it keep their pixels
+static void e131HandOffFrame() {
+  e131AssembleSlot ^= 1;
+  memcpy(e131StagingSlot(e131AssembleSlot), e131StagingSlot(e131AssembleSlot ^ 1), (uint32_t)e131StagingLeds * e131StagingBpp);
+  e131FrameReady = true;
+}
+
+//hand the assembled frame to the main loop for showing
+void e131ShowFrame() {
+  if (e131Staging ? e131FrameReady : e131NewData) e131FramesDropped++; //previous frame was not shown yet
+  if (e131FrameUniverses >= e131UniverseCount) e131FramesComplete++;
+  else e131FramesPartial++;
+  if (e131Staging) {
+    e131HandOffFrame();
+    ddpShowAt = 0;
+  } else {
+    e131NewData = true;
+  }
+  e131ResetFrame();
+}
+
+void e131UniverseReceived(uint8_t index) {
+  if (e131UniverseStats[index].frame == e131FrameNumber) { //next frame started before this one was complete
+    e131FramesDropped++;
+    e131ResetFrame();
+  }
+  if (!e131FrameUniverses) e131FrameStart = millis();
+  e131UniverseStats[index].frame = e131FrameNumber;
+  e131FrameUniverses++;
+  if (e131FrameUniverses >= e131UniverseCount && !e131SyncActive()) e131ShowFrame();
+}
+
+void handleE131Sync(byte protocol, uint16_t syncAddress) {
+  if (protocol == P_E131_SYNC && syncAddress != e131SyncAddress) return; //sync for another group of universes
+  e131SyncLastSeen = millis();
+  if (e131FrameUniverses) e131ShowFrame();
+}
+
+//called from the main loop, copies the last complete frame to the strip and shows a frame that is missing universes after a timeout
+//timecoded DDP frames are queued in the realtime ring to be shown when due. Until the ring is set up, the frame waits in staging
+void handleE131Frame() {
+  if (e131ConfigChanged()) initE131Universes(); //LED count, DMX mode or start universe changed
+  else initE131Staging(); //DDP stream started or ended
+  e131Lock();
+  if (e131FrameUniverses && millis() - e131FrameStart > E131_FRAME_TIMEOUT) e131ShowFrame();
+  unsigned long due = ddpShowAt;
+  if (e131FrameReady && (!due || realtimeBufferActive() || (long)(millis() - due) >= 0)) {
+    e131FrameReady = false;
+    ddpShowAt = 0;
+    if (due) ddpTimecoded = true; //the ring is allocated for the following frames
+    if (!realtimeOverride) {
+      setRealtimePixels(0, e131StagingSlot(e131AssembleSlot ^ 1), e131StagingLeds, e131StagingBpp);
+      if (realtimeBufferActive()) realtimeShowAt(due ? due : millis());
+      else e131NewData = true;
     }
   }
+  e131Unlock();
+}
+
+//hands a pushed DDP frame to the main loop, to be shown at millis() due (0 = right away)
+static void ddpShowFrame(unsigned long due) {
+  if (!e131Staging) { //no staging memory, the pixels went to the strip directly and are shown right away
+    e131NewData = true;
+    return;
+  }
+  if (e131FrameReady) {
+    e131FramesDropped++;
+    if (ddpShowAt) return; //keep the frame waiting for its time, replacing it with a later one would never show anything
+  }
+  e131HandOffFrame();
+  ddpShowAt = due;
+}
+
+//DDP protocol support, called by handleE131Packet
+
+//answers DDP status (discovery) and config queries with a JSON reply
+void sendDDPReply(e131_packet_t* p, IPAddress clientIP) {
+  char json[200];
+  uint16_t len;
+  if (p->destination == DDP_ID_CONFIG) {
+    IPAddress ip = Network.localIP(), nm = Network.subnetMask(), gw = Network.gatewayIP();
+    len = snprintf_P(json, sizeof(json), PSTR("{\"config\":{\"ip\":\"%u.%u.%u.%u\",\"nm\":\"%u.%u.%u.%u\",\"gw\":\"%u.%u.%u.%u\",\"ports\":[{\"port\":0,\"ts\":0,\"l\":%u,\"ss\":0}]}}"),
+      ip[0], ip[1], ip[2], ip[3], nm[0], nm[1], nm[2], nm[3], gw[0], gw[1], gw[2], gw[3], ledCount);
+  } else {
+    len = snprintf_P(json, sizeof(json), PSTR("{\"status\":{\"man\":\"WLED\",\"mod\":\"%s\",\"ver\":\"%s\",\"mac\":\"%s\",\"push\":true,\"ntp\":%s}}"),
+      serverDescription, versionString, escapedMac.c_str(), ntpSyncMillis ? "true" : "false");
+  }
+  if (len >= sizeof(json)) len = sizeof(json) -1;
 
-  uint32_t start = htonl(p->channelOffset) /3;
-  start += DMXAddress /3;
-  uint16_t stop = start + htons(p->dataLen) /3;
+  uint8_t reply[DDP_HEADER_LEN + sizeof(json)];
+  reply[0] = DDP_VERSION_1 | DDP_REPLY_FLAG | DDP_PUSH_FLAG;
+  reply[1] = p->sequenceNum;
+  reply[2] = 0;
+  reply[3] = p->destination;
+  reply[4] = reply[5] = reply[6] = reply[7] = 0; //offset
+  reply[8] = len >> 8;
+  reply[9] = len & 0xFF;
+  memcpy(reply + DDP_HEADER_LEN, json, len);
+  e131.sendTo(reply, DDP_HEADER_LEN + len, clientIP, DDP_DEFAULT_PORT);
+}
+
+void handleDDPPacket(e131_packet_t* p, IPAddress clientIP) {
+  if (p->flags & DDP_REPLY_FLAG) return; //reply from another device
+  if (p->flags & DDP_QUERY_FLAG) {
+    if (p->destination == DDP_ID_STATUS || p->destination == DDP_ID_CONFIG || p->destination == DDP_ID_DISPLAY || p->destination == DDP_ID_ALL)
+      sendDDPReply(p, clientIP);
+    return;
+  }
+  if (p->destination == DDP_ID_CONFIG || p->destination == DDP_ID_STATUS || p->destination == DDP_ID_DMX) return; //not pixel data
+
+  int sn = p->sequenceNum & 0xF;
+
+  //reject late packets belonging to the previous frame. Sequence numbers cycle 1-15, so this only
+  //works if a frame is at most 7 packets long. Longer frames are placed by their offset regardless
+  if (e131SkipOutOfSequence && ddpLastSequenceNumber && sn && ddpPacketsPerPush *2 <= 15) {
+    uint8_t age = (ddpLastSequenceNumber - sn + 15) % 15; //0 = push packet of the last frame
+    if (age < ddpPacketsPerPush) return;
+  }
+
+  uint8_t type = (p->dataType >> 3) & 0x07;
+  uint8_t bytesPerChannel = ((p->dataType & 0x07) == DDP_SIZE_16BIT) ? 2 : 1;
+  uint8_t channelsPerLed = (type == DDP_TYPE_RGBW) ? 4 : 3; //0 (legacy senders) and 1 are RGB
+  uint8_t bytesPerLed = channelsPerLed * bytesPerChannel;
+
+  uint32_t start = htonl(p->channelOffset) / bytesPerLed;
+  start += DMXAddress / channelsPerLed;
+  uint16_t count = htons(p->dataLen) / bytesPerLed; //dataLen is checked against the packet length by ESPAsyncE131
+  //pixels are addressed with 16 bits further on, drop what lies beyond instead of wrapping around to the start
+  if (start > 0xFFFF) count = 0;
+  else if (count > 0x10000 - start) count = 0x10000 - start;
   uint8_t* data = p->data;
-  uint16_t c = 0;
-  if (p->flags & DDP_TIMECODE_FLAG) c = 4; //packet has timecode flag, we do not support it, but data starts 4 bytes later
+  bool timecode = p->flags & DDP_TIMECODE_FLAG;
+  if (timecode) data = p->tcData;
 
   realtimeLock(realtimeTimeoutMs, REALTIME_MODE_DDP);
-  
-  for (uint16_t i = start; i < stop; i++) {
-    setRealtimePixel(i, data[c++], data[c++], data[c++], 0);
+
+  if (realtimeOverride || !e131StagingBpp) {
+    //nothing to draw, or staging is not set up yet. The main loop does that once realtime mode switched to DDP
+  } else if (bytesPerChannel == 1) {
+    e131SetPixels(start, data, count, channelsPerLed);
+  } else { //16 bit, use the high bytes
+    uint8_t buf[64*4];
+    uint16_t done = 0;
+    while (done < count) {
+      uint16_t n = count - done;
+      if (n > 64) n = 64;
+      for (uint16_t i = 0; i < n * channelsPerLed; i++) buf[i] = data[i*2];
+      e131SetPixels(start + done, buf, n, channelsPerLed);
+      data += n * bytesPerLed;
+      done += n;
+    }
   }
 
-  bool push = p->flags & DDP_PUSH_FLAG;
-  if (push) {
-    e131NewData = true;
-    byte sn = p->sequenceNum & 0xF;
-    if (sn) e131LastSequenceNumber[0] = sn;
+  ddpPacketsSincePush++;
+  if (p->flags & DDP_PUSH_FLAG) {
+    ddpPacketsPerPush = ddpPacketsSincePush;
+    ddpPacketsSincePush = 0;
+    if (sn) ddpLastSequenceNumber = sn;
+
+    //timecoded frames are shown at the given NTP time if it lies within the next 10 seconds
+    long delayMs = 0;
+    uint32_t nowTc = getNtpTimecode();
+    if (timecode && nowTc) {
+      int32_t diff = (int32_t)(ntohl(p->timeCode) - nowTc); //1/65536 s
+      if (diff > 0 && diff < 655360) delayMs = ((int64_t)diff * 1000) >> 16;
+    }
+    unsigned long due = 0;
+    if (delayMs > 0) {
+      due = millis() + delayMs;
+      if (!due) due = 1;
+    }
+    ddpShowFrame(due);
+  }
+}
+
+//Art-Net node discovery: answers ArtPoll with one ArtPollReply per group of up to 4 handled universes
+#define ARTNET_POLL_REPLY_SIZE 239
+
+void sendArtPollReply(IPAddress clientIP, uint16_t universe, uint8_t ports, uint8_t bindIndex) {
+  uint8_t r[ARTNET_POLL_REPLY_SIZE];
+  memset(r, 0, sizeof(r));
+
+  memcpy_P(r, PSTR("Art-Net"), 8);
+  r[8] = ARTNET_OPCODE_OPPOLLREPLY & 0xFF; r[9] = ARTNET_OPCODE_OPPOLLREPLY >> 8;
+  IPAddress ip = Network.localIP();
+  for (uint8_t i = 0; i < 4; i++) { r[10+i] = ip[i]; r[207+i] = ip[i]; } //IP and bind IP
+  r[14] = ARTNET_DEFAULT_PORT & 0xFF; r[15] = ARTNET_DEFAULT_PORT >> 8;
+  r[16] = atoi(versionString);                         //firmware major
+  const char* minor = strchr(versionString, '.');
+  r[17] = minor ? atoi(minor +1) : 0;                  //firmware minor
+  r[18] = (universe >> 8) & 0x7F;                      //net
+  r[19] = (universe >> 4) & 0x0F;                      //sub-net
+  r[20] = 0x00; r[21] = 0xFF;                          //OEM unknown
+  r[23] = 0xD0;                                        //status 1: indicators normal, addresses set locally
+  strncpy(reinterpret_cast<char*>(r +26), serverDescription, 17);
+  snprintf_P(reinterpret_cast<char*>(r +44), 64, PSTR("WLED %s %s"), versionString, serverDescription);
+  snprintf_P(reinterpret_cast<char*>(r +108), 64, PSTR("#0001 [%04u] WLED ok, %lu frames, %lu partial, %lu dropped"),
+    artPollReplyCount % 10000, (unsigned long)e131FramesComplete, (unsigned long)e131FramesPartial, (unsigned long)e131FramesDropped);
+  r[173] = ports;
+  for (uint8_t i = 0; i < ports; i++) {
+    r[174+i] = 0x80;                                   //output port, DMX512
+    uint8_t idx = universe + i - e131Universe;
+    if (idx < e131UniverseCount && e131UniverseStats[idx].packets) r[182+i] = 0x80; //data received
+    r[190+i] = (universe + i) & 0x0F;                  //output universe
+  }
+  r[200] = 0x00;                                       //style: node
+  WiFi.macAddress(r +201);
+  r[211] = bindIndex;
+  r[212] = 0x01 | 0x04 | 0x08;                         //status 2: web config, DHCP capable, 15 bit port address
+  if (!staticIP[0]) r[212] |= 0x02;                    //DHCP in use
+
+  e131.sendTo(r, sizeof(r), clientIP, ARTNET_DEFAULT_PORT);
+}
+
+//consoles that polled recently, each one is answered at most once per ARTNET_POLL_REPLY_INTERVAL
+#define ARTNET_POLL_SENDERS 4
+static struct { uint32_t ip; unsigned long last; } artPollSenders[ARTNET_POLL_SENDERS];
+
+//returns true if clientIP was answered too recently, otherwise records this reply
+//with more consoles than slots, the one answered longest ago is forgotten, so every console still gets replies
+static bool artPollRateLimited(IPAddress clientIP) {
+  uint32_t ip = clientIP;
+  unsigned long now = millis();
+  uint8_t slot = 0;
+  for (uint8_t i = 0; i < ARTNET_POLL_SENDERS; i++) {
+    if (artPollSenders[i].ip == ip) { slot = i; break; }
+    if (now - artPollSenders[i].last > now - artPollSenders[slot].last) slot = i;
+  }
+  if (artPollSenders[slot].ip == ip && now - artPollSenders[slot].last < ARTNET_POLL_REPLY_INTERVAL) return true;
+  artPollSenders[slot].ip = ip;
+  artPollSenders[slot].last = now;
+  return false;
+}
+
+void handleArtPoll(IPAddress clientIP) {
+  if (artPollRateLimited(clientIP)) return;
+  artPollReplyCount++;
+
+  if (DMXMode == DMX_MODE_DISABLED || !e131UniverseCount) {
+    sendArtPollReply(clientIP, e131Universe, 0, 1);
+    return;
+  }
+  //a reply can only describe ports sharing net and sub-net, so split at every 16th universe
+  uint8_t bindIndex = 1;
+  for (uint16_t i = 0; i < e131UniverseCount;) {
+    uint16_t universe = e131Universe + i;
+    uint8_t ports = 0;
+    while (ports < 4 && i + ports < e131UniverseCount && ((universe + ports) >> 4) == (universe >> 4)) ports++;
+    sendArtPollReply(clientIP, universe, ports, bindIndex++);
+    i += ports;
   }
 }
 
 //E1.31 and Art-Net protocol support
-void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
+static void handleE131Data(e131_packet_t* p, IPAddress clientIP, byte protocol){
 
   uint16_t uni = 0, dmxChannels = 0;
   uint8_t* e131_data = nullptr;
   uint8_t seq = 0, mde = REALTIME_MODE_E131;
 
+  if (protocol == P_ARTNET_POLL) {
+    handleArtPoll(clientIP);
+    return;
+  }
+
+  if (protocol == P_E131_SYNC || protocol == P_ARTNET_SYNC) {
+    handleE131Sync(protocol, (protocol == P_E131_SYNC) ? htons(p->sync_address) : 0);
+    return;
+  }
+
   if (protocol == P_ARTNET)
   {
     uni = p->art_universe;
@@ -65,9 +432,14 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
     dmxChannels = htons(p->property_value_count) -1;
     e131_data = p->property_values;
     seq = p->sequence_number;
+    uint16_t syncAddress = htons(p->synchronization_address);
+    if (syncAddress) { //source will send a sync packet once all universes are out
+      e131SyncAddress = syncAddress;
+      e131SyncLastSeen = millis();
+    }
   } else { //DDP
     realtimeIP = clientIP;
-    handleDDPPacket(p);
+    handleDDPPacket(p, clientIP);
     return;
   }
 
@@ -81,14 +453,19 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
   #endif
 
   // only listen for universes we're handling & allocated memory
-  if (uni >= (e131Universe + E131_MAX_UNIVERSE_COUNT)) return;
+  if (uni < e131Universe || uni >= (e131Universe + e131UniverseCount)) return;
 
   uint8_t previousUniverses = uni - e131Universe;
+  E131UniverseStats* stats = &e131UniverseStats[previousUniverses];
+
+  //Art-Net sequence 0 means sequencing is disabled
+  if (stats->packets && (seq || protocol != P_ARTNET) && seq != (byte)(stats->lastSeq +1)) stats->lost++;
+  stats->packets++;
 
   if (e131SkipOutOfSequence)
-    if (seq < e131LastSequenceNumber[uni-e131Universe] && seq > 20 && e131LastSequenceNumber[uni-e131Universe] < 250){
+    if (seq < stats->lastSeq && seq > 20 && stats->lastSeq < 250){
       DEBUG_PRINT("skipping E1.31 frame (last seq=");
-      DEBUG_PRINT(e131LastSequenceNumber[uni-e131Universe]);
+      DEBUG_PRINT(stats->lastSeq);
       DEBUG_PRINT(", current seq=");
       DEBUG_PRINT(seq);
       DEBUG_PRINT(", universe=");
@@ -96,7 +473,7 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
       DEBUG_PRINTLN(")");
       return;
     }
-  e131LastSequenceNumber[uni-e131Universe] = seq;
+  stats->lastSeq = seq;
 
   // update status info
   realtimeIP = clientIP;
@@ -113,8 +490,10 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
       realtimeLock(realtimeTimeoutMs, mde);
       if (realtimeOverride) return;
       wChannel = (dmxChannels-DMXAddress+1 > 3) ? e131_data[DMXAddress+3] : 0;
-      for (uint16_t i = 0; i < ledCount; i++)
-        setRealtimePixel(i, e131_data[DMXAddress+0], e131_data[DMXAddress+1], e131_data[DMXAddress+2], wChannel);
+      {
+        byte px[4] = {e131_data[DMXAddress+0], e131_data[DMXAddress+1], e131_data[DMXAddress+2], wChannel};
+        for (uint16_t i = 0; i < ledCount; i++) e131SetPixels(i, px, 1, 4);
+      }
       break;
 
     case DMX_MODE_SINGLE_DRGB:
@@ -128,8 +507,10 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
         bri = e131_data[DMXAddress+0];
         strip.setBrightness(bri);
       }
-      for (uint16_t i = 0; i < ledCount; i++)
-        setRealtimePixel(i, e131_data[DMXAddress+1], e131_data[DMXAddress+2], e131_data[DMXAddress+3], wChannel);
+      {
+        byte px[4] = {e131_data[DMXAddress+1], e131_data[DMXAddress+2], e131_data[DMXAddress+3], wChannel};
+        for (uint16_t i = 0; i < ledCount; i++) e131SetPixels(i, px, 1, 4);
+      }
       break;
 
     case DMX_MODE_EFFECT:
@@ -139,7 +520,7 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
         DMXOldDimmer = e131_data[DMXAddress+0];
         bri = e131_data[DMXAddress+0];
       }
-      if (e131_data[DMXAddress+1] < MODE_COUNT)
+      if (e131_data[DMXAddress+1] < strip.getModeCount())
         effectCurrent = e131_data[DMXAddress+ 1];
       effectSpeed     = e131_data[DMXAddress+ 2];  // flickers
       effectIntensity = e131_data[DMXAddress+ 3];
@@ -185,14 +566,8 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
           previousLeds = ledsInFirstUniverse + (previousUniverses - 1) * ledsPerUniverse;
         }
         uint16_t ledsTotal = previousLeds + (dmxChannels - dmxOffset +1) / dmxChannelsPerLed;
-        if (!is4Chan) {
-          for (uint16_t i = previousLeds; i < ledsTotal; i++) {
-            setRealtimePixel(i, e131_data[dmxOffset++], e131_data[dmxOffset++], e131_data[dmxOffset++], 0);
-          }
-        } else {
-          for (uint16_t i = previousLeds; i < ledsTotal; i++) {
-            setRealtimePixel(i, e131_data[dmxOffset++], e131_data[dmxOffset++], e131_data[dmxOffset++], e131_data[dmxOffset++]);
-          }
+        if (ledsTotal > previousLeds) {
+          e131SetPixels(previousLeds, e131_data + dmxOffset, ledsTotal - previousLeds, dmxChannelsPerLed);
         }
         break;
       }
@@ -202,5 +577,11 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
       break;
   }
 
-  e131NewData = true;
+  e131UniverseReceived(previousUniverses);
+}
+
+void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
+  e131Lock();
+  handleE131Data(p, clientIP, protocol);
+  e131Unlock();
 }
@@ -19,6 +19,9 @@ void initBlynk(const char* auth, const char* host, uint16_t port);
 void handleBlynk();
 void updateBlynk();
 
+//bin_control.cpp
+size_t handleBinaryControl(const uint8_t* data, size_t len, uint8_t* ack);
+
 //button.cpp
 void shortPressAction();
 bool isButtonPressed();
@@ -52,7 +55,19 @@ void initDMX();
 void handleDMX();
 
 //e131.cpp
+struct E131UniverseStats {
+  byte lastSeq;     // to detect packet loss
+  byte frame;       // frame number the universe was last received for
+  uint32_t packets; // packets received
+  uint32_t lost;    // sequence gaps (lost or reordered packets)
+};
+
+void e131Lock();
+void e131Unlock();
+void initE131Universes();
 void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol);
+void handleE131Frame();
+bool e131SyncActive();
 
 //file.cpp
 bool handleFileRead(AsyncWebServerRequest*, String path);
@@ -97,12 +112,116 @@ void handleIR();
 #include "src/dependencies/json/AsyncJson-v6.h"
 #include "FX.h"
 
-void deserializeSegment(JsonObject elem, byte it);
-bool deserializeState(JsonObject root);
+struct SegmentPixelCursor {
+  uint16_t start = 0, stop = 0;
+  byte set = 0; //0 nothing set, 1 start set, 2 range set
+};
+void beginSegmentPixels(byte id);
+bool applySegmentPixel(JsonVariant entry, SegmentPixelCursor& cur);
+void endSegmentPixels();
+void deserializeSegment(JsonObject elem, byte it, bool pixelsStreamed = false);
+void deserializeStateFields(JsonObject root);
+class JsonStateParser;
+bool deserializeState(JsonObject root, JsonStateParser* parser = nullptr);
 void serializeSegment(JsonObject& root, WS2812FX::Segment& seg, byte id, bool forPreset = false, bool segmentBounds = true);
+void serializeStateFields(JsonObject root, bool forPreset = false, bool includeBri = true);
 void serializeState(JsonObject root, bool forPreset = false, bool includeBri = true, bool segmentBounds = true);
 void serializeInfo(JsonObject root);
+
+#define STATE_DELTA_FIELDS 32
+struct StateFieldHash {
+  uint32_t key;
+  uint32_t value;
+};
+//hashes of the state fields in the last message sent, the base a delta is computed against
+struct StateDeltaBase {
+  StateFieldHash fields[STATE_DELTA_FIELDS];
+  byte count = 0;
+  uint32_t rev = 0;
+};
+byte hashStateFields(JsonObject state, StateFieldHash* hashes);
+bool stateChanged(const StateDeltaBase& base, const StateFieldHash* hashes, byte n);
+size_t serializeStateDelta(JsonObject state, const StateFieldHash* hashes, byte n, const StateDeltaBase& base, char* dest);
+size_t serializeStateSections(const StateDeltaBase* base, StateFieldHash* hashes, byte& n, char* dest, size_t size);
+void setStateDeltaBase(StateDeltaBase& base, const StateFieldHash* hashes, byte n);
 void serveJson(AsyncWebServerRequest* request);
+
+class JsonStream {
+  public:
+    JsonStream(byte subJson) : _subJson(subJson) {}
+    ~JsonStream();
+    size_t fill(uint8_t* buffer, size_t maxLen); //0 once everything is sent
+  private:
+    byte _subJson;
+    byte _part = 0;
+    byte _seg = 0;
+    bool _firstSeg = true;
+    char* _text = nullptr;         //current section, rendered into RAM
+    const char* _flash = nullptr;  //or a string in flash
+    size_t _len = 0, _pos = 0;
+    bool nextPart();
+    void setFlash(const char* text, size_t len = SIZE_MAX);
+    bool setDoc(JsonDocument& doc, const char* prefix, const char* suffix);
+    bool setUsermodEffects(bool data);
+};
+
+//incremental parser for state messages, input may arrive in any number of chunks
+//the root fields are collected and returned by root(). "seg" is kept as raw JSON and applied by applySegments() when
+//deserializeState() gets to it, so everything is applied in the same order as from a whole document.
+//A "seg" too large to be kept is applied while it arrives instead, after the root fields received before it,
+//with its segments applied as soon as they are complete and the entries of "i" one by one
+class JsonStateParser {
+  public:
+    JsonStateParser() { begin(); }
+    void begin();
+    bool feed(const uint8_t* data, size_t len); //false once the input is invalid or exceeds a buffer
+    bool end();                                 //true if a complete root object was received
+    JsonObject root() { return _doc.as<JsonObject>(); }
+    void applySegments();                       //applies the kept "seg", called by deserializeState()
+  private:
+    enum Target : uint8_t { CAP_NONE, CAP_SKIP, CAP_REST, CAP_SEG, CAP_PIX };
+    enum Kind : uint8_t { KIND_CONTAINER, KIND_STRING, KIND_LITERAL };
+
+    StaticJsonDocument<JSON_PARSER_DOC_SIZE> _doc;
+    char _rest[JSON_PARSER_REST_SIZE];  //root fields, including "seg" as long as it fits
+    char _seg[JSON_PARSER_SEG_SIZE];    //current segment except "i"
+    char _pix[JSON_PARSER_PIX_SIZE];    //current "i" entry
+    char _key[16];
+    char _stack[JSON_PARSER_DEPTH];     //open containers not captured as a whole
+    uint16_t _restLen, _segLen;
+    uint16_t _fieldStart;               //root field being copied to _rest
+    uint16_t _segKeyStart, _segStart, _segEnd; //"seg" in _rest: its key, its value and the end of the value once complete
+    uint16_t _segVal, _segValLen;       //the kept "seg" value after end()
+    uint16_t _appliedFields;            //root fields applied before a streamed "seg", bits of stateFieldKeys
+    uint16_t _segTargets;               //segments the current element is applied to
+    byte _pixLen, _keyLen, _depth;
+    byte _elemDepth;                    //depth of the current element's fields, 3 in a "seg" array and 2 in a "seg" object
+    bool _error, _done;
+    bool _inKey, _expectKey;
+    bool _capSeg;                       //"seg" is being copied to _rest
+    bool _streaming, _segStreamed;      //"seg" is applied while it is parsed, was applied that way
+    Target _cap;                        //where the value being read is copied to
+    Kind _capKind;
+    byte _capLevel;
+    bool _capStr, _capEsc;
+    bool _inSegArray, _segObject, _inElement, _inPixels, _elemPixels, _pixStop;
+    byte _segIt, _segFields;
+    SegmentPixelCursor _cursor;
+
+    void parse(char c);
+    void put(char c);
+    void put(const char* s);
+    void startValue(char c);
+    void endValue();
+    void closeContainer(char c);
+    void beginElement();
+    uint16_t segmentTargets(JsonObject elem);
+    bool applySegment(bool pixelsStreamed);
+    void beginPixels();
+    void applyFields(uint16_t len);
+    void streamSeg();
+    void replaySeg(const char* json, uint16_t len);
+};
 bool serveLiveLeds(AsyncWebServerRequest* request, uint32_t wsClient = 0);
 
 //led.cpp
@@ -130,6 +249,7 @@ void publishMqtt();
 void handleNetworkTime();
 void sendNTPPacket();
 bool checkNTPResponse();    
+uint32_t getNtpTimecode();
 void updateLocalTime();
 void getTimeString(char* out);
 bool checkCountdown();
@@ -179,20 +299,31 @@ void _setRandomColor(bool _sec,bool fromButton=false);
 bool isAsterisksOnly(const char* str, byte maxLen);
 void handleSettingsSet(AsyncWebServerRequest *request, byte subPage);
 bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply=true);
-int getNumVal(const String* req, uint16_t pos);
-bool updateVal(const String* req, const char* key, byte* val, byte minv=0, byte maxv=255);
+class HttpApiRequest;
+int getNumVal(const HttpApiRequest& req, uint8_t key);
+bool updateVal(const HttpApiRequest& req, uint8_t key, byte* val, byte minv=0, byte maxv=255);
+
+//realtime.cpp
+bool realtimeBufferActive();
+void realtimeBufferPixel(uint16_t pix, byte r, byte g, byte b, byte w);
+void realtimeBufferPixels(uint16_t pix, const byte* data, uint16_t count, byte stride, bool gamma);
+void realtimeShow();
+void realtimeShowAt(unsigned long due);
+void handleRealtimeBuffer();
 
 //udp.cpp
 void notify(byte callMode, bool followUp=false);
 void realtimeLock(uint32_t timeoutMs, byte md = REALTIME_MODE_GENERIC);
 void handleNotifications();
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w);
+void setRealtimePixels(uint16_t start, const byte* data, uint16_t count, byte stride);
 
 //um_manager.cpp
 class Usermod {
   public:
     virtual void loop() {}
     virtual void setup() {}
+    virtual void addEffects() {} //register effects with strip.addEffect(), called before the boot preset is applied
     virtual void connected() {}
     virtual void addToJsonState(JsonObject& obj) {}
     virtual void addToJsonInfo(JsonObject& obj) {}
@@ -211,6 +342,7 @@ class UsermodManager {
     void loop();
 
     void setup();
+    void addEffects();
     void connected();
 
     void addToJsonState(JsonObject& obj);
@@ -240,22 +372,39 @@ void deEEPSettings();
 void clearEEPROM();
 
 //wled_serial.cpp
+void beginSerial();
 void handleSerial();
 
 //wled_server.cpp
 bool isIp(String str);
 bool captivePortal(AsyncWebServerRequest *request);
+bool admitHeavyRequest(AsyncWebServerRequest *request, bool write);
+void serveBusy(AsyncWebServerRequest *request);
 void initServer();
 void serveIndexOrWelcome(AsyncWebServerRequest *request);
+void setStaticContentCacheHeaders(AsyncWebServerResponse *response, const char* etag);
+void serveStaticAsset(AsyncWebServerRequest* request, const char* contentType, const uint8_t* data, size_t len, bool gzip = false);
+void serveStaticPage(AsyncWebServerRequest* request, const char* page);
 void serveIndex(AsyncWebServerRequest* request);
 String msgProcessor(const String& var);
 void serveMessage(AsyncWebServerRequest* request, uint16_t code, const String& headl, const String& subl="", byte optionT=255);
-String settingsProcessor(const String& var);
 String dmxProcessor(const String& var);
+void serveSettingsJS(AsyncWebServerRequest* request);
 void serveSettings(AsyncWebServerRequest* request, bool post = false);
 
+//sse.cpp
+void handleSse();
+void sseConnected(AsyncEventSourceClient * client);
+void sendDataSse();
+
 //ws.cpp
 void handleWs();
+void handleWsPixels(AsyncWebSocketClient * client, const uint8_t *data, size_t len);
+void handleWsBinary(AsyncWebSocketClient * client, const uint8_t *data, size_t len);
+void removeLiveClient(uint32_t id);
+void setLiveClient(AsyncWebSocketClient * client, JsonVariant lv);
+void trackWsClient(uint32_t id, bool connected);
+void setDeltaClient(uint32_t id, JsonObject root);
 void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len);
 void sendDataWs(AsyncWebSocketClient * client = nullptr);
 
@@ -5,373 +5,989 @@
  * to find out how to easily modify the web UI source!
  */ 
 
-// Autogenerated from wled00/data/style.css, do not edit!!
-const char PAGE_settingsCss[] PROGMEM = R"=====(<style>body{font-family:Verdana,sans-serif;text-align:center;background:#222;color:#fff;line-height:200%;margin:0}hr{border-color:#666}button{background:#333;color:#fff;font-family:Verdana,sans-serif;border:.3ch solid #333;display:inline-block;font-size:20px;margin:8px;margin-top:12px}.helpB{text-align:left;position:absolute;width:60px}input{background:#333;color:#fff;font-family:Verdana,sans-serif;border:.5ch solid #333}input[type=number]{width:4em}select{background:#333;color:#fff;font-family:Verdana,sans-serif;border:.5ch solid #333}td{padding:2px}.d5{width:4.5em!important}</style>)=====";
-
 
+#ifdef WLED_ENABLE_DMX
 // Autogenerated from wled00/data/settings.htm, do not edit!!
-const char PAGE_settings[] PROGMEM = R"=====(<!DOCTYPE html><html lang="en"><head><meta charset="UTF-8"><title>WLED Settings
-</title><style>
-body{text-align:center;background:#222;height:100px;margin:0}html{--h:11.55vh}button{background:#333;color:#fff;font-family:Verdana,Helvetica,sans-serif;border:.3ch solid #333;display:inline-block;font-size:8vmin;height:var(--h);width:95%%;margin-top:2.4vh}
-</style><script>
-function BB(){window.frameElement&&(document.getElementById("b").style.display="none",document.documentElement.style.setProperty("--h","13.86vh"))}
-</script></head><body onload="BB()"><form action="/"><button type="submit" 
-id="b">Back</button></form><form action="/settings/wifi"><button type="submit">
-WiFi Setup</button></form><form action="/settings/leds"><button type="submit">
-LED Preferences</button></form><form action="/settings/ui"><button 
-type="submit">User Interface</button></form>%DMXMENU%<form action="/settings/sync">
-<button type="submit">Sync Interfaces</button></form><form 
-action="/settings/time"><button type="submit">Time & Macros</button></form><form
- action="/settings/sec"><button type="submit">Security & Updates</button></form>
-</body></html>)=====";
-
+const uint16_t PAGE_settings_length = 589;
+const uint8_t PAGE_settings[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x94, 0xd1, 0x4e, 0xdb, 0x30,
+  0x14, 0x86, 0xef, 0xf3, 0x14, 0x9e, 0xd1, 0x50, 0x2b, 0x35, 0x29, 0x6d, 0xc7, 0xc4, 0x92, 0x34,
+  0x17, 0x1d, 0xa0, 0x21, 0x0d, 0x81, 0x04, 0x8c, 0xed, 0xd2, 0xb1, 0x4f, 0x12, 0x8b, 0xc4, 0x8e,
+  0xec, 0x93, 0x96, 0xac, 0xe2, 0xdd, 0xe7, 0x34, 0x65, 0xc0, 0xa0, 0x13, 0x37, 0x89, 0x63, 0xfb,
+  0x7c, 0xfa, 0xec, 0xf3, 0x2b, 0xf1, 0x87, 0xe3, 0x8b, 0xaf, 0xd7, 0xbf, 0x2e, 0x4f, 0x48, 0x81,
+  0x55, 0x99, 0xc4, 0xdd, 0x93, 0x94, 0x4c, 0xe5, 0x73, 0x0a, 0x8a, 0xba, 0x6f, 0x60, 0x22, 0x89,
+  0x2b, 0x40, 0x46, 0x78, 0xc1, 0x8c, 0x05, 0x9c, 0xd3, 0x9b, 0xeb, 0x53, 0xff, 0xc8, 0xad, 0xa1,
+  0xc4, 0x12, 0x92, 0xdb, 0xef, 0x27, 0xc7, 0xe4, 0x0a, 0x10, 0xa5, 0xca, 0xad, 0x17, 0x8f, 0xfb,
+  0xd9, 0xd8, 0x62, 0xeb, 0x5e, 0x5e, 0xaa, 0x45, 0xbb, 0x46, 0xb8, 0x47, 0x9f, 0x95, 0x32, 0x57,
+  0x21, 0x07, 0x85, 0x60, 0xa2, 0x94, 0xf1, 0xbb, 0xdc, 0xe8, 0x46, 0x89, 0x70, 0x6f, 0x3a, 0x9d,
+  0x46, 0x05, 0xc8, 0xbc, 0xc0, 0x70, 0x72, 0x70, 0x50, 0xdf, 0x47, 0x15, 0x33, 0xb9, 0x54, 0xe1,
+  0xc1, 0x43, 0x27, 0xb3, 0xf6, 0xfd, 0x22, 0x9c, 0x4c, 0x82, 0xc3, 0xc3, 0x65, 0xf1, 0x90, 0x36,
+  0x88, 0x5a, 0xad, 0x9f, 0x57, 0xcf, 0x66, 0xb3, 0x88, 0xeb, 0x52, 0x9b, 0x70, 0x2f, 0xcb, 0xb2,
+  0x28, 0xd3, 0x0a, 0xfd, 0x8c, 0x55, 0xb2, 0x6c, 0xc3, 0x1f, 0x60, 0x04, 0x53, 0x6c, 0xf4, 0x0d,
+  0xca, 0x25, 0xa0, 0xe4, 0x6c, 0x64, 0x99, 0xb2, 0xbe, 0x05, 0x23, 0xb3, 0x28, 0xd5, 0x46, 0x80,
+  0x09, 0x83, 0x19, 0x2f, 0x88, 0xd5, 0xa5, 0x14, 0x64, 0x83, 0x12, 0xd2, 0xd6, 0x25, 0x6b, 0x43,
+  0xa9, 0x4a, 0xa9, 0xc0, 0x4f, 0x4b, 0xcd, 0xef, 0x7a, 0xa8, 0x95, 0xbf, 0x21, 0x3c, 0x5a, 0x56,
+  0x52, 0x3d, 0xda, 0x2e, 0x99, 0x19, 0x38, 0xbb, 0x61, 0xb4, 0x92, 0x02, 0x8b, 0xf0, 0xcb, 0xe1,
+  0xc7, 0xad, 0xba, 0x8f, 0xba, 0x0e, 0xa7, 0xc1, 0x27, 0x67, 0xec, 0x2e, 0xa4, 0xbf, 0x89, 0xd8,
+  0x72, 0x23, 0x6b, 0x4c, 0xbc, 0xac, 0x51, 0x1c, 0xa5, 0x56, 0x64, 0xb1, 0x18, 0x0c, 0xd7, 0x2b,
+  0xa9, 0x84, 0x5e, 0x05, 0x99, 0x61, 0x15, 0x9c, 0x94, 0x50, 0xb9, 0xeb, 0xd9, 0xdf, 0x1f, 0x08,
+  0xcd, 0x9b, 0x6e, 0x18, 0xe4, 0x80, 0xdb, 0xd9, 0x45, 0x7b, 0x26, 0x06, 0x34, 0xa5, 0xc3, 0x60,
+  0xc3, 0x0b, 0xb6, 0xa2, 0x73, 0xaa, 0xb4, 0x02, 0x3a, 0xfa, 0x5b, 0xf1, 0x38, 0xd8, 0x96, 0x6d,
+  0x77, 0xbb, 0xbe, 0x5d, 0x1a, 0x5d, 0x83, 0xc1, 0x76, 0x40, 0x9d, 0x33, 0x1d, 0xd1, 0xc9, 0x2c,
+  0x38, 0xfa, 0xbc, 0x2c, 0xe8, 0x70, 0xb8, 0x91, 0xec, 0xed, 0xe2, 0x71, 0xdf, 0xf0, 0xae, 0x6d,
+  0x44, 0xab, 0x52, 0x33, 0x31, 0xa7, 0x9d, 0xa8, 0x6b, 0x77, 0xa6, 0x4d, 0x45, 0xd8, 0xc6, 0x7d,
+  0x4e, 0xc7, 0x6e, 0xa2, 0xef, 0x06, 0xc1, 0xb6, 0x86, 0x39, 0xb5, 0x4d, 0x5a, 0x49, 0xa4, 0xc4,
+  0x93, 0xae, 0x22, 0xa5, 0xc9, 0xc2, 0xf5, 0x28, 0x1e, 0xf7, 0x5b, 0x1c, 0xb6, 0x2b, 0xfe, 0x17,
+  0x61, 0xb7, 0xa1, 0x19, 0xaf, 0x64, 0x26, 0x77, 0xf0, 0x12, 0xef, 0x56, 0x9e, 0xca, 0x2e, 0x5f,
+  0x4d, 0xfd, 0x5e, 0x5c, 0x09, 0xc2, 0xee, 0xc4, 0x75, 0x69, 0xbd, 0x34, 0x90, 0x81, 0x01, 0xc5,
+  0xc1, 0xbe, 0x97, 0xd9, 0x3c, 0x13, 0xf4, 0x5e, 0x22, 0x6f, 0x5c, 0xa0, 0xc8, 0x59, 0x17, 0xeb,
+  0x8c, 0x71, 0xf8, 0x2f, 0xf0, 0x89, 0x27, 0xaa, 0xfb, 0x97, 0x86, 0x3d, 0x2d, 0x39, 0x3e, 0xff,
+  0x49, 0x2e, 0x1a, 0xac, 0x1b, 0x7c, 0xaf, 0x99, 0x6d, 0x15, 0x77, 0xe7, 0x7a, 0xfb, 0xb8, 0x57,
+  0x6e, 0xf1, 0xc9, 0x6d, 0xc7, 0x69, 0xbd, 0xd7, 0x50, 0x94, 0x15, 0xec, 0xba, 0xc2, 0x6b, 0xb7,
+  0x46, 0xf6, 0xc9, 0x39, 0xe3, 0x46, 0xbf, 0x4d, 0xf4, 0xde, 0xd2, 0x04, 0xbe, 0x0b, 0x78, 0x05,
+  0xbc, 0x31, 0x12, 0x5b, 0x07, 0xbd, 0xa9, 0x05, 0xc3, 0xd7, 0x9e, 0x2e, 0xa0, 0x5d, 0x22, 0xbb,
+  0x78, 0x76, 0x7f, 0xa9, 0x3f, 0x09, 0x82, 0x26, 0x3e, 0xb5, 0x04, 0x00, 0x00
+};
+#else
+// Autogenerated from wled00/data/settings.htm, do not edit!!
+const uint16_t PAGE_settings_length = 568;
+const uint8_t PAGE_settings[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x94, 0x5d, 0x4f, 0xdb, 0x30,
+  0x14, 0x86, 0xef, 0xf3, 0x2b, 0x3c, 0xa3, 0xa1, 0x56, 0x6a, 0x52, 0xda, 0x8e, 0x89, 0x25, 0x69,
+  0x2f, 0x3a, 0x40, 0x43, 0xda, 0x34, 0x24, 0xe8, 0xd0, 0x2e, 0x1d, 0xfb, 0x24, 0xb1, 0x70, 0xec,
+  0xc8, 0x3e, 0x69, 0xc9, 0x2a, 0xfe, 0xfb, 0x9c, 0xa6, 0x6c, 0x6c, 0x50, 0x89, 0x9b, 0xc4, 0x5f,
+  0xe7, 0xd1, 0x13, 0x9f, 0x57, 0x49, 0xdf, 0x9d, 0x7f, 0xff, 0x7c, 0xfb, 0xf3, 0xfa, 0x82, 0x94,
+  0x58, 0xa9, 0x45, 0xda, 0x3d, 0x89, 0x62, 0xba, 0x98, 0x53, 0xd0, 0xd4, 0xcf, 0x81, 0x89, 0x45,
+  0x5a, 0x01, 0x32, 0xc2, 0x4b, 0x66, 0x1d, 0xe0, 0x9c, 0xae, 0x6e, 0x2f, 0xc3, 0x33, 0xbf, 0x87,
+  0x12, 0x15, 0x2c, 0xee, 0xbe, 0x5e, 0x9c, 0x93, 0x1b, 0x40, 0x94, 0xba, 0x70, 0x41, 0x3a, 0xee,
+  0x57, 0x53, 0x87, 0xad, 0x7f, 0x05, 0x99, 0x11, 0xed, 0x16, 0xe1, 0x01, 0x43, 0xa6, 0x64, 0xa1,
+  0x63, 0x0e, 0x1a, 0xc1, 0x26, 0x19, 0xe3, 0xf7, 0x85, 0x35, 0x8d, 0x16, 0xf1, 0xd1, 0x74, 0x3a,
+  0x4d, 0x4a, 0x90, 0x45, 0x89, 0xf1, 0xe4, 0xe4, 0xa4, 0x7e, 0x48, 0x2a, 0x66, 0x0b, 0xa9, 0xe3,
+  0x93, 0xc7, 0x4e, 0x66, 0x1b, 0x86, 0x65, 0x3c, 0x99, 0x44, 0xa7, 0xa7, 0xeb, 0xf2, 0x31, 0x6b,
+  0x10, 0x8d, 0xde, 0x3e, 0xaf, 0x9e, 0xcd, 0x66, 0x09, 0x37, 0xca, 0xd8, 0xf8, 0x28, 0xcf, 0xf3,
+  0x24, 0x37, 0x1a, 0xc3, 0x9c, 0x55, 0x52, 0xb5, 0xf1, 0x0f, 0xb0, 0x82, 0x69, 0x36, 0xfa, 0x02,
+  0x6a, 0x0d, 0x28, 0x39, 0x1b, 0x39, 0xa6, 0x5d, 0xe8, 0xc0, 0xca, 0x3c, 0xc9, 0x8c, 0x15, 0x60,
+  0xe3, 0x68, 0xc6, 0x4b, 0xe2, 0x8c, 0x92, 0x82, 0xec, 0x50, 0x42, 0xba, 0x5a, 0xb1, 0x36, 0x96,
+  0x5a, 0x49, 0x0d, 0x61, 0xa6, 0x0c, 0xbf, 0xef, 0xa1, 0x4e, 0xfe, 0x82, 0xf8, 0x6c, 0x5d, 0x49,
+  0xfd, 0x64, 0xbb, 0x66, 0x76, 0xe0, 0xed, 0x86, 0xc9, 0x46, 0x0a, 0x2c, 0xe3, 0x4f, 0xa7, 0xef,
+  0xf7, 0xea, 0x21, 0x9a, 0x3a, 0x9e, 0x46, 0x1f, 0xbc, 0xb1, 0xbf, 0x90, 0xfe, 0x26, 0x52, 0xc7,
+  0xad, 0xac, 0x71, 0x11, 0xe4, 0x8d, 0xe6, 0x28, 0x8d, 0x26, 0xcb, 0xe5, 0x60, 0xb8, 0xdd, 0x48,
+  0x2d, 0xcc, 0x26, 0xca, 0x2d, 0xab, 0xe0, 0x42, 0x41, 0xe5, 0xaf, 0xe7, 0xf8, 0x78, 0x20, 0x0c,
+  0x6f, 0xba, 0x61, 0x54, 0x00, 0xee, 0x57, 0x97, 0xed, 0x95, 0x18, 0xd0, 0x8c, 0x0e, 0xa3, 0x1d,
+  0x2f, 0xda, 0x8b, 0xce, 0xa9, 0x36, 0x1a, 0xe8, 0xe8, 0x4f, 0xc5, 0xd3, 0x60, 0x5f, 0xb6, 0x3f,
+  0xed, 0xfb, 0x76, 0x6d, 0x4d, 0x0d, 0x16, 0xdb, 0x01, 0xf5, 0xce, 0x74, 0x44, 0x27, 0xb3, 0xe8,
+  0xec, 0xe3, 0xba, 0xa4, 0xc3, 0xe1, 0x4e, 0xb2, 0xb7, 0x4b, 0xc7, 0x7d, 0xc3, 0xbb, 0xb6, 0x11,
+  0xa3, 0x95, 0x61, 0x62, 0x4e, 0x3b, 0x51, 0xdf, 0xee, 0xdc, 0xd8, 0x8a, 0xb0, 0x9d, 0xfb, 0x9c,
+  0x8e, 0xfd, 0x42, 0xdf, 0x0d, 0x82, 0x6d, 0x0d, 0x73, 0xea, 0x9a, 0xac, 0x92, 0x48, 0x49, 0x20,
+  0x7d, 0x45, 0x46, 0x17, 0x4b, 0xdf, 0xa3, 0x74, 0xdc, 0x1f, 0xf1, 0xd8, 0xae, 0xf8, 0x7f, 0x84,
+  0xdb, 0x87, 0x66, 0xbc, 0x91, 0xb9, 0x3c, 0xc0, 0x5b, 0x04, 0x77, 0xf2, 0x52, 0x76, 0xf9, 0x6a,
+  0xea, 0xb7, 0xe2, 0x14, 0x08, 0x77, 0x10, 0xd7, 0xa5, 0xf5, 0xda, 0x42, 0x0e, 0x16, 0x34, 0x07,
+  0xf7, 0x56, 0x66, 0xf3, 0x4c, 0x30, 0xf8, 0x17, 0xb9, 0xf2, 0x81, 0x22, 0x57, 0x5d, 0xac, 0x73,
+  0xc6, 0xe1, 0xad, 0x40, 0xd7, 0x6a, 0xee, 0x75, 0x5e, 0xb7, 0xbc, 0xf1, 0x9b, 0x7f, 0x91, 0x07,
+  0x24, 0x83, 0x97, 0x50, 0x94, 0x15, 0x1c, 0xfa, 0xf2, 0x5b, 0xbf, 0x47, 0x8e, 0xc9, 0x37, 0xc6,
+  0xad, 0x79, 0x9d, 0x18, 0xbc, 0xa6, 0x09, 0xfc, 0x10, 0xf0, 0x06, 0x78, 0x63, 0x25, 0xb6, 0x1e,
+  0xba, 0xaa, 0x05, 0xc3, 0x97, 0x9e, 0x3e, 0x57, 0x5d, 0x90, 0xba, 0x54, 0x75, 0x3f, 0x97, 0xdf,
+  0xb9, 0x28, 0x66, 0xa0, 0x6c, 0x04, 0x00, 0x00
+};
+#endif
 
 // Autogenerated from wled00/data/settings_wifi.htm, do not edit!!
-const char PAGE_settings_wifi[] PROGMEM = R"=====(<!DOCTYPE html><html lang="en"><head><meta charset="utf-8"><meta 
-name="viewport" content="width=500"><title>WiFi Settings</title><script>
-function H(){window.open("https://github.com/Aircoookie/WLED/wiki/Settings#wifi-settings")}function B(){window.open("/settings","_self")}function GetV() {var d=document;
-%CSS%%SCSS%</head><body onload="GetV()">
-<form id="form_s" name="Sf" method="post"><div class="helpB"><button 
-type="button" onclick="H()">?</button></div><button type="button" onclick="B()">
-Back</button><button type="submit">Save & Connect</button><hr><h2>WiFi setup
-</h2><h3>Connect to existing network</h3>
-Network name (SSID, empty to not connect):<br><input name="CS" maxlength="32">
-<br>Network password:<br><input type="password" name="CP" maxlength="63"><br>
-Static IP (leave at 0.0.0.0 for DHCP):<br><input name="I0" type="number" 
-min="0" max="255" required> . <input name="I1" type="number" min="0" max="255" 
-required> . <input name="I2" type="number" min="0" max="255" required> . <input 
-name="I3" type="number" min="0" max="255" required><br>Static gateway:<br><input
- name="G0" type="number" min="0" max="255" required> . <input name="G1" 
-type="number" min="0" max="255" required> . <input name="G2" type="number" 
-min="0" max="255" required> . <input name="G3" type="number" min="0" max="255" 
-required><br>Static subnet mask:<br><input name="S0" type="number" min="0" 
-max="255" required> . <input name="S1" type="number" min="0" max="255" required>
- . <input name="S2" type="number" min="0" max="255" required> . <input 
-name="S3" type="number" min="0" max="255" required><br>
-mDNS address (leave empty for no mDNS):<br>http:// <input name="CM" 
-maxlength="32"> .local<br>Client IP: <span class="sip">Not connected</span><br>
-<h3>Configure Access Point</h3>AP SSID (leave empty for no AP):<br><input 
-name="AS" maxlength="32"><br>Hide AP name: <input type="checkbox" name="AH"><br>
-AP password (leave empty for open):<br><input type="password" name="AP" 
-maxlength="63" pattern="(.{8,63})|()" title="Empty or min. 8 characters"><br>
-Access Point WiFi channel: <input name="AC" type="number" min="1" max="13" 
-required><br>AP opens: <select name="AB"><option value="0">
-No connection after boot</option><option value="1">Disconnected</option><option 
-value="2">Always</option><option value="3">Never (not recommended)</option>
-</select><br>AP IP: <span class="sip">Not active</span><br><h3>Experimental</h3>
-Disable WiFi sleep: <input type="checkbox" name="WS"><br><i>
-Can help with connectivity issues.<br>
-Do not enable if WiFi is working correctly, increases power consumption.</i><div
- id="ethd"><h3>Ethernet Type</h3><select name="ETH"><option value="0">None
-</option><option value="1">WT32-ETH01</option><option value="2">ESP32-POE
-</option></select><br><br></div><hr><button type="button" onclick="B()">Back
-</button><button type="submit">Save & Connect</button></form></body></html>)=====";
-
+const uint16_t PAGE_settings_wifi_length = 1371;
+const uint8_t PAGE_settings_wifi[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x57, 0x79, 0x6f, 0xe2, 0x46,
+  0x14, 0xff, 0xdf, 0x9f, 0x62, 0xea, 0x55, 0x2b, 0x90, 0x02, 0x26, 0xd0, 0x44, 0x91, 0x39, 0x56,
+  0x04, 0xe8, 0x26, 0x52, 0x9b, 0x45, 0x22, 0xda, 0xa8, 0xaa, 0xaa, 0xd5, 0x60, 0x3f, 0xe3, 0x29,
+  0xf6, 0x8c, 0x3b, 0x33, 0xe6, 0x28, 0xe5, 0xbb, 0xf7, 0xcd, 0xd8, 0x4e, 0x20, 0x47, 0xb3, 0xd9,
+  0x6d, 0x85, 0x20, 0xf6, 0xcc, 0x3b, 0x7f, 0xef, 0x4c, 0xef, 0xbb, 0xf1, 0xc7, 0xd1, 0xed, 0xaf,
+  0xd3, 0x09, 0x89, 0x75, 0x9a, 0x0c, 0x7a, 0xe6, 0x97, 0x24, 0x94, 0x2f, 0xfa, 0x2e, 0x70, 0x17,
+  0xdf, 0x81, 0x86, 0x83, 0x5e, 0x0a, 0x9a, 0x92, 0x20, 0xa6, 0x52, 0x81, 0xee, 0xbb, 0xb9, 0x8e,
+  0x1a, 0x17, 0x6e, 0x79, 0xea, 0x70, 0x9a, 0x42, 0xdf, 0x5d, 0x31, 0x58, 0x67, 0x42, 0x6a, 0x97,
+  0x04, 0x82, 0x6b, 0xe0, 0x48, 0xb6, 0x66, 0xa1, 0x8e, 0xfb, 0x67, 0xad, 0x16, 0x92, 0x6a, 0xa6,
+  0x13, 0x18, 0xdc, 0xb1, 0x9f, 0x18, 0x99, 0x81, 0xd6, 0x8c, 0x2f, 0x54, 0xcf, 0x2b, 0x0e, 0x7b,
+  0x2a, 0x90, 0x2c, 0xd3, 0x03, 0x27, 0xca, 0x79, 0xa0, 0x99, 0xe0, 0xe4, 0xaa, 0x56, 0xdf, 0xad,
+  0x19, 0x0f, 0xc5, 0xba, 0x29, 0x32, 0xe0, 0x35, 0x37, 0xd6, 0x3a, 0x53, 0xbe, 0xe7, 0x2d, 0x98,
+  0x8e, 0xf3, 0x79, 0x33, 0x10, 0xa9, 0x37, 0x64, 0x32, 0x10, 0x42, 0x2c, 0x19, 0x78, 0x77, 0x3f,
+  0x4f, 0xc6, 0xde, 0x9a, 0x2d, 0x99, 0x57, 0x89, 0x7e, 0xb7, 0x66, 0x11, 0x6b, 0xa8, 0xf2, 0xcd,
+  0xad, 0xef, 0xef, 0x45, 0x5f, 0x3e, 0x16, 0xed, 0xdd, 0x53, 0x9d, 0xb8, 0x9f, 0x15, 0x24, 0x11,
+  0x52, 0xf7, 0xbc, 0xd2, 0xa4, 0xd2, 0x34, 0xa2, 0x64, 0xd0, 0x7f, 0xa0, 0xf4, 0x54, 0xf3, 0x0f,
+  0xf5, 0x3e, 0xeb, 0x9f, 0xa2, 0x5f, 0x0f, 0x94, 0x7a, 0x8b, 0xbe, 0xcc, 0x45, 0xb8, 0xdd, 0x45,
+  0x08, 0x40, 0x23, 0xa2, 0x29, 0x4b, 0xb6, 0xfe, 0x27, 0x90, 0x21, 0xe5, 0xf4, 0x44, 0x51, 0xae,
+  0xd0, 0x20, 0xc9, 0xa2, 0xae, 0x86, 0x8d, 0x6e, 0xd0, 0x84, 0x2d, 0xb8, 0x1f, 0x20, 0x4e, 0x20,
+  0xbb, 0x73, 0x1a, 0x2c, 0x17, 0x52, 0xe4, 0x3c, 0xf4, 0xdf, 0xb5, 0xdb, 0xed, 0x6e, 0x20, 0x12,
+  0x21, 0xfd, 0x77, 0x51, 0x14, 0x75, 0x13, 0xc6, 0xa1, 0x11, 0x03, 0x5b, 0xc4, 0xda, 0x6f, 0xb7,
+  0x5a, 0xdf, 0x77, 0x53, 0x2a, 0x17, 0x8c, 0xfb, 0xad, 0x7d, 0x2c, 0x77, 0x73, 0x21, 0x43, 0x90,
+  0x8d, 0x92, 0xfc, 0xfc, 0xfc, 0x7c, 0x3f, 0xcf, 0xb5, 0x16, 0x7c, 0x77, 0x28, 0xb0, 0xd3, 0xe9,
+  0x1c, 0x0a, 0x7c, 0xc5, 0xb8, 0x42, 0xa4, 0xdf, 0xec, 0x04, 0x31, 0x51, 0x22, 0x61, 0x21, 0xb1,
+  0x02, 0x42, 0xa6, 0xb2, 0x84, 0x6e, 0x7d, 0xc6, 0xad, 0x41, 0xf3, 0x44, 0x04, 0xcb, 0x42, 0x94,
+  0x62, 0x7f, 0x01, 0x5a, 0x96, 0x6d, 0x2a, 0xcb, 0x2e, 0xee, 0x1f, 0x1b, 0x5a, 0x64, 0xfe, 0x69,
+  0x3b, 0xdb, 0xec, 0x9b, 0x31, 0x24, 0xd9, 0xe5, 0xee, 0xc0, 0xf3, 0x04, 0x22, 0xdd, 0xcd, 0x84,
+  0x62, 0x26, 0x2a, 0x3e, 0x9d, 0xa3, 0xae, 0x5c, 0x43, 0xd7, 0xa6, 0x8c, 0x7f, 0x8e, 0xe2, 0xf6,
+  0x8c, 0x67, 0xb9, 0xfe, 0x0f, 0x3c, 0x39, 0x3b, 0xf2, 0xa4, 0x10, 0xfb, 0x9b, 0xde, 0x66, 0xd0,
+  0xe7, 0x79, 0x3a, 0x07, 0xf9, 0xfb, 0xae, 0x50, 0xfa, 0x23, 0xa4, 0x7b, 0x8c, 0x3f, 0x04, 0xff,
+  0x83, 0x52, 0x1d, 0xee, 0x32, 0x1a, 0x86, 0x98, 0x3c, 0xbe, 0x85, 0x23, 0x3c, 0xab, 0x94, 0x36,
+  0xcf, 0x20, 0xfd, 0x8e, 0xa5, 0xa6, 0x72, 0x28, 0xd7, 0x26, 0xf3, 0x6c, 0x1e, 0xf5, 0xbc, 0xa2,
+  0xee, 0x4c, 0x3e, 0x11, 0xc1, 0x13, 0x41, 0xc3, 0xbe, 0xfb, 0x01, 0xf4, 0xa7, 0x5a, 0xdd, 0x1d,
+  0x38, 0xbd, 0x48, 0xc8, 0x94, 0x30, 0x3c, 0x32, 0x0f, 0x9f, 0x95, 0x4b, 0x8a, 0x1a, 0x9c, 0x45,
+  0x2e, 0xc1, 0x9a, 0x8c, 0x05, 0xde, 0x20, 0xb6, 0x1a, 0xf3, 0x33, 0x64, 0x2b, 0x12, 0x24, 0x54,
+  0xa9, 0xbe, 0x6b, 0x63, 0x80, 0x47, 0x45, 0x8e, 0x10, 0xc7, 0x62, 0xe0, 0x16, 0x6f, 0x2e, 0x2a,
+  0x09, 0x12, 0x16, 0x2c, 0xfb, 0xee, 0x95, 0x51, 0xf1, 0xbe, 0xe7, 0x15, 0x17, 0x68, 0x09, 0x8a,
+  0xb8, 0x67, 0x7a, 0x81, 0xe7, 0xd2, 0x9a, 0x75, 0x89, 0xb0, 0x3d, 0xf0, 0x1d, 0x71, 0xa8, 0x7c,
+  0x9e, 0x32, 0xb4, 0x67, 0x46, 0x57, 0x40, 0x7e, 0x20, 0x23, 0xc1, 0x39, 0x02, 0xfd, 0x40, 0x1c,
+  0x4b, 0xfc, 0xb6, 0x8b, 0xfe, 0x80, 0x65, 0x96, 0x67, 0x0e, 0x22, 0xd0, 0xc6, 0xb3, 0xce, 0xa0,
+  0xa4, 0x25, 0x5a, 0x10, 0xd8, 0x30, 0x65, 0x2a, 0x90, 0x70, 0xd0, 0x6b, 0x21, 0x51, 0x19, 0xde,
+  0x3b, 0x37, 0xc5, 0x8b, 0xc5, 0x80, 0xd4, 0x66, 0xb3, 0xeb, 0xf1, 0x09, 0x81, 0x34, 0xd3, 0x5b,
+  0xc3, 0xc2, 0x85, 0x36, 0x0d, 0xc9, 0x48, 0xa8, 0xfb, 0xbd, 0x39, 0xaa, 0xb1, 0x09, 0x50, 0x02,
+  0x36, 0x9a, 0x21, 0x60, 0x74, 0x93, 0x00, 0x5f, 0x60, 0xa7, 0x72, 0x3b, 0x6d, 0x03, 0x2e, 0x12,
+  0x55, 0x22, 0x33, 0x04, 0x0e, 0x1f, 0xc2, 0x43, 0xce, 0xc2, 0xa1, 0xea, 0xa6, 0x82, 0x7e, 0x34,
+  0x3d, 0x92, 0x74, 0xde, 0x31, 0x40, 0xcb, 0x81, 0x33, 0xd3, 0x54, 0xb3, 0x80, 0x5c, 0x4f, 0x49,
+  0x2d, 0x01, 0xe3, 0x3c, 0xd5, 0xa4, 0xd5, 0xb4, 0x1f, 0x82, 0xc1, 0x23, 0xe3, 0xab, 0xd1, 0xf4,
+  0x19, 0xc3, 0xae, 0x5b, 0x6e, 0xa9, 0xa8, 0x48, 0x52, 0x97, 0x38, 0x29, 0xe3, 0x7d, 0xb7, 0x65,
+  0xb5, 0xf4, 0xdd, 0xf6, 0xd9, 0x99, 0x4b, 0x24, 0xfc, 0x99, 0x33, 0x09, 0xe1, 0x80, 0x34, 0xc9,
+  0x31, 0xf7, 0xe9, 0x63, 0xee, 0xa7, 0xcc, 0xce, 0xcb, 0xdc, 0xed, 0xd7, 0xb9, 0x9f, 0x61, 0x2e,
+  0xe7, 0xc0, 0x75, 0xe7, 0x0d, 0xdc, 0xc6, 0xef, 0x12, 0xa1, 0x05, 0xd5, 0xb0, 0xc6, 0x0e, 0xf3,
+  0x00, 0x85, 0x53, 0xda, 0xf3, 0xa1, 0xf5, 0x55, 0xf6, 0x94, 0xcc, 0x08, 0x85, 0xf3, 0xf5, 0xdc,
+  0xed, 0x6f, 0x09, 0xc3, 0x87, 0xce, 0x5b, 0xc2, 0x70, 0x80, 0x05, 0x56, 0x0b, 0x66, 0x38, 0x52,
+  0xa9, 0xe5, 0xd3, 0xd4, 0x98, 0xbd, 0x08, 0x87, 0xf3, 0x05, 0x36, 0xcd, 0x4e, 0xdf, 0x00, 0xa6,
+  0xf3, 0x84, 0xfb, 0x9b, 0x52, 0x63, 0xf6, 0xd6, 0xd4, 0x70, 0xd2, 0xf1, 0xcd, 0x8c, 0x60, 0xe3,
+  0x94, 0xa0, 0x54, 0x55, 0x40, 0x45, 0x69, 0x9b, 0xda, 0xe1, 0x82, 0x18, 0x82, 0xa2, 0x7c, 0xcc,
+  0x8a, 0x80, 0x1b, 0xc2, 0xb1, 0xbd, 0xa3, 0x5f, 0x0a, 0x54, 0x0e, 0x0b, 0x9c, 0x34, 0x71, 0x78,
+  0xd1, 0xc4, 0xf0, 0x8c, 0x12, 0x86, 0x03, 0x18, 0x8b, 0xd3, 0x27, 0x3d, 0x95, 0x51, 0x5e, 0x75,
+  0x4a, 0xc5, 0x32, 0x77, 0x70, 0xf3, 0xd0, 0x39, 0x20, 0xc4, 0xbe, 0x8c, 0xf7, 0x85, 0x51, 0x65,
+  0x53, 0x8a, 0xd8, 0x22, 0x97, 0x40, 0x86, 0x41, 0x60, 0x8c, 0x9b, 0x0a, 0xc6, 0xb5, 0xed, 0x47,
+  0xc3, 0x29, 0x31, 0x3d, 0xe8, 0x59, 0x73, 0x87, 0xc7, 0xb5, 0x5e, 0xe2, 0x32, 0x7c, 0xda, 0x85,
+  0x0c, 0xd1, 0x15, 0x0b, 0x51, 0xfc, 0xd4, 0xba, 0xe2, 0x93, 0xa3, 0xee, 0x13, 0xc4, 0x10, 0x2c,
+  0xe7, 0x62, 0x53, 0x75, 0x9f, 0xe1, 0x55, 0xd9, 0x6e, 0x90, 0xbc, 0xea, 0x4c, 0x4f, 0x0d, 0x30,
+  0x0b, 0x4f, 0xfd, 0xf5, 0x56, 0x36, 0x9c, 0x1e, 0x83, 0x86, 0xbd, 0x0c, 0x85, 0x6a, 0x5c, 0x54,
+  0x30, 0x58, 0xb5, 0xe6, 0xee, 0xe2, 0xe4, 0xbc, 0xb3, 0xaf, 0xff, 0x8d, 0x2d, 0x9f, 0xd8, 0x05,
+  0xae, 0xef, 0x4e, 0xac, 0x0a, 0xd4, 0x80, 0xf1, 0x6c, 0x92, 0x0b, 0xbb, 0x28, 0x52, 0x84, 0x4d,
+  0xaa, 0xca, 0xac, 0x03, 0x90, 0x88, 0x6d, 0xf2, 0x48, 0x82, 0xd0, 0x26, 0xfe, 0x71, 0xbc, 0x86,
+  0xa3, 0x67, 0x33, 0xe4, 0xb4, 0xcc, 0x90, 0xd3, 0xce, 0xe3, 0x82, 0x41, 0x7f, 0x8d, 0x57, 0xca,
+  0x04, 0xd0, 0xce, 0xee, 0x4a, 0x90, 0x19, 0x74, 0x22, 0xb3, 0x2b, 0xdf, 0x8a, 0x26, 0x39, 0x98,
+  0x34, 0xc3, 0x51, 0x21, 0xaa, 0x90, 0x9a, 0x0b, 0x1a, 0xa1, 0x89, 0x64, 0x2e, 0x04, 0x06, 0xae,
+  0xa0, 0x7d, 0xcc, 0x83, 0x1b, 0xde, 0x98, 0xa9, 0x83, 0x2c, 0x78, 0x44, 0xe6, 0x94, 0x74, 0x18,
+  0xb1, 0x61, 0x82, 0xdd, 0x4b, 0xbd, 0x24, 0x08, 0xc7, 0xc1, 0x0d, 0xac, 0x50, 0x5b, 0xcd, 0x0c,
+  0x24, 0x09, 0xb8, 0xc1, 0xa6, 0xc0, 0x43, 0x08, 0xeb, 0xf7, 0x1c, 0x38, 0xf1, 0x0a, 0x17, 0x2a,
+  0xc7, 0x5e, 0x4e, 0x4b, 0xc4, 0x96, 0xad, 0xe0, 0x20, 0x27, 0x4d, 0x4a, 0x4e, 0x36, 0x19, 0xae,
+  0x20, 0x28, 0x55, 0x63, 0x72, 0xdb, 0xc1, 0x88, 0xa6, 0xd3, 0x79, 0x02, 0x05, 0xe0, 0x2a, 0x01,
+  0xc8, 0x5e, 0x49, 0xa3, 0xbb, 0x59, 0x11, 0xaf, 0x1e, 0x1b, 0x38, 0x23, 0xd4, 0x6b, 0x36, 0x06,
+  0xb2, 0xc6, 0x9d, 0xfb, 0x1e, 0xb5, 0x15, 0xc3, 0x40, 0x33, 0xa5, 0x72, 0x50, 0x4d, 0x1b, 0xd9,
+  0x71, 0x31, 0x62, 0x81, 0x5b, 0x4d, 0x2c, 0x2a, 0x94, 0x31, 0x45, 0xcc, 0xfc, 0x34, 0xa3, 0x3a,
+  0x10, 0x12, 0xdd, 0xd5, 0xc9, 0xf6, 0x84, 0x30, 0x1e, 0x48, 0xa0, 0x0a, 0x14, 0xc9, 0xc4, 0x1a,
+  0xb1, 0x40, 0xa1, 0x2a, 0x4f, 0xad, 0xf7, 0xcd, 0x9e, 0xc7, 0xec, 0xb2, 0xe2, 0xd8, 0xb5, 0x06,
+  0x77, 0x98, 0xd0, 0x2d, 0xbc, 0xd2, 0x31, 0xe6, 0x1d, 0x36, 0xc3, 0x5b, 0xb4, 0xd8, 0xba, 0x75,
+  0x1c, 0xe8, 0xc9, 0xed, 0xd5, 0x73, 0x91, 0xbe, 0x11, 0x1c, 0x9c, 0x7f, 0x89, 0xea, 0xdd, 0x6d,
+  0xa7, 0xdd, 0x40, 0xde, 0xd6, 0xe9, 0x4b, 0x44, 0x18, 0xd2, 0xc9, 0x6c, 0x8a, 0x54, 0xd3, 0x8f,
+  0x93, 0x03, 0x49, 0x87, 0x31, 0xb2, 0xdf, 0x62, 0x3d, 0x32, 0xfb, 0xcb, 0x17, 0xac, 0x48, 0x66,
+  0x43, 0x72, 0xbe, 0x72, 0x45, 0xf2, 0xcc, 0xae, 0x87, 0x7f, 0xcc, 0x4a, 0x68, 0xf6, 0x43, 0xf3,
+  0xdf, 0xda, 0x3f, 0x72, 0xc4, 0x79, 0x3e, 0xbd, 0x0d, 0x00, 0x00
+};
 
 // Autogenerated from wled00/data/settings_leds.htm, do not edit!!
-const char PAGE_settings_leds[] PROGMEM = R"=====(<!DOCTYPE html><html lang="en"><head><meta charset="utf-8"><meta 
-name="viewport" content="width=500"><title>LED Settings</title><script>
-var d=document,laprev=55;function H(){window.open("https://github.com/Aircoookie/WLED/wiki/Settings#led-settings")}function B(){window.open("/settings","_self")}function S(){GetV(),setABL()}function enABL(){var e=d.getElementById("able").checked;d.Sf.LA.value=e?laprev:0,d.getElementById("abl").style.display=e?"inline":"none",d.getElementById("psu2").style.display=e?"inline":"none",d.Sf.LA.value>0&&setABL()}function enLA(){var e=d.Sf.LAsel.value;d.Sf.LA.value=e,d.getElementById("LAdis").style.display=50==e?"inline":"none",UI()}function setABL(){switch(d.getElementById("able").checked=!0,d.Sf.LAsel.value=50,parseInt(d.Sf.LA.value)){case 0:d.getElementById("able").checked=!1,enABL();break;case 30:d.Sf.LAsel.value=30;break;case 35:d.Sf.LAsel.value=35;break;case 55:d.Sf.LAsel.value=55;break;case 255:d.Sf.LAsel.value=255;break;default:d.getElementById("LAdis").style.display="inline"}UI()}function UI(){var e=d.querySelectorAll(".wc"),l=e.length;for(i=0;i<l;i++)e[i].style.display=d.getElementById("rgbw").checked?"inline":"none";d.getElementById("ledwarning").style.display=d.Sf.LC.value>1e3?"inline":"none",d.getElementById("ampwarning").style.display=d.Sf.MA.value>7200?"inline":"none",255==d.Sf.LA.value?laprev=12:d.Sf.LA.value>0&&(laprev=d.Sf.LA.value);var n=Math.ceil((100+d.Sf.LC.value*laprev)/500)/2;n=n>5?Math.ceil(n):n;var t="",a=30==d.Sf.LAsel.value,s=255==d.Sf.LAsel.value;n<1.02&&!a&&!s?t="ESP 5V pin with 1A USB supply":(t+=a?"12V ":s?"WS2815 12V ":"5V ",t+=n,t+="A supply connected to LEDs");var u=Math.ceil((100+d.Sf.LC.value*laprev)/1500)/2,c="(for most effects, ~";c+=u=u>5?Math.ceil(u):u,c+="A is enough)<br>",d.getElementById("psu").innerHTML=t,d.getElementById("psu2").innerHTML=s?"":c}function GetV() {var d=document;
-%CSS%%SCSS%</head><body onload="S()"><form
- id="form_s" name="Sf" method="post"><div class="helpB"><button type="button" 
-onclick="H()">?</button></div><button type="button" onclick="B()">Back</button>
-<button type="submit">Save</button><hr><h2>LED setup</h2>LED count: <input 
-name="LC" type="number" min="1" max="1500" oninput="UI()" required><br><div 
-id="ledwarning" style="color:orange;display:none">
-&#9888; You might run into stability or lag issues.<br>
-Use less than 1000 LEDs per ESP for the best experience!<br></div><i>
-Recommended power supply for brightest white:</i><br><b><span id="psu">?</span>
-</b><br><span id="psu2"><br></span><br>Enable automatic brightness limiter: 
-<input type="checkbox" name="ABen" onchange="enABL()" id="able"><br><div 
-id="abl">Maximum Current: <input name="MA" type="number" min="250" max="65000" 
-oninput="UI()" required> mA<br><div id="ampwarning" 
-style="color:orange;display:none">
-&#9888; Your power supply provides high current.<br>
-To improve the safety of your setup,<br>please use thick cables,<br>
-multiple power injection points and a fuse!<br></div><i>
-Automatically limits brightness to stay close to the limit.<br>
-Keep at &lt;1A if powering LEDs directly from the ESP 5V pin!<br>
-If you are using an external power supply, enter its rating.<br>
-(Current estimated usage: <span class="pow">unknown</span>)</i><br><br>
-LED voltage (Max. current for a single LED):<br><select name="LAsel" 
-onchange="enLA()"><option value="55" selected="selected">5V default (55mA)
-</option><option value="35">5V efficient (35mA)</option><option value="30">
-12V (30mA)</option><option value="255">WS2815 (12mA)</option><option value="50">
-Custom</option></select><br><span id="LAdis" style="display:none">
-Custom max. current per LED: <input name="LA" type="number" min="0" max="255" 
-id="la" oninput="UI()" required> mA<br></span><i>
-Keep at default if you are unsure about your type of LEDs.</i><br></div><br>
-LEDs are 4-channel type (RGBW): <input type="checkbox" name="EW" 
-onchange="UI()" id="rgbw"><br><span class="wc">
-Auto-calculate white channel from RGB:<br><select name="AW"><option value="0">
-None</option><option value="1">Brighter</option><option value="2">Accurate
-</option><option value="3">Dual</option><option value="4">Legacy</option>
-</select><br></span>Color order: <select name="CO"><option value="0">GRB
-</option><option value="1">RGB</option><option value="2">BRG</option><option 
-value="3">RBG</option><option value="4">BGR</option><option value="5">GBR
-</option></select><h3>Defaults</h3>Turn LEDs on after power up/reset: <input 
-type="checkbox" name="BO"><br>Default brightness: <input name="CA" 
-type="number" min="0" max="255" required> (0-255)<br><br>Apply preset <input 
-name="BP" type="number" min="0" max="250" required> at boot (0 uses defaults)
-<br>- <i>or</i> -<br>Set current preset cycle setting as boot default: <input 
-type="checkbox" name="PC"><br><br>Use Gamma correction for color: <input 
-type="checkbox" name="GC"> (strongly recommended)<br>
-Use Gamma correction for brightness: <input type="checkbox" name="GB">
- (not recommended)<br><br>Brightness factor: <input name="BF" type="number" 
-min="1" max="255" required> %<h3>Transitions</h3>Crossfade: <input 
-type="checkbox" name="TF"><br>Transition Time: <input name="TD" maxlength="5" 
-size="2"> ms<br>Enable Palette transitions: <input type="checkbox" name="PF">
-<h3>Timed light</h3>Default Duration: <input name="TL" type="number" min="1" 
-max="255" required> min<br>Default Target brightness: <input name="TB" 
-type="number" min="0" max="255" required><br>Mode: <select name="TW"><option 
-value="0">Wait and set</option><option value="1">Fade</option><option value="2">
-Fade Color</option><option value="3">Sunrise</option></select><h3>Advanced</h3>
-Palette blending: <select name="PB"><option value="0">Linear (wrap if moving)
-</option><option value="1">Linear (always wrap)</option><option value="2">
-Linear (never wrap)</option><option value="3">None (not recommended)</option>
-</select><br>Reverse LED order (rotate 180): <input type="checkbox" name="RV">
-<br>Skip first LED: <input type="checkbox" name="SL"><hr><button type="button" 
-onclick="B()">Back</button><button type="submit">Save</button></form></body>
-</html>)=====";
-
+const uint16_t PAGE_settings_leds_length = 2571;
+const uint8_t PAGE_settings_leds[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x59, 0x5b, 0x6f, 0xdb, 0x38,
+  0x16, 0x7e, 0xd7, 0xaf, 0x60, 0x59, 0x4c, 0x20, 0x6f, 0x7d, 0x77, 0xdd, 0xcd, 0xca, 0x96, 0x03,
+  0x3b, 0x49, 0xd3, 0x62, 0x9d, 0x6d, 0x10, 0x67, 0x1a, 0x0c, 0x06, 0x83, 0x01, 0x2d, 0xd1, 0x36,
+  0x27, 0x12, 0xa9, 0x21, 0xa9, 0x38, 0xde, 0x20, 0xfb, 0xdb, 0xf7, 0x90, 0x94, 0xaf, 0xb1, 0x9d,
+  0x0e, 0x30, 0x0f, 0x8e, 0x2d, 0xe9, 0xdc, 0xcf, 0x77, 0x2e, 0x54, 0xba, 0xef, 0x2e, 0xbe, 0x9d,
+  0xdf, 0xfd, 0x72, 0x73, 0x89, 0x66, 0x3a, 0x4d, 0x7a, 0x5d, 0xf3, 0x17, 0x25, 0x84, 0x4f, 0x43,
+  0x4c, 0x39, 0x86, 0x6b, 0x4a, 0xe2, 0x5e, 0x37, 0xa5, 0x9a, 0xa0, 0x68, 0x46, 0xa4, 0xa2, 0x3a,
+  0xc4, 0xb9, 0x9e, 0x54, 0x4e, 0x71, 0x71, 0xd7, 0xe3, 0x24, 0xa5, 0x21, 0x7e, 0x64, 0x74, 0x9e,
+  0x09, 0xa9, 0x31, 0x8a, 0x04, 0xd7, 0x94, 0x03, 0xd9, 0x9c, 0xc5, 0x7a, 0x16, 0xb6, 0xeb, 0x75,
+  0x20, 0xd5, 0x4c, 0x27, 0xb4, 0x37, 0xbc, 0xbc, 0x40, 0x23, 0xaa, 0x35, 0xe3, 0x53, 0xd5, 0xad,
+  0xb9, 0x7b, 0x5d, 0x15, 0x49, 0x96, 0xe9, 0x9e, 0xf7, 0x48, 0x24, 0x8a, 0xc3, 0x58, 0x44, 0x79,
+  0x0a, 0xec, 0xe5, 0x84, 0x64, 0x92, 0x3e, 0x86, 0xed, 0x76, 0x67, 0x92, 0xf3, 0x48, 0x33, 0xc1,
+  0xd1, 0x17, 0xbf, 0xf4, 0x3c, 0x67, 0x3c, 0x16, 0xf3, 0xaa, 0xc8, 0x28, 0xf7, 0xf1, 0x4c, 0xeb,
+  0x4c, 0x05, 0xb5, 0xda, 0x94, 0xe9, 0x59, 0x3e, 0xae, 0x46, 0x22, 0xad, 0xf5, 0x99, 0x8c, 0x84,
+  0x10, 0x0f, 0x8c, 0xd6, 0xee, 0x41, 0x5d, 0x6d, 0xce, 0x1e, 0x58, 0x6d, 0xa9, 0xf3, 0x7d, 0x42,
+  0xe3, 0x8a, 0x2a, 0x2e, 0x70, 0xe9, 0x65, 0x25, 0x79, 0xb0, 0x2b, 0xb9, 0xb6, 0xa2, 0x2a, 0xe3,
+  0xdf, 0x15, 0x4d, 0x26, 0x9b, 0xd4, 0x23, 0xa0, 0xbe, 0xa2, 0xfa, 0xbb, 0x5f, 0x2a, 0x03, 0x59,
+  0x7f, 0x30, 0xf4, 0x37, 0x1e, 0x52, 0x6e, 0x6f, 0x3c, 0x1b, 0x77, 0x68, 0x18, 0x57, 0xa7, 0x54,
+  0x5f, 0x26, 0xd4, 0xb8, 0x34, 0x58, 0x7c, 0x8d, 0x7d, 0x4c, 0xc6, 0x09, 0xc5, 0xa5, 0x6a, 0x34,
+  0xa3, 0xd1, 0x03, 0x8d, 0x3b, 0x71, 0x75, 0x34, 0xa9, 0x0e, 0xfb, 0xd5, 0x47, 0x92, 0xe4, 0x34,
+  0xa4, 0x67, 0xce, 0xed, 0xa0, 0x5e, 0xde, 0xcb, 0x09, 0x8c, 0x4a, 0x2f, 0x12, 0x5a, 0x8d, 0x99,
+  0xca, 0x12, 0xb2, 0x00, 0x06, 0xcc, 0x78, 0xc2, 0x38, 0xc5, 0x01, 0xe6, 0x02, 0xbe, 0xf6, 0xf0,
+  0x65, 0x2a, 0x6f, 0xfe, 0x10, 0xe3, 0x86, 0x25, 0xbd, 0xfa, 0xc9, 0xc9, 0x3e, 0xdf, 0x86, 0xfd,
+  0x0d, 0xd7, 0x2c, 0x3d, 0x04, 0xc7, 0xb1, 0xec, 0xba, 0xb2, 0xc7, 0x92, 0x61, 0x1f, 0xd4, 0xbf,
+  0x32, 0xa5, 0x5d, 0x0f, 0xf7, 0x98, 0xf3, 0xf3, 0xd7, 0x4d, 0xcd, 0x4b, 0x5b, 0x9e, 0xd5, 0x9c,
+  0xe9, 0x68, 0xe6, 0xbf, 0x15, 0xd7, 0xf0, 0x5d, 0xbd, 0xbc, 0x6b, 0x20, 0x28, 0x2a, 0x67, 0x06,
+  0xc2, 0x5f, 0xb9, 0xf6, 0xb7, 0x8c, 0x2d, 0x95, 0x9e, 0x23, 0xa2, 0x28, 0xaa, 0x07, 0x6f, 0xcb,
+  0x6d, 0x94, 0x8b, 0x0c, 0x77, 0xc6, 0x92, 0x92, 0x87, 0x8e, 0x65, 0x6c, 0x19, 0xce, 0x1d, 0x6d,
+  0xad, 0xfa, 0x16, 0x45, 0x7b, 0x0f, 0x45, 0x7b, 0x93, 0xa2, 0xbd, 0x87, 0xa2, 0xbd, 0x45, 0xd1,
+  0xdc, 0x47, 0xd2, 0x5c, 0xd1, 0xc4, 0x74, 0x42, 0xf2, 0x44, 0x07, 0x3f, 0x1a, 0xf7, 0x65, 0xc4,
+  0x5f, 0xb6, 0x43, 0x6d, 0xae, 0x56, 0x29, 0xfe, 0x33, 0xa7, 0x72, 0x31, 0xa2, 0x09, 0x8d, 0xb4,
+  0x90, 0xfd, 0x24, 0xf1, 0x71, 0x75, 0x1e, 0xe1, 0x52, 0x39, 0x09, 0x69, 0x35, 0xa1, 0x7c, 0xaa,
+  0x67, 0x9d, 0x89, 0x90, 0x3e, 0x0b, 0xeb, 0x1d, 0xd6, 0x4d, 0x3a, 0xec, 0xc3, 0x87, 0x12, 0xfd,
+  0x95, 0xfd, 0xb6, 0xa3, 0xe9, 0xb5, 0x45, 0x72, 0x3a, 0x9e, 0xaf, 0xa3, 0xba, 0x9b, 0xfc, 0xce,
+  0x6b, 0x06, 0xa8, 0xdc, 0x39, 0x91, 0x1c, 0x4a, 0xf2, 0x95, 0x1f, 0x2e, 0x24, 0xe7, 0x05, 0x70,
+  0x1b, 0xb4, 0xf5, 0x03, 0x35, 0x41, 0xd2, 0xec, 0xa8, 0xb8, 0xeb, 0x65, 0x1d, 0xfc, 0xb3, 0x59,
+  0xaf, 0xbf, 0x92, 0x07, 0x31, 0x0f, 0xc3, 0x2d, 0x04, 0x15, 0x75, 0x1b, 0x36, 0x9a, 0xc1, 0xab,
+  0x3a, 0xf2, 0x8b, 0x67, 0xdb, 0x90, 0xeb, 0x98, 0x10, 0xf3, 0xf0, 0x9a, 0xe8, 0x59, 0x35, 0xa2,
+  0x2c, 0xf1, 0xfd, 0x46, 0xbd, 0xfe, 0x61, 0xcb, 0x97, 0x7f, 0x38, 0xc6, 0x52, 0x0d, 0x7a, 0x68,
+  0xa9, 0xd6, 0xec, 0xf0, 0x90, 0xf7, 0xda, 0x67, 0x6b, 0x0e, 0x5e, 0x0a, 0xb8, 0x15, 0x03, 0xcd,
+  0x16, 0x97, 0x09, 0x20, 0x2e, 0x7c, 0x55, 0x95, 0x65, 0x15, 0x6e, 0x5a, 0xbb, 0xae, 0x56, 0xde,
+  0x6d, 0x54, 0xeb, 0xcd, 0x93, 0x93, 0x77, 0x04, 0x3e, 0xea, 0x0c, 0x44, 0x5c, 0x8e, 0x6e, 0x50,
+  0xfb, 0x3b, 0xca, 0x18, 0x47, 0x50, 0x64, 0x33, 0xd4, 0xe8, 0xa3, 0x9f, 0x47, 0x03, 0xa4, 0xf2,
+  0x2c, 0x4b, 0x16, 0x38, 0xf0, 0xf5, 0x87, 0x90, 0x9c, 0xe1, 0x46, 0xf3, 0x3b, 0xc2, 0x81, 0x3a,
+  0xc3, 0xf7, 0xa3, 0xe6, 0x69, 0xa3, 0x8d, 0xdc, 0x35, 0x06, 0x46, 0x5c, 0x06, 0x0a, 0x6e, 0xfe,
+  0xe0, 0x7e, 0xc1, 0x65, 0x86, 0x01, 0x07, 0xec, 0xd0, 0x18, 0x69, 0x81, 0xa0, 0x1f, 0x03, 0x0a,
+  0xad, 0xc5, 0xf9, 0x8f, 0x39, 0xde, 0x70, 0x9e, 0x97, 0xa3, 0x10, 0xfb, 0x80, 0x33, 0x94, 0x0a,
+  0xa5, 0x11, 0x9d, 0x4c, 0x40, 0xa4, 0x2a, 0xa3, 0xff, 0xe1, 0x4e, 0xf4, 0x21, 0xcc, 0xc3, 0x7c,
+  0x2b, 0x2a, 0x79, 0x29, 0xc8, 0xcb, 0x91, 0x35, 0x82, 0x29, 0x68, 0x59, 0x22, 0x9f, 0xce, 0x4a,
+  0xdd, 0xb1, 0xec, 0x1d, 0xe8, 0x8d, 0x00, 0x00, 0x06, 0x46, 0xca, 0x2f, 0x77, 0xd7, 0xc3, 0x50,
+  0x1f, 0xee, 0x9f, 0x6b, 0x22, 0x70, 0x1e, 0x07, 0xd1, 0x4b, 0xb7, 0x56, 0x8c, 0xae, 0x62, 0x84,
+  0x21, 0x25, 0xc1, 0xce, 0xd5, 0xe4, 0xa8, 0xa9, 0xea, 0x1f, 0xea, 0x2c, 0x0b, 0x9b, 0x30, 0xfe,
+  0xd6, 0x94, 0x06, 0x6a, 0xbd, 0xb1, 0x88, 0x17, 0xcf, 0x13, 0x98, 0x93, 0x95, 0x09, 0x49, 0x59,
+  0xb2, 0x08, 0xbe, 0x53, 0x19, 0x13, 0x4e, 0xca, 0x8a, 0x70, 0x05, 0x03, 0x4a, 0xb2, 0x49, 0x47,
+  0xd3, 0x27, 0x5d, 0x21, 0x09, 0x9b, 0xf2, 0x20, 0x02, 0x53, 0xa8, 0xec, 0x8c, 0x49, 0xf4, 0x30,
+  0x95, 0x22, 0xe7, 0x71, 0xf0, 0xbe, 0xd9, 0x6c, 0x76, 0x22, 0x91, 0x08, 0x19, 0xbc, 0x9f, 0x4c,
+  0x26, 0x1d, 0x83, 0xce, 0xca, 0x8c, 0xb2, 0xe9, 0x4c, 0x07, 0x00, 0xd8, 0x9f, 0x3a, 0x29, 0x91,
+  0x53, 0xc6, 0x83, 0xfa, 0xcb, 0x4c, 0x3e, 0x8f, 0x85, 0x8c, 0xa9, 0xac, 0x14, 0xe4, 0x9f, 0x3e,
+  0x7d, 0x7a, 0x19, 0xe7, 0x5a, 0x0b, 0xfe, 0xbc, 0x29, 0xb0, 0xd5, 0x6a, 0x6d, 0x0a, 0x7c, 0xc3,
+  0x38, 0x27, 0x32, 0xa8, 0xb6, 0xa2, 0x19, 0x52, 0x22, 0x61, 0x31, 0xb2, 0x02, 0x8a, 0x12, 0x0a,
+  0x5c, 0xb9, 0x54, 0xc6, 0x89, 0x88, 0x1e, 0x9c, 0x28, 0xc5, 0xfe, 0x4b, 0xc1, 0xb2, 0xec, 0x69,
+  0x69, 0xd9, 0xe9, 0xea, 0x67, 0x45, 0x8b, 0x2c, 0x68, 0x34, 0xb3, 0xa7, 0x97, 0xea, 0x8c, 0x26,
+  0xd9, 0xe0, 0x79, 0xc3, 0xf3, 0x84, 0x4e, 0x74, 0x27, 0x13, 0x8a, 0x99, 0xce, 0x14, 0x90, 0x31,
+  0xe8, 0xca, 0x35, 0xed, 0xd8, 0xcd, 0x22, 0xf8, 0x04, 0xe2, 0x5e, 0x18, 0xcf, 0x72, 0xfd, 0x37,
+  0x78, 0xd2, 0xde, 0xf2, 0xc4, 0x89, 0xfd, 0x55, 0x2f, 0x32, 0x1a, 0xf2, 0x3c, 0x1d, 0x53, 0xf9,
+  0xdb, 0xb3, 0x53, 0xfa, 0x91, 0xa6, 0x2f, 0xca, 0xf6, 0xc3, 0xbf, 0x5f, 0xa9, 0x8e, 0x9f, 0x33,
+  0x12, 0xc7, 0x00, 0x9e, 0xc0, 0x86, 0x23, 0x6e, 0x2f, 0x95, 0x56, 0xdb, 0x34, 0x7d, 0xc7, 0x52,
+  0xb3, 0x60, 0x11, 0xae, 0x0d, 0xf2, 0x2c, 0x8e, 0xba, 0x35, 0xb7, 0x9e, 0x19, 0x3c, 0x21, 0xc1,
+  0x13, 0x41, 0xe2, 0x10, 0xc3, 0x76, 0x02, 0x88, 0x83, 0x6a, 0x49, 0x3d, 0xc4, 0xe0, 0xda, 0xfc,
+  0xfa, 0x5d, 0x61, 0xe4, 0xf6, 0xb4, 0xd1, 0x04, 0x23, 0xd8, 0xdb, 0x66, 0x02, 0x9e, 0x40, 0x60,
+  0x35, 0x90, 0xc6, 0xec, 0x11, 0x45, 0x09, 0x51, 0x2a, 0xc4, 0x36, 0x01, 0x70, 0xcb, 0x01, 0x04,
+  0x59, 0xff, 0xb1, 0xbb, 0xc0, 0xc8, 0x13, 0x3c, 0x4a, 0x58, 0xf4, 0x10, 0xe2, 0x2f, 0x46, 0xc5,
+  0x59, 0xb7, 0xe6, 0x9e, 0x80, 0x19, 0x20, 0xe2, 0x00, 0xd3, 0x8a, 0x67, 0x60, 0x78, 0x06, 0x10,
+  0xb2, 0x15, 0x9b, 0xb7, 0xcd, 0xa1, 0xf2, 0x71, 0xca, 0xc0, 0x9e, 0x11, 0x79, 0xa4, 0x6b, 0xd1,
+  0x33, 0x09, 0x9f, 0xa6, 0xdd, 0x1c, 0xa1, 0xb0, 0xf2, 0x0c, 0x5c, 0x76, 0x57, 0x11, 0x04, 0x5e,
+  0x07, 0xa8, 0x6b, 0x33, 0xb5, 0xdc, 0x42, 0x87, 0xe7, 0xb8, 0x90, 0xe6, 0xb2, 0x06, 0xbe, 0x32,
+  0x1e, 0xe2, 0x06, 0x7c, 0x93, 0x27, 0xf8, 0x36, 0xcb, 0x28, 0x98, 0x64, 0x79, 0x42, 0x6c, 0x26,
+  0x1d, 0x46, 0x92, 0xfe, 0x99, 0x33, 0x49, 0x4d, 0x18, 0xa5, 0x0b, 0x86, 0x67, 0xc2, 0xb6, 0x31,
+  0x70, 0x90, 0x8d, 0x76, 0x88, 0x5d, 0x82, 0x85, 0x84, 0xed, 0x98, 0xae, 0xb0, 0x6e, 0x27, 0x42,
+  0xcf, 0x3b, 0x79, 0xff, 0xaf, 0xd3, 0xd3, 0xd3, 0x0e, 0xfa, 0x45, 0xe4, 0xa0, 0x13, 0xea, 0x10,
+  0xc9, 0x9c, 0x23, 0xc6, 0xa1, 0xed, 0x29, 0x4d, 0xc6, 0x2c, 0x61, 0x1a, 0x52, 0x24, 0x61, 0xb5,
+  0x9e, 0x42, 0x5b, 0x52, 0x39, 0x55, 0x55, 0xa3, 0xcf, 0xfb, 0x19, 0xe6, 0x7a, 0x42, 0x95, 0x42,
+  0x7a, 0x46, 0x38, 0x82, 0x4e, 0x58, 0xb7, 0x6d, 0x12, 0x65, 0x54, 0x22, 0xd3, 0x90, 0x4d, 0xd7,
+  0xd3, 0x33, 0x8a, 0xc6, 0xd4, 0x74, 0xbe, 0x27, 0xb8, 0xcd, 0x28, 0x8f, 0xe8, 0x3b, 0x6b, 0xac,
+  0x8b, 0x3b, 0xeb, 0x79, 0xb7, 0x14, 0x76, 0x5f, 0xe8, 0x58, 0x31, 0x34, 0xda, 0x4c, 0xcc, 0x81,
+  0xb7, 0xe8, 0xbf, 0x86, 0x7d, 0x2c, 0x8d, 0x3d, 0x86, 0x7f, 0x3e, 0x63, 0x9a, 0x06, 0xdd, 0x1a,
+  0x73, 0xbe, 0x8e, 0xa1, 0x1f, 0x65, 0xa0, 0xd5, 0xb8, 0x6b, 0x1a, 0xa1, 0x49, 0xa9, 0xb9, 0x01,
+  0x99, 0xa9, 0x8d, 0x1d, 0xc9, 0xe6, 0x73, 0xd3, 0xc8, 0xac, 0x56, 0x4b, 0x63, 0x7e, 0x5e, 0x72,
+  0xb3, 0x1d, 0x21, 0x92, 0x6b, 0x91, 0x12, 0xcd, 0xa2, 0x42, 0x15, 0x37, 0xfe, 0x24, 0x0c, 0xb2,
+  0x09, 0x20, 0x47, 0x5e, 0x91, 0x22, 0x97, 0x17, 0x3b, 0xf1, 0xc7, 0xe2, 0x69, 0x89, 0xc7, 0xfe,
+  0x80, 0x3a, 0x94, 0xcc, 0x4c, 0x54, 0xcd, 0xa1, 0xc3, 0x2e, 0x57, 0xd8, 0x2a, 0xb5, 0xbb, 0xd7,
+  0x4e, 0x5e, 0xcc, 0x16, 0xdc, 0xbb, 0x26, 0x4f, 0x2c, 0xcd, 0x53, 0x74, 0x9e, 0x4b, 0x49, 0x37,
+  0x60, 0xe0, 0x64, 0x5e, 0xf7, 0xf7, 0xa2, 0xa0, 0xd9, 0xae, 0x17, 0x38, 0xf8, 0x04, 0x38, 0xa8,
+  0x5b, 0x40, 0xef, 0x47, 0x02, 0x4a, 0xfb, 0x2b, 0xa5, 0x56, 0xe7, 0x7a, 0x5b, 0x40, 0xde, 0x5f,
+  0x03, 0x83, 0xdc, 0xce, 0x47, 0x26, 0xc5, 0x23, 0x8b, 0xa9, 0x42, 0x33, 0x08, 0x14, 0x8a, 0x9c,
+  0xf9, 0x0e, 0x09, 0x77, 0x02, 0x41, 0x85, 0xc3, 0x73, 0x6a, 0x13, 0xae, 0xc8, 0x84, 0x1a, 0xc8,
+  0x4c, 0xd0, 0xc2, 0x48, 0xb1, 0xe0, 0x2f, 0x1b, 0xc2, 0x2c, 0xa1, 0x66, 0x19, 0xcc, 0x95, 0xa1,
+  0x83, 0xd2, 0x42, 0x91, 0x09, 0x93, 0xb2, 0xcf, 0xbc, 0x14, 0x16, 0x40, 0x06, 0x14, 0x85, 0x56,
+  0xc6, 0xff, 0xa0, 0x6e, 0xab, 0xcb, 0x04, 0x60, 0x51, 0x21, 0xc2, 0x63, 0x44, 0xd0, 0x04, 0x98,
+  0x77, 0x10, 0xd4, 0x5f, 0xe6, 0x90, 0x24, 0x60, 0xa6, 0x4d, 0x9e, 0xda, 0x4c, 0xa7, 0xc3, 0x31,
+  0x0c, 0xf4, 0x44, 0x18, 0xc5, 0xc2, 0xda, 0x68, 0xc9, 0x9c, 0xf5, 0xff, 0xa6, 0x34, 0x43, 0x44,
+  0xa3, 0x93, 0x44, 0x77, 0x60, 0x71, 0x60, 0x13, 0x67, 0x01, 0x84, 0xcc, 0xe1, 0x39, 0x86, 0xc0,
+  0x46, 0xda, 0x20, 0x52, 0x8a, 0xd4, 0x32, 0xaf, 0xd7, 0x0d, 0x6b, 0x8a, 0xf7, 0xd5, 0x7a, 0x8a,
+  0x88, 0x34, 0xbe, 0x19, 0x3e, 0x40, 0x1e, 0x4c, 0x02, 0x2a, 0x39, 0x49, 0xb6, 0x82, 0x58, 0x46,
+  0x76, 0x1e, 0x22, 0x63, 0xa1, 0x24, 0x66, 0xd6, 0x3a, 0x13, 0xfc, 0x02, 0x0d, 0x08, 0xa0, 0xce,
+  0xc0, 0x17, 0xa8, 0x85, 0x5c, 0x91, 0x29, 0x05, 0x74, 0x58, 0x18, 0x17, 0x3d, 0x0e, 0x44, 0xe1,
+  0x5e, 0xce, 0x1f, 0xb8, 0x98, 0xf3, 0x02, 0xcb, 0xa5, 0x75, 0x49, 0x80, 0x1c, 0xd3, 0x5d, 0x1e,
+  0x45, 0xa2, 0x81, 0x15, 0xf9, 0x80, 0xb4, 0xea, 0x32, 0x4f, 0xb6, 0x9a, 0x08, 0x32, 0xc6, 0x41,
+  0x84, 0x81, 0xac, 0x14, 0xb8, 0x22, 0xb1, 0xf3, 0xa0, 0x00, 0x9f, 0xdd, 0xb1, 0x5c, 0xb3, 0x5c,
+  0x41, 0xda, 0x9c, 0x9a, 0x00, 0xc7, 0x22, 0xb3, 0xa9, 0x70, 0x7b, 0x3b, 0x6e, 0xb7, 0xa1, 0xb1,
+  0x58, 0x4e, 0x38, 0x56, 0xe0, 0xe5, 0x2f, 0xdc, 0x83, 0x98, 0x14, 0x9b, 0x3c, 0xf2, 0xdb, 0xed,
+  0xb4, 0x5f, 0x82, 0x6a, 0x74, 0x9c, 0xbb, 0x12, 0x5a, 0x6d, 0x4b, 0x0d, 0xfb, 0x10, 0x8b, 0x98,
+  0xb1, 0xcf, 0x6f, 0x19, 0xfa, 0x83, 0xe4, 0x70, 0x10, 0xf7, 0xcc, 0xba, 0xe6, 0xb7, 0xea, 0x47,
+  0xc8, 0x60, 0x5d, 0xc4, 0xbd, 0x62, 0xb9, 0xf3, 0x1b, 0xcd, 0x23, 0x94, 0x6d, 0x23, 0xf0, 0x3c,
+  0x57, 0x80, 0x9c, 0x35, 0x49, 0xcd, 0x79, 0xb2, 0xd3, 0x3e, 0xdc, 0x09, 0x64, 0xd9, 0x48, 0x77,
+  0xca, 0xc5, 0x89, 0x30, 0xa5, 0xb9, 0x0e, 0xb5, 0xe9, 0x7f, 0x10, 0xe1, 0x9d, 0xca, 0x1e, 0xee,
+  0xaf, 0xec, 0x65, 0x5d, 0x1b, 0xd3, 0x8b, 0xee, 0x4d, 0x0e, 0xf7, 0xf9, 0x65, 0x75, 0x17, 0x7d,
+  0x8c, 0xad, 0xc1, 0xbb, 0x8c, 0x3b, 0xdb, 0x80, 0x22, 0x57, 0x39, 0x7c, 0x91, 0xb1, 0x00, 0x23,
+  0x6c, 0x25, 0x1a, 0xfd, 0xa6, 0x2c, 0x0d, 0xac, 0xab, 0x2b, 0xe0, 0x14, 0x23, 0xd0, 0xc1, 0x47,
+  0x59, 0xd6, 0x8f, 0x15, 0x83, 0x00, 0x4e, 0x13, 0xc7, 0xe2, 0xdf, 0x5e, 0x0d, 0xee, 0x4b, 0x2b,
+  0x87, 0xf6, 0xb7, 0xc3, 0xcb, 0xfb, 0x2d, 0xe8, 0x38, 0xcb, 0x8d, 0x43, 0xf6, 0xc0, 0xb4, 0x11,
+  0xd4, 0x02, 0xcc, 0x70, 0x18, 0x73, 0xb5, 0x5b, 0x81, 0xc2, 0x8d, 0xf2, 0x04, 0x50, 0xef, 0xba,
+  0x3c, 0x5a, 0xea, 0xb6, 0xf5, 0x06, 0xaa, 0xf7, 0x40, 0xb5, 0x7f, 0xff, 0x0a, 0x94, 0x26, 0xa3,
+  0xff, 0x81, 0xac, 0x1c, 0x4a, 0x79, 0x03, 0x66, 0xb8, 0x1b, 0x27, 0xf2, 0x20, 0x7e, 0x70, 0xaf,
+  0x1f, 0x41, 0x1a, 0xc1, 0x94, 0xc3, 0xc8, 0xc5, 0xbd, 0x8b, 0x9c, 0x24, 0x87, 0x1e, 0x7f, 0xc4,
+  0xbd, 0x21, 0x9d, 0x92, 0x68, 0xb1, 0x22, 0xf0, 0xb6, 0x71, 0xe5, 0x52, 0x77, 0x6e, 0x5a, 0x30,
+  0x72, 0xbb, 0x14, 0xda, 0x76, 0xed, 0xfc, 0xdb, 0x3e, 0xd7, 0xae, 0x6e, 0x07, 0xde, 0x11, 0xcf,
+  0x20, 0x4a, 0x47, 0x9c, 0x1a, 0xdc, 0x5e, 0xbd, 0x7a, 0xea, 0xad, 0xfd, 0xb9, 0x1d, 0x5c, 0x1d,
+  0x71, 0x67, 0x70, 0x75, 0x7b, 0xb0, 0x8a, 0xc0, 0xae, 0xc1, 0xad, 0xb7, 0xa7, 0x82, 0x66, 0xad,
+  0xde, 0x85, 0x43, 0xa4, 0x82, 0xb5, 0xa7, 0xd5, 0xbb, 0xcb, 0x25, 0x77, 0xdd, 0x14, 0xb8, 0xc9,
+  0xc4, 0xf4, 0x40, 0xd7, 0x17, 0xf3, 0xac, 0x26, 0x29, 0x4c, 0x88, 0xf5, 0x3a, 0xb4, 0x1f, 0x5d,
+  0x83, 0x6f, 0x0e, 0x42, 0x85, 0xd4, 0x8d, 0xfe, 0xbe, 0x53, 0x67, 0xe7, 0x50, 0x67, 0xde, 0x5b,
+  0x85, 0xb6, 0x2e, 0x28, 0xbf, 0x5e, 0x81, 0x3b, 0xa5, 0x65, 0x07, 0xed, 0x17, 0xa3, 0xce, 0x98,
+  0xb4, 0xb3, 0xa0, 0x0d, 0x6e, 0xde, 0x28, 0xe0, 0xfa, 0xa6, 0x5c, 0x28, 0xc9, 0xb1, 0x10, 0xd0,
+  0xd7, 0xea, 0x66, 0xdc, 0xa9, 0x65, 0x7d, 0x2a, 0x68, 0x89, 0xa0, 0xa6, 0x02, 0xb2, 0x7b, 0x42,
+  0x9a, 0x12, 0x44, 0x15, 0x73, 0x63, 0x04, 0xea, 0x56, 0xfd, 0xc3, 0x69, 0x8f, 0x16, 0x11, 0xb4,
+  0xea, 0xe2, 0x48, 0x86, 0x88, 0x72, 0xf2, 0x96, 0x6f, 0x4a, 0xde, 0x08, 0xd7, 0xcd, 0x39, 0x5e,
+  0x4d, 0x05, 0xb3, 0xa7, 0x5d, 0x91, 0x34, 0x25, 0xb0, 0x78, 0x4a, 0x59, 0x0c, 0x55, 0x33, 0x0f,
+  0xdc, 0x1e, 0xf0, 0x86, 0xa4, 0x2b, 0x90, 0x84, 0x7c, 0xa5, 0xa5, 0x80, 0xd1, 0xb1, 0x00, 0x0f,
+  0x57, 0xeb, 0x5a, 0x69, 0xb5, 0x05, 0xee, 0x95, 0xbe, 0x27, 0x43, 0x07, 0x34, 0xc0, 0xda, 0xee,
+  0x21, 0x9f, 0x83, 0x77, 0xbb, 0xd2, 0xcd, 0x67, 0xb0, 0x9e, 0xe4, 0x13, 0x62, 0xde, 0xe5, 0xec,
+  0x24, 0x7c, 0xf0, 0x79, 0x37, 0x2f, 0xde, 0xd6, 0xe6, 0xbc, 0x93, 0xf0, 0x9f, 0x0c, 0x36, 0xef,
+  0x60, 0xf7, 0x71, 0x27, 0x33, 0x07, 0xcf, 0x73, 0x29, 0x94, 0x9a, 0x90, 0x98, 0xbe, 0x15, 0x8d,
+  0xbb, 0xcf, 0x2e, 0xae, 0x6b, 0x01, 0xe8, 0x8e, 0xa5, 0x74, 0xc7, 0xa4, 0xbb, 0x0b, 0xab, 0xdb,
+  0xbd, 0x65, 0x32, 0x65, 0x02, 0xab, 0x17, 0x9c, 0x22, 0x6d, 0x2d, 0xa2, 0x54, 0x6d, 0xec, 0x9f,
+  0x37, 0x24, 0x81, 0x04, 0xc3, 0x56, 0xb2, 0x36, 0xe8, 0x8d, 0x68, 0xdd, 0x80, 0x05, 0x9e, 0xf5,
+  0x01, 0xf4, 0xc6, 0xb0, 0xc7, 0x40, 0x70, 0xac, 0x0f, 0xcb, 0xca, 0xb8, 0x30, 0xfd, 0xcb, 0x9c,
+  0x39, 0x77, 0x6c, 0x1a, 0x1e, 0x3a, 0x5f, 0x78, 0xfb, 0xc2, 0x04, 0x0f, 0x37, 0xcb, 0xed, 0x0e,
+  0xce, 0xbb, 0xf4, 0x48, 0xd5, 0xdd, 0x0d, 0xfe, 0x4a, 0xd5, 0x19, 0xc9, 0xd7, 0xc2, 0x46, 0x7b,
+  0xab, 0xf5, 0xdd, 0x6d, 0x74, 0x75, 0x6f, 0xdd, 0xfb, 0xee, 0x09, 0xd3, 0x76, 0xfd, 0x83, 0x62,
+  0x38, 0xd2, 0x03, 0x3f, 0x43, 0xfe, 0x8e, 0x34, 0x41, 0xcf, 0x3c, 0x47, 0xb6, 0xf1, 0x1e, 0xe9,
+  0xed, 0xa3, 0x9c, 0x4b, 0xa6, 0xe8, 0xfe, 0x96, 0xd6, 0x8f, 0x1f, 0x09, 0x9c, 0x60, 0x62, 0x1b,
+  0x6f, 0x6f, 0x99, 0x3b, 0xc8, 0x23, 0xb7, 0x27, 0xdf, 0x1d, 0x6f, 0x6e, 0x06, 0xfb, 0x1a, 0xf9,
+  0x90, 0x71, 0x4a, 0x24, 0xf2, 0xe7, 0x92, 0x64, 0x66, 0x5a, 0xa7, 0xb0, 0x55, 0xf3, 0x69, 0xe9,
+  0x58, 0x73, 0x5f, 0xb2, 0x90, 0x64, 0x4e, 0x16, 0x0a, 0x19, 0xce, 0xd2, 0x31, 0x47, 0x97, 0xf4,
+  0x9c, 0x3e, 0x42, 0x87, 0x3d, 0x4a, 0x0e, 0x1e, 0x9b, 0x99, 0xb9, 0xa7, 0xfa, 0xf6, 0x8f, 0xaf,
+  0x5b, 0x23, 0x52, 0xd9, 0x0d, 0xd2, 0x4d, 0x2f, 0xe4, 0x4b, 0xa1, 0xcd, 0xe8, 0x6e, 0x9c, 0xd6,
+  0xdf, 0xda, 0x10, 0x6e, 0xbf, 0x1b, 0xe8, 0x9a, 0x6e, 0xf7, 0xc0, 0x32, 0x34, 0x61, 0x12, 0xce,
+  0x75, 0x9b, 0x8b, 0xd2, 0x7e, 0xae, 0xd1, 0x10, 0xbb, 0xb3, 0xf4, 0x1b, 0x27, 0xfb, 0xd7, 0xa7,
+  0xf4, 0x1f, 0x39, 0xa4, 0xd7, 0xcc, 0x3b, 0x06, 0xf8, 0x32, 0xef, 0x21, 0x8c, 0xaf, 0xf6, 0x5f,
+  0x49, 0xff, 0x07, 0x05, 0xfe, 0x06, 0x44, 0x5a, 0x1a, 0x00, 0x00
+};
 
 #ifdef WLED_ENABLE_DMX
-
 // Autogenerated from wled00/data/settings_dmx.htm, do not edit!!
-const char PAGE_settings_dmx[] PROGMEM = R"=====(<!DOCTYPE html><html lang="en"><head><meta name="viewport" content="width=500">
-<meta charset="utf-8"><title>DMX Settings</title><script>
-function GCH(n){for(d=document,d.getElementById("dmxchannels").innerHTML+="",i=0;i<n;i++)d.getElementById("dmxchannels").innerHTML+="<span id=CH"+(i+1)+"s >Channel "+(i+1)+": <select name=CH"+(i+1)+' id="CH'+(i+1)+'"><option value=0>Set to 0</option><option value=1>Red</option><option value=2>Green</option><option value=3>Blue</option><option value=4>White</option><option value=5>Shutter (Brightness)</option><option value=6>Set to 255</option></select></span><br />\n'}function mMap(){for(d=document,numCh=document.Sf.CN.value,numGap=document.Sf.CG.value,parseInt(numCh)>parseInt(numGap)?d.getElementById("gapwarning").style.display="block":d.getElementById("gapwarning").style.display="none",i=0;i<15;i++)i>=numCh?(d.getElementById("CH"+(i+1)+"s").style.opacity="0.5",d.getElementById("CH"+(i+1)).disabled=!0):(d.getElementById("CH"+(i+1)+"s").style.opacity="1",d.getElementById("CH"+(i+1)).disabled=!1)}function S(){GCH(15),GetV(),mMap()}function H(){window.open("https://github.com/Aircoookie/WLED/wiki/DMX")}function B(){window.history.back()}function GetV() {var d=document;
-%CSS%%SCSS%</head><body onload="S()"><form
- id="form_s" name="Sf" method="post"><div class="helpB"><button type="button" 
-onclick="H()">?</button></div><button type="button" onclick="B()">Back</button>
-<button type="submit">Save</button><hr><h2>
-Imma firin ma lazer (if it has DMX support)</h2>Proxy Universe <input name="PU" 
-type="number" min="0" max="63999" required> from E1.31 to DMX (0=disabled)<br>
-<i>This will disable the LED data output to DMX configurable below</i><br><br>
-<i>Number of fixtures is taken from LED config page</i><br>
-Channels per fixture (15 max): <input type="number" min="1" max="15" name="CN" 
-maxlength="2" onchange="mMap()"><br>Start channel: <input type="number" min="1" 
-max="512" name="CS" maxlength="2"><br>Spacing between start channels: <input 
-type="number" min="1" max="512" name="CG" maxlength="2" onchange="mMap()"> [ <a 
-href="javascript:alert('if set to 10, first fixture will start at 10,\nsecond will start at 20 etc.\nRegardless of the channel count.\nMakes memorizing channel numbers easier.');">
-info</a> ]<br><div id="gapwarning" style="color:orange;display:none">
-WARNING: Channel gap is lower than channels per fixture.<br>
-This will cause overlap.</div><button type="button" 
-onclick='location.href="/dmxmap"'>DMX Map</button><br>DMX fixtures start LED: 
-<input type="number" min="0" max="1500" name="SL"><h3>Channel functions</h3><div
- id="dmxchannels"></div><hr><button type="button" onclick="B()">Back</button>
-<button type="submit">Save</button></form></body></html>)=====";
-
-
-#else
-const char PAGE_settings_dmx[] PROGMEM = R"=====()=====";
+const uint16_t PAGE_settings_dmx_length = 1488;
+const uint8_t PAGE_settings_dmx[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x57, 0xdb, 0x6e, 0xdb, 0x38,
+  0x10, 0x7d, 0xf7, 0x57, 0xb0, 0x2c, 0x16, 0xb1, 0x90, 0x44, 0xf2, 0xa5, 0xce, 0xb6, 0xb2, 0xa4,
+  0xa0, 0x71, 0x82, 0x24, 0x40, 0x93, 0x2d, 0xea, 0x5e, 0x76, 0xd1, 0x14, 0x0b, 0x5a, 0xa2, 0x24,
+  0x36, 0x12, 0xa9, 0x25, 0xa9, 0x38, 0x6e, 0x90, 0x7f, 0xdf, 0xa1, 0x68, 0xc9, 0xee, 0x25, 0xed,
+  0x16, 0xe8, 0x3e, 0x24, 0x96, 0x38, 0x37, 0xce, 0xcc, 0xe1, 0xe1, 0x28, 0x78, 0x74, 0xfc, 0xc7,
+  0xec, 0xf5, 0x5f, 0x2f, 0x4f, 0x50, 0xae, 0xcb, 0x22, 0x0a, 0xcc, 0x7f, 0x54, 0x10, 0x9e, 0x85,
+  0x98, 0x72, 0x0c, 0xef, 0x94, 0x24, 0x51, 0x50, 0x52, 0x4d, 0x10, 0x27, 0x25, 0x0d, 0xf1, 0x0d,
+  0xa3, 0xcb, 0x4a, 0x48, 0x8d, 0x51, 0x2c, 0xb8, 0xa6, 0x5c, 0x87, 0x78, 0xc9, 0x12, 0x9d, 0x87,
+  0x93, 0xc1, 0x00, 0x47, 0x3d, 0xab, 0x1a, 0xe7, 0x44, 0x2a, 0x0a, 0xa2, 0x5a, 0xa7, 0xfb, 0x4f,
+  0xc1, 0x8d, 0x66, 0xba, 0xa0, 0xd1, 0xf1, 0xc5, 0x9f, 0x68, 0x4e, 0xb5, 0x66, 0x3c, 0x53, 0x81,
+  0x67, 0xd7, 0x02, 0x15, 0x4b, 0x56, 0xe9, 0xa8, 0x97, 0xd6, 0x3c, 0xd6, 0x4c, 0x70, 0x74, 0x3a,
+  0x3b, 0xeb, 0x73, 0xe7, 0x2e, 0x15, 0xb2, 0x9f, 0x84, 0x89, 0x88, 0xeb, 0x12, 0xa2, 0xec, 0x25,
+  0x6e, 0x46, 0xf5, 0x49, 0x41, 0xcd, 0xcb, 0xd1, 0xea, 0x3c, 0xe9, 0xe3, 0xa4, 0xbc, 0x85, 0x38,
+  0x9c, 0xd3, 0x42, 0x61, 0xc7, 0x65, 0xf0, 0x20, 0xcf, 0x5e, 0x5f, 0xbc, 0xd8, 0x0d, 0x31, 0xde,
+  0x63, 0xe1, 0x60, 0xca, 0x02, 0x3e, 0x65, 0xbb, 0xbb, 0xce, 0xcf, 0x58, 0x06, 0xaa, 0x22, 0x1c,
+  0xb1, 0x24, 0x9c, 0x9d, 0xe1, 0xdd, 0x3e, 0xdb, 0x1d, 0x3a, 0xbb, 0x58, 0xa1, 0x68, 0x66, 0xb5,
+  0x51, 0xb7, 0xe6, 0xa3, 0x40, 0xd1, 0x82, 0xc6, 0xda, 0x56, 0x65, 0xa3, 0xbd, 0x63, 0x8c, 0xf1,
+  0xec, 0x6c, 0xa7, 0x7d, 0x87, 0xe4, 0x45, 0xd5, 0xe4, 0x75, 0x43, 0x8a, 0x9a, 0x86, 0x83, 0x08,
+  0x2a, 0x80, 0xb4, 0x40, 0x83, 0xc0, 0xb3, 0x82, 0x2f, 0x14, 0x86, 0xd1, 0x2b, 0x9a, 0x3c, 0x20,
+  0x1b, 0x45, 0xa7, 0x92, 0x52, 0xfe, 0x80, 0x74, 0x1c, 0x1d, 0xc1, 0xcf, 0x03, 0xc2, 0x27, 0xd1,
+  0xbb, 0x9c, 0xe9, 0x87, 0xa4, 0x93, 0x68, 0x9e, 0xd7, 0x5a, 0x53, 0x89, 0xfa, 0x47, 0x92, 0x65,
+  0xb9, 0xe6, 0x54, 0x29, 0xe7, 0x01, 0xe5, 0x83, 0x36, 0x85, 0xd1, 0x64, 0xb2, 0x51, 0xf1, 0x6c,
+  0x41, 0xcc, 0x03, 0xd4, 0x30, 0x0a, 0x16, 0x12, 0x79, 0xd1, 0x15, 0xdf, 0xb9, 0xef, 0x1a, 0x5b,
+  0x5e, 0x90, 0xaa, 0xff, 0x55, 0x63, 0x79, 0x5d, 0xce, 0xf2, 0xee, 0xd5, 0x9d, 0xa7, 0xee, 0xec,
+  0xd2, 0x6d, 0x02, 0x19, 0xd1, 0x29, 0xa9, 0x3e, 0x97, 0x9d, 0xae, 0x65, 0x95, 0x41, 0xd8, 0x39,
+  0xd7, 0xfd, 0xc6, 0xde, 0x89, 0xb6, 0xdf, 0xc1, 0xc8, 0x39, 0xfc, 0xba, 0xed, 0x19, 0xa9, 0x96,
+  0x44, 0x72, 0x40, 0x1f, 0x74, 0x5d, 0xe9, 0x55, 0x41, 0xdd, 0x84, 0xa9, 0xaa, 0x20, 0xab, 0x10,
+  0x2f, 0x0a, 0x11, 0x5f, 0x63, 0xff, 0xe7, 0x8c, 0xb8, 0xe0, 0xb4, 0xc5, 0xda, 0x70, 0xd2, 0x80,
+  0x8d, 0x45, 0x61, 0xb3, 0xa1, 0xc3, 0xfe, 0xd7, 0xae, 0xb6, 0x31, 0xd5, 0x39, 0x13, 0x15, 0x89,
+  0x99, 0x06, 0x67, 0x03, 0x77, 0x82, 0xf7, 0xbe, 0x63, 0xe4, 0x98, 0xb8, 0x64, 0x51, 0xd0, 0x24,
+  0x7c, 0x34, 0x70, 0xfc, 0x9f, 0xf6, 0x3f, 0xfc, 0xcf, 0xde, 0x87, 0xce, 0xa6, 0x67, 0x73, 0x68,
+  0x98, 0x39, 0x90, 0xc3, 0x89, 0xb3, 0x77, 0x4a, 0xf5, 0xdb, 0xbe, 0xb3, 0x67, 0xdb, 0xb8, 0x51,
+  0x39, 0x03, 0x95, 0x25, 0xe3, 0x89, 0x58, 0x42, 0x30, 0xca, 0xfb, 0x38, 0xd7, 0xba, 0x52, 0xbe,
+  0xe7, 0x65, 0x4c, 0xe7, 0xf5, 0xc2, 0x8d, 0x45, 0xe9, 0x3d, 0x67, 0x32, 0x16, 0x42, 0x5c, 0x33,
+  0xea, 0xbd, 0x7b, 0x71, 0x72, 0xec, 0x2d, 0xd9, 0x35, 0xf3, 0x80, 0x0e, 0xf0, 0x96, 0x9f, 0xa3,
+  0x8d, 0x9f, 0x9c, 0x29, 0x2d, 0xe4, 0xca, 0x5d, 0x90, 0xf8, 0x1a, 0x42, 0x01, 0xa4, 0x2c, 0x49,
+  0xac, 0xc9, 0x02, 0x29, 0x19, 0x87, 0x18, 0x00, 0x67, 0xa9, 0xc4, 0x53, 0xee, 0x47, 0x75, 0x58,
+  0x85, 0xbf, 0xe3, 0x68, 0x4b, 0xd3, 0x64, 0x1f, 0x2d, 0x44, 0xb2, 0x02, 0xc0, 0x71, 0xbd, 0x9f,
+  0x92, 0x92, 0x15, 0x2b, 0xff, 0x2d, 0x95, 0x09, 0xe1, 0x64, 0x4f, 0x11, 0xae, 0xf6, 0x15, 0x95,
+  0x2c, 0x9d, 0x6a, 0x7a, 0xab, 0xf7, 0x49, 0xc1, 0x32, 0xee, 0xc7, 0x50, 0x18, 0x2a, 0xa7, 0x26,
+  0x6c, 0x26, 0x45, 0xcd, 0x13, 0xff, 0xf1, 0x68, 0x34, 0x9a, 0xc6, 0xa2, 0x10, 0xd2, 0x7f, 0x9c,
+  0xa6, 0xe9, 0xb4, 0x60, 0x9c, 0xee, 0xe7, 0xd4, 0x1c, 0x11, 0x7f, 0x34, 0x18, 0xfc, 0x36, 0x2d,
+  0x89, 0xcc, 0x18, 0xf7, 0x07, 0xf7, 0xb9, 0xbc, 0x5b, 0x08, 0x99, 0x50, 0xb9, 0xbf, 0x56, 0x3f,
+  0x38, 0x38, 0xb8, 0x5f, 0xc0, 0xa1, 0x12, 0xfc, 0x6e, 0xdb, 0xe1, 0x78, 0x3c, 0xde, 0x76, 0xf8,
+  0x83, 0xcd, 0x59, 0x97, 0xbe, 0x3b, 0x8e, 0x73, 0xa4, 0x44, 0xc1, 0x12, 0xd4, 0x38, 0x58, 0x43,
+  0xd0, 0x67, 0xbc, 0xd9, 0x50, 0x83, 0x5e, 0xeb, 0x4a, 0xb1, 0x4f, 0x14, 0x76, 0x56, 0xdd, 0xb6,
+  0x3b, 0x7b, 0xda, 0x3d, 0xee, 0x6b, 0x51, 0xf9, 0xc3, 0x51, 0x75, 0x7b, 0xef, 0xe6, 0xb4, 0xa8,
+  0x8e, 0xee, 0xb6, 0x32, 0x2f, 0x68, 0xaa, 0xa7, 0x95, 0x50, 0xcc, 0xb4, 0xc2, 0x27, 0x0b, 0x88,
+  0x55, 0x6b, 0x3a, 0x6d, 0xa8, 0xdd, 0x3f, 0x00, 0x77, 0xf7, 0x8c, 0x57, 0xb5, 0xfe, 0x05, 0x99,
+  0x4c, 0x3e, 0xcb, 0xc4, 0xba, 0x7d, 0xaf, 0x57, 0x15, 0x35, 0x07, 0x67, 0x41, 0xe5, 0x87, 0x3b,
+  0x1b, 0xf4, 0x09, 0x2d, 0xef, 0x2d, 0xa5, 0xfc, 0xfa, 0xa0, 0x3a, 0xb9, 0xab, 0x48, 0x92, 0x00,
+  0x78, 0xfc, 0xa6, 0x1c, 0xc9, 0xa4, 0x0d, 0xea, 0x4e, 0x68, 0xf9, 0x88, 0x95, 0xe6, 0x86, 0x23,
+  0x5c, 0x1b, 0xe4, 0x35, 0x38, 0x0a, 0x3c, 0x7b, 0x11, 0x1a, 0x3c, 0x21, 0xc1, 0x0b, 0x41, 0x80,
+  0xe5, 0xe1, 0x6c, 0x00, 0xe2, 0x80, 0xce, 0xca, 0x5e, 0xc3, 0xfa, 0xe6, 0xe9, 0x6f, 0x85, 0xd7,
+  0x17, 0xe5, 0x3c, 0xc5, 0x08, 0x2e, 0xc3, 0x5c, 0x80, 0x04, 0x0a, 0xab, 0x41, 0x35, 0x61, 0x37,
+  0x28, 0x2e, 0x88, 0x52, 0x21, 0x6e, 0x1a, 0x00, 0x4b, 0x16, 0x20, 0xa8, 0xc9, 0x1f, 0xdb, 0x17,
+  0x8c, 0x7a, 0x82, 0xc7, 0x05, 0x8b, 0xaf, 0x43, 0x7c, 0x66, 0x42, 0x1c, 0x06, 0x9e, 0x95, 0xc0,
+  0x36, 0xc0, 0xc5, 0x03, 0x46, 0x9d, 0xcd, 0x91, 0xb1, 0x39, 0x82, 0x92, 0x75, 0x66, 0xbd, 0xcf,
+  0x2d, 0x54, 0xbd, 0x28, 0x19, 0xec, 0x67, 0x4e, 0x6e, 0xe8, 0xc6, 0x75, 0x2e, 0xe1, 0x6f, 0x14,
+  0xf5, 0xce, 0xcb, 0x92, 0xa0, 0x94, 0x49, 0x06, 0x84, 0x4d, 0x60, 0x14, 0xf8, 0x64, 0x2e, 0x05,
+  0x96, 0x22, 0xa6, 0x51, 0x4e, 0x14, 0x32, 0x77, 0xb8, 0xaa, 0x2b, 0x53, 0x20, 0xb8, 0x1f, 0xc0,
+  0xe0, 0xa5, 0x14, 0xb7, 0x2b, 0xf4, 0x86, 0xb3, 0x1b, 0x0a, 0x0c, 0x8c, 0x82, 0xa6, 0xa1, 0xeb,
+  0x1a, 0xbc, 0x7c, 0x03, 0xc9, 0xd8, 0xa0, 0xb6, 0xb9, 0x50, 0x12, 0xc6, 0x81, 0xeb, 0xe0, 0x97,
+  0xdc, 0x86, 0xf8, 0x60, 0xfc, 0xec, 0xd9, 0x33, 0x8c, 0x24, 0xfd, 0xa7, 0x66, 0x92, 0x26, 0x11,
+  0x4a, 0xa5, 0x28, 0xd1, 0xc9, 0xd0, 0x1d, 0x0f, 0xcd, 0xfd, 0x62, 0x62, 0xf5, 0x07, 0x61, 0xcb,
+  0x4c, 0x0e, 0xdc, 0x29, 0x90, 0x0b, 0x8b, 0x5e, 0x03, 0x3f, 0xa0, 0x25, 0x2b, 0x0a, 0xb4, 0x16,
+  0x21, 0x9d, 0x53, 0x04, 0xbc, 0x82, 0x12, 0x02, 0xd3, 0x87, 0xa8, 0xb5, 0xd9, 0xc2, 0xda, 0x01,
+  0x8c, 0x29, 0x29, 0xcb, 0x6a, 0xd9, 0xe8, 0x2d, 0x68, 0x21, 0x96, 0x81, 0xc7, 0xcc, 0xf5, 0x14,
+  0xb5, 0xee, 0x2e, 0x9b, 0xad, 0x21, 0x91, 0x42, 0xda, 0xb7, 0xba, 0x96, 0x54, 0x21, 0xf0, 0xaf,
+  0xc9, 0x35, 0xe5, 0x76, 0x43, 0xc6, 0xb3, 0x75, 0x83, 0x2a, 0x92, 0xd1, 0xd6, 0xbe, 0xb7, 0x1e,
+  0x0b, 0x14, 0xaa, 0xc0, 0x7c, 0x6d, 0x8b, 0x80, 0x2a, 0x4d, 0x72, 0x8e, 0xdf, 0x96, 0xe2, 0x1b,
+  0xf9, 0x0f, 0xd7, 0xf9, 0x0f, 0x27, 0x2d, 0x5a, 0x66, 0x97, 0x50, 0x29, 0x58, 0x2b, 0x28, 0xcf,
+  0x60, 0x98, 0xc2, 0xa3, 0xa6, 0xa1, 0xe0, 0x3f, 0x03, 0xa1, 0x65, 0x5c, 0xdc, 0x04, 0x9d, 0x6b,
+  0x22, 0x35, 0x5a, 0x8f, 0x2f, 0x3f, 0x88, 0xd1, 0x6b, 0x82, 0x4c, 0x86, 0xa3, 0x2e, 0xca, 0xbc,
+  0x09, 0xbc, 0x09, 0x62, 0x5d, 0x9a, 0x2b, 0x82, 0x67, 0x50, 0x1c, 0xbd, 0x84, 0xe9, 0x02, 0xa9,
+  0xed, 0x10, 0xaa, 0x8b, 0xd1, 0xfb, 0x4e, 0x22, 0xdb, 0x31, 0x4e, 0xbf, 0x88, 0xf1, 0x8d, 0x44,
+  0xd0, 0x7b, 0x14, 0x10, 0xd4, 0xcb, 0x25, 0x4d, 0x43, 0xfc, 0x91, 0xdc, 0x10, 0xcb, 0xda, 0x3e,
+  0x29, 0xa8, 0xd4, 0xfd, 0x1d, 0x40, 0x9b, 0xb2, 0x13, 0xc6, 0x70, 0xb0, 0x67, 0xb0, 0xa8, 0x74,
+  0x57, 0xde, 0xa6, 0xed, 0x76, 0x87, 0x44, 0x1b, 0xf9, 0x15, 0x57, 0x14, 0x9a, 0x93, 0x7c, 0x21,
+  0x19, 0x0d, 0x10, 0xd5, 0xb1, 0x7b, 0xc5, 0x5f, 0xd1, 0x8c, 0xc8, 0xa4, 0x80, 0x79, 0xc6, 0x74,
+  0xd8, 0x00, 0x65, 0x9d, 0x19, 0xb4, 0xb4, 0x86, 0xa1, 0xe2, 0x8a, 0x5f, 0x40, 0xa7, 0x15, 0x9c,
+  0xd5, 0x52, 0x48, 0xf6, 0xc9, 0x14, 0xa2, 0x55, 0xb0, 0xa9, 0x2a, 0x44, 0x89, 0x62, 0x54, 0xba,
+  0x3b, 0xce, 0x14, 0x26, 0x5c, 0xc6, 0x53, 0x11, 0x78, 0x24, 0x42, 0x1f, 0x1a, 0x0c, 0x99, 0x33,
+  0x6d, 0x0e, 0xff, 0xd6, 0x9c, 0x80, 0x1a, 0xce, 0x08, 0xb1, 0xa5, 0x29, 0x21, 0x4d, 0xee, 0x1d,
+  0x63, 0x37, 0x33, 0x43, 0xd4, 0x7b, 0xf7, 0xfc, 0xd5, 0xe5, 0xf9, 0xe5, 0xa9, 0x8f, 0xda, 0xd1,
+  0x12, 0xec, 0x0d, 0xea, 0x00, 0x9e, 0x80, 0x25, 0x0d, 0x8b, 0x5d, 0x03, 0xb6, 0xd1, 0xe5, 0x36,
+  0xb8, 0xdb, 0xe0, 0x3f, 0x26, 0x35, 0x9c, 0x39, 0x01, 0x47, 0xaf, 0x20, 0x95, 0xfb, 0x3d, 0x7a,
+  0xe8, 0x38, 0x65, 0x07, 0xee, 0x0a, 0x62, 0x58, 0xde, 0xb5, 0xe5, 0xf7, 0x60, 0x1a, 0x2e, 0x49,
+  0x85, 0x77, 0x9a, 0xf1, 0x1c, 0x1a, 0xb4, 0xa1, 0x04, 0x88, 0x65, 0xd6, 0xba, 0x53, 0x61, 0x8b,
+  0x0b, 0xa7, 0xc1, 0x47, 0xbd, 0x87, 0x81, 0x37, 0xe8, 0xc0, 0x0d, 0x5f, 0x04, 0x2d, 0x19, 0xbe,
+  0x30, 0xdf, 0x12, 0xe3, 0x6e, 0x90, 0x6e, 0x2f, 0x7d, 0xf8, 0x0c, 0x80, 0x55, 0x53, 0x44, 0x4b,
+  0xa1, 0xdb, 0x93, 0x79, 0xcb, 0x76, 0x86, 0x98, 0xfe, 0x17, 0xc6, 0xf3, 0x0c, 0x61, 0xc3, 0x8f,
+  0x21, 0x75, 0xc3, 0xf0, 0xe6, 0x03, 0xe8, 0x5f, 0x68, 0xa3, 0x38, 0xe3, 0x10, 0x0d, 0x00, 0x00
+};
 #endif
 
 // Autogenerated from wled00/data/settings_ui.htm, do not edit!!
-const char PAGE_settings_ui[] PROGMEM = R"=====(<!DOCTYPE html><html><head lang="en"><meta charset="utf-8"><meta 
-name="viewport" content="width=500"><title>UI Settings</title><script>
-var initial_ds,initial_st,d=document,sett=null,l={comp:{labels:"Show button labels",colors:{LABEL:"Color selection methods",picker:"Color Wheel",rgb:"RGB sliders",quick:"Quick color selectors",hex:"HEX color input"},pcmbot:"Show bottom tab bar in PC mode",pid:"Show preset IDs"},theme:{alpha:{bg:"Background opacity",tab:"Button opacity"},bg:{url:"BG image URL",random:"Random BG image"},color:{bg:"BG HEX color"}}};function gId(e){return d.getElementById(e)}function isObject(e){return e&&"object"==typeof e&&!Array.isArray(e)}function set(e,t,i){for(var n=t,l=e.split("_"),o=l.length,s=0;s<o-1;s++){var d=l[s];n[d]||(n[d]={}),n=n[d]}n[l[o-1]]=i}function addRec(e,t="",n=null){var l="";for(i in e){var o=t+(t?"_":"")+i;if(isObject(e[i]))n&&n[i]&&n[i].LABEL&&(l+=`<h3>${n[i].LABEL}</h3>`),l+=addRec(e[i],o,n?n[i]:null);else{var s=o;if(n&&n[i]?s=n[i]:e[i+"LABEL"]&&(s=e[i+"LABEL"]),i.indexOf("LABEL")>0)continue;var d=typeof e[i];gId(o)?("boolean"===d?gId(o).checked=e[i]:gId(o).value=e[i],gId(o).previousElementSibling.matches(".l")&&(gId(o).previousElementSibling.innerHTML=s)):"boolean"===d?l+=`${s}: <input class="agi cb" type="checkbox" id=${o} ${e[i]?"checked":""}><br>`:"number"===d?l+=`${s}: <input class="agi" type="number" id=${o} value=${e[i]}><br>`:"string"===d&&(l+=`${s}:<br><input class="agi" id=${o} value=${e[i]}><br>`)}}return l}function genForm(e){var t;t=addRec(e,"",l),gId("gen").innerHTML=t}function GetLS(){(sett=localStorage.getItem("wledUiCfg"))||(gId("lserr").style.display="inline");try{sett=JSON.parse(sett)}catch(e){sett={},gId("lserr").style.display="inline",gId("lserr").innerHTML="&#9888; Settings JSON parsing failed. ("+e+")"}genForm(sett),gId("dm").checked="light"===gId("theme_base").value}function SetLS(){for(var e=d.querySelectorAll(".agi"),t=0;t<e.length;t++){var i=e[t],n=i.classList.contains("cb")?i.checked:i.value;set(i.id,sett,n),console.log(`${i.id} set to ${n}`)}try{localStorage.setItem("wledUiCfg",JSON.stringify(sett)),gId("lssuc").style.display="inline"}catch(i){gId("lssuc").style.display="none",gId("lserr").style.display="inline",gId("lserr").innerHTML="&#9888; Settings JSON saving failed. ("+i+")"}}function Save(){SetLS(),d.Sf.DS.value==initial_ds&&d.Sf.ST.checked==initial_st||d.Sf.submit()}function S(){GetV(),initial_ds=d.Sf.DS.value,initial_st=d.Sf.ST.checked,GetLS()}function H(){window.open("https://github.com/Aircoookie/WLED/wiki/Settings#user-interface-settings")}function B(){window.open("/settings","_self")}function UI(){gId("idonthateyou").style.display=gId("dm").checked?"inline":"none";var e=gId("theme_base");e&&(e.value=gId("dm").checked?"light":"dark")}function setRandomBg(){gId("theme_bg_random").checked?gId("theme_bg_url").value="https://picsum.photos/1920/1080":gId("theme_bg_url").value=""}function checkRandomBg(){"https://picsum.photos/1920/1080"===gId("theme_bg_url").value?gId("theme_bg_random").checked=!0:gId("theme_bg_random").checked=!1}function GetV() {var d=document;
-%CSS%%SCSS%</head><body onload="S()"><form
- id="form_s" name="Sf" method="post"><div 
-style="position:sticky;top:0;background-color:#222"><div class="helpB"><button 
-type="button" onclick="H()">?</button></div><button type="button" onclick="B()">
-Back</button><button type="button" onclick="Save()">Save</button><br><span 
-id="lssuc" style="color:green;display:none">&#10004; Local UI settings saved!
-</span> <span id="lserr" style="color:red;display:none">
-&#9888; Could not access local storage. Make sure it is enabled in your browser.
-</span><hr></div><h2>Web Setup</h2>Server description: <input name="DS" 
-maxlength="32"><br>Sync button toggles both send and receive: <input 
-type="checkbox" name="ST"><br><i>
-The following UI customization settings are unique both to the WLED device and this browser.
-<br>
-You will need to set them again if using a different browser, device or WLED IP address.
-<br>Refresh the main UI to apply changes.</i><br><div id="gen">
-Loading settings...</div><h3>UI Appearance</h3><span class="l"></span>: <input 
-type="checkbox" id="comp_labels" class="agi cb"><br><span class="l"></span>: 
-<input type="checkbox" id="comp_pcmbot" class="agi cb"><br><span class="l">
-</span>: <input type="checkbox" id="comp_pid" class="agi cb"><br>
-I hate dark mode: <input type="checkbox" id="dm" onchange="UI()"><br><span 
-id="idonthateyou" style="display:none"><i>Why would you? </i>&#x1F97A;<br>
-</span><span class="l"></span>: <input type="number" min="0.0" max="1.0" 
-step="0.01" id="theme_alpha_tab" class="agi"><br><span class="l"></span>: <input
- type="number" min="0.0" max="1.0" step="0.01" id="theme_alpha_bg" class="agi">
-<br><span class="l"></span>: <input id="theme_color_bg" maxlength="9" 
-class="agi"><br><span class="l">BG image URL</span>: <input id="theme_bg_url" 
-class="agi" oninput="checkRandomBg()"><br><span class="l">Random BG image</span>
-: <input type="checkbox" id="theme_bg_random" class="agi cb" 
-onchange="setRandomBg()"><br><input id="theme_base" class="agi" 
-style="display:none"><hr><button type="button" onclick="B()">Back</button>
-<button type="button" onclick="Save()">Save</button></form></body></html>)=====";
-
+const uint16_t PAGE_settings_ui_length = 2446;
+const uint8_t PAGE_settings_ui[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0xed, 0x73, 0xd3, 0x38,
+  0x1a, 0xff, 0x9e, 0xbf, 0x42, 0xa8, 0x5c, 0x27, 0x9e, 0xba, 0x4e, 0xda, 0x2e, 0x5c, 0xb1, 0xe3,
+  0x64, 0x5a, 0x60, 0xa1, 0x37, 0xdd, 0x83, 0x23, 0xb0, 0xdc, 0x0e, 0xd3, 0x29, 0xb2, 0xad, 0xc4,
+  0xda, 0xca, 0x92, 0xd7, 0x92, 0xdb, 0x66, 0x43, 0xfe, 0xf7, 0x7b, 0x24, 0xd9, 0x79, 0xa3, 0x2f,
+  0xcc, 0x0d, 0x5f, 0x1a, 0x57, 0x7a, 0xf4, 0x7b, 0xde, 0x5f, 0xa4, 0xc1, 0x93, 0x57, 0xef, 0x5e,
+  0x7e, 0xfc, 0xe3, 0xfd, 0x6b, 0x94, 0xeb, 0x82, 0x0f, 0x07, 0xcd, 0x5f, 0x4a, 0x32, 0xc4, 0x89,
+  0x98, 0xc6, 0x98, 0x0a, 0x3c, 0x1c, 0x14, 0x54, 0x13, 0x94, 0xe6, 0xa4, 0x52, 0x54, 0xc7, 0xb8,
+  0xd6, 0x93, 0xfd, 0xe3, 0x76, 0xb5, 0x23, 0x48, 0x41, 0x63, 0x7c, 0xcd, 0xe8, 0x4d, 0x29, 0x2b,
+  0x8d, 0x51, 0x2a, 0x85, 0xa6, 0x02, 0xc8, 0x6e, 0x58, 0xa6, 0xf3, 0xf8, 0x59, 0xbf, 0x0f, 0xa4,
+  0x9a, 0x69, 0x4e, 0x87, 0x9f, 0xce, 0xd0, 0x98, 0x6a, 0xcd, 0xc4, 0x54, 0x0d, 0x7a, 0x6e, 0x69,
+  0xa0, 0xd2, 0x8a, 0x95, 0x7a, 0xd8, 0xb9, 0x26, 0x15, 0x62, 0x82, 0x69, 0x46, 0xf8, 0x65, 0xa6,
+  0xfc, 0xf6, 0x53, 0x69, 0x3f, 0x8b, 0x33, 0x99, 0xd6, 0x05, 0x60, 0xfa, 0xc0, 0x5e, 0xc7, 0xa2,
+  0xe6, 0xdc, 0xe7, 0xf1, 0x3c, 0x95, 0x45, 0x19, 0xce, 0x39, 0x49, 0x28, 0x57, 0x21, 0x1e, 0xe7,
+  0xf2, 0x06, 0x25, 0xb5, 0xd6, 0x52, 0x20, 0xb7, 0x86, 0xfd, 0x54, 0x72, 0x59, 0xa9, 0x70, 0x7e,
+  0x7e, 0x72, 0xfa, 0xfa, 0x3c, 0xc4, 0x2f, 0xcd, 0xbf, 0x48, 0x51, 0x4e, 0x53, 0xcd, 0x80, 0x0c,
+  0xe4, 0xcf, 0x65, 0x06, 0x74, 0x25, 0x4b, 0xaf, 0x68, 0xd5, 0x12, 0x7c, 0xce, 0x29, 0xe5, 0xd8,
+  0xaf, 0xa6, 0x49, 0x88, 0x3f, 0xbc, 0x39, 0x45, 0x8a, 0xb3, 0x8c, 0x56, 0x40, 0xf6, 0x57, 0x0d,
+  0x74, 0x21, 0xfe, 0x8f, 0xf9, 0x41, 0xe9, 0x1a, 0x98, 0x34, 0xbb, 0x39, 0xbd, 0x0d, 0xf1, 0xdb,
+  0xd7, 0xff, 0x6d, 0x76, 0x98, 0x28, 0x6b, 0x8d, 0x17, 0x7e, 0x99, 0x16, 0x89, 0xd4, 0xad, 0x7c,
+  0x12, 0xe4, 0x2b, 0x90, 0x26, 0x09, 0x4a, 0xac, 0xbe, 0xe8, 0xfd, 0x4b, 0x54, 0xc8, 0x8c, 0x1a,
+  0x19, 0xb2, 0x86, 0xa8, 0xac, 0x28, 0xe8, 0x89, 0xce, 0x5e, 0x29, 0x38, 0xae, 0x73, 0x5a, 0xd0,
+  0x70, 0x4e, 0x78, 0x99, 0x93, 0x70, 0x9e, 0x4c, 0x43, 0x7c, 0x4a, 0xd2, 0xab, 0x69, 0x25, 0x6b,
+  0x91, 0x21, 0x59, 0x92, 0x94, 0xe9, 0x19, 0xf6, 0x01, 0x10, 0x36, 0x9c, 0xf2, 0xed, 0xe2, 0xc2,
+  0x07, 0xea, 0x79, 0x5d, 0x71, 0xd8, 0x79, 0x83, 0x58, 0x41, 0xa6, 0x14, 0x7d, 0xfa, 0x70, 0x0e,
+  0x8a, 0x11, 0x91, 0xc9, 0x02, 0x74, 0xb3, 0xbf, 0xa8, 0xdd, 0x84, 0x03, 0x56, 0xf2, 0x86, 0xcb,
+  0x1b, 0xb4, 0xd4, 0x05, 0x2f, 0x16, 0x8b, 0x68, 0x52, 0x0b, 0x67, 0xb5, 0xe9, 0x59, 0xd6, 0xa5,
+  0xde, 0xbc, 0xa2, 0xba, 0xae, 0x04, 0xca, 0x82, 0x29, 0xd5, 0xaf, 0x39, 0x35, 0xee, 0x39, 0x9d,
+  0xd9, 0xad, 0xc5, 0x92, 0x94, 0xa9, 0x77, 0xc9, 0x9f, 0x60, 0x9f, 0x35, 0x7a, 0xba, 0xbb, 0x8b,
+  0xa5, 0x5d, 0xc4, 0x71, 0xac, 0x67, 0x25, 0x95, 0x13, 0xb3, 0xf6, 0xe4, 0xa4, 0xaa, 0xc8, 0x2c,
+  0x60, 0xca, 0xfe, 0x6e, 0x80, 0x80, 0x2d, 0xba, 0xd4, 0xd7, 0x3e, 0xf3, 0xe6, 0x13, 0x59, 0x75,
+  0x4d, 0x9c, 0x88, 0x58, 0x43, 0x00, 0xd0, 0x40, 0x95, 0x9c, 0xe9, 0x2e, 0xbe, 0xc4, 0x9e, 0x2f,
+  0x63, 0x1e, 0x70, 0x2a, 0xa6, 0x3a, 0xf7, 0x55, 0xdc, 0x8f, 0xd4, 0x40, 0xee, 0x1f, 0x44, 0x6a,
+  0x6f, 0xcf, 0x9b, 0x9b, 0x03, 0x59, 0xcc, 0xbf, 0xa8, 0x8b, 0x48, 0x7c, 0xc9, 0x2e, 0xbe, 0x7d,
+  0xeb, 0x9a, 0x9f, 0x78, 0xbe, 0xf0, 0x7c, 0x11, 0x9b, 0xcf, 0x85, 0xf8, 0xc2, 0xbf, 0x00, 0xf9,
+  0xc5, 0x45, 0xcc, 0x56, 0x6c, 0x49, 0x96, 0x7d, 0xa0, 0xa9, 0xe1, 0x1c, 0x63, 0x6c, 0x28, 0x21,
+  0xea, 0x1c, 0x18, 0x87, 0x85, 0xc8, 0x88, 0xc2, 0x8c, 0x03, 0xa9, 0x5b, 0x94, 0xb1, 0xde, 0xeb,
+  0xea, 0x11, 0xc8, 0x12, 0x62, 0xec, 0xed, 0xb1, 0x88, 0x4d, 0xba, 0x2b, 0xf5, 0xbf, 0xb0, 0x0b,
+  0xcf, 0x13, 0xbb, 0xbb, 0x02, 0x3e, 0xdc, 0xdf, 0xc0, 0xc6, 0xe4, 0xee, 0x6e, 0x97, 0xef, 0xc5,
+  0x5f, 0x07, 0xf9, 0xd1, 0xf0, 0xe9, 0x7c, 0xb5, 0xbc, 0x18, 0xf4, 0x60, 0xe5, 0xab, 0xe7, 0xc3,
+  0x66, 0x2b, 0x07, 0x6c, 0xfa, 0xd2, 0x17, 0x23, 0x43, 0x15, 0x5a, 0x61, 0x22, 0x88, 0x71, 0x6a,
+  0x99, 0xab, 0x58, 0x1a, 0x7e, 0x0d, 0x83, 0x91, 0x8a, 0x2d, 0x11, 0x1c, 0xd9, 0xc3, 0x16, 0x0f,
+  0x03, 0xd3, 0xae, 0x8a, 0xd7, 0x17, 0x3c, 0x9f, 0x05, 0x4c, 0x64, 0xf4, 0xf6, 0xdd, 0xa4, 0xdb,
+  0xac, 0x79, 0xc3, 0xbe, 0x67, 0x92, 0x97, 0x89, 0x9a, 0x46, 0xce, 0x6a, 0xad, 0x83, 0x00, 0x2e,
+  0x32, 0x7e, 0x97, 0xde, 0xa8, 0x8b, 0x13, 0x29, 0x39, 0x25, 0x02, 0xfc, 0x17, 0x67, 0x23, 0xb7,
+  0x1a, 0xa4, 0x39, 0x85, 0x14, 0xca, 0x0c, 0x8b, 0x8b, 0xb0, 0x59, 0xbb, 0x26, 0xbc, 0xa6, 0x76,
+  0xc5, 0x6f, 0x56, 0x20, 0xb2, 0xaf, 0x99, 0xac, 0x55, 0x13, 0x2f, 0x63, 0x96, 0x70, 0xa8, 0x05,
+  0x41, 0x41, 0x34, 0x9c, 0x57, 0x5d, 0x1c, 0x70, 0xec, 0x81, 0xa4, 0x0f, 0x53, 0x33, 0x21, 0x68,
+  0xf5, 0xf6, 0xe3, 0x6f, 0xe7, 0xb1, 0xf2, 0xbc, 0x70, 0x53, 0x1a, 0x63, 0xcc, 0xa7, 0x73, 0xb5,
+  0x08, 0xd1, 0xc0, 0xe6, 0x1f, 0x4a, 0x39, 0x51, 0x2a, 0xc6, 0x64, 0xca, 0x50, 0x9a, 0x60, 0x64,
+  0xf4, 0x89, 0xb1, 0x15, 0x36, 0x91, 0xb7, 0x18, 0xb1, 0x2c, 0x7e, 0x3a, 0x97, 0x0b, 0xf4, 0x74,
+  0x6e, 0xc4, 0x1c, 0xe1, 0x46, 0x0d, 0xe3, 0xc3, 0xc5, 0x70, 0x90, 0x54, 0xc3, 0xaf, 0x21, 0x16,
+  0x75, 0x91, 0xd0, 0xea, 0x51, 0xfc, 0x16, 0xbc, 0x21, 0x5f, 0x42, 0x3b, 0x2b, 0x38, 0x06, 0x4b,
+  0x4c, 0xa5, 0x2b, 0x50, 0xc5, 0x62, 0x36, 0x21, 0x60, 0x51, 0xcd, 0xee, 0x1d, 0xc0, 0x0f, 0x40,
+  0x79, 0x8b, 0x45, 0x93, 0x58, 0x7c, 0x15, 0xba, 0x53, 0x2a, 0x7e, 0x95, 0x55, 0xd1, 0x6d, 0x42,
+  0x53, 0x47, 0x7a, 0x19, 0x45, 0x3e, 0xc4, 0x32, 0xf7, 0xac, 0x3f, 0x30, 0x90, 0x61, 0x6f, 0xcd,
+  0x9c, 0x7a, 0x85, 0xf0, 0x86, 0xea, 0xf3, 0x71, 0xd7, 0x9b, 0x77, 0x6d, 0xc1, 0xe5, 0x32, 0x25,
+  0x7c, 0x0c, 0x55, 0x0e, 0xaa, 0x84, 0x49, 0xf7, 0x33, 0x4d, 0x8b, 0x2e, 0xbe, 0xe1, 0x34, 0xfb,
+  0xc4, 0x5e, 0x4e, 0xa6, 0xd8, 0xf3, 0x20, 0xa9, 0x2c, 0x24, 0x04, 0x64, 0x55, 0x01, 0xa8, 0xd2,
+  0x33, 0x4e, 0x83, 0x8c, 0x41, 0x82, 0x92, 0x59, 0x8c, 0x99, 0x00, 0xcf, 0x51, 0xec, 0x45, 0xba,
+  0x9a, 0xcd, 0x2d, 0xe4, 0xbf, 0xc6, 0xef, 0xfe, 0x1d, 0x94, 0xa6, 0x9f, 0x58, 0x16, 0xde, 0x22,
+  0x35, 0x31, 0x60, 0x24, 0xb6, 0xdb, 0xf3, 0x85, 0xff, 0x03, 0x78, 0x9b, 0x34, 0x2b, 0x45, 0xf0,
+  0xee, 0xce, 0x8b, 0xe3, 0xe3, 0xe3, 0x68, 0xd9, 0x6c, 0x90, 0x61, 0x87, 0x0c, 0x3b, 0xf8, 0x0f,
+  0x4d, 0x08, 0x03, 0xd1, 0x03, 0xd4, 0xc5, 0x7b, 0x74, 0x0f, 0x7b, 0x78, 0xd1, 0xda, 0xcb, 0x4a,
+  0xe2, 0x40, 0xb3, 0x02, 0xaf, 0x82, 0x1a, 0x73, 0x36, 0xcd, 0x4d, 0xbd, 0x8a, 0xed, 0x9e, 0x2d,
+  0xc9, 0x97, 0x09, 0x51, 0xa0, 0x91, 0x0b, 0xf2, 0x95, 0xe1, 0xc6, 0x8d, 0xe1, 0xda, 0x4a, 0x45,
+  0xe3, 0x2c, 0xf8, 0xab, 0xa6, 0xd5, 0x6c, 0xdc, 0x34, 0x8a, 0x13, 0xce, 0x21, 0xce, 0x8d, 0x5b,
+  0x3d, 0xa8, 0x2c, 0xfd, 0x48, 0x0f, 0x68, 0x53, 0xb7, 0x22, 0xdd, 0x56, 0x2b, 0x06, 0x49, 0xa3,
+  0x2f, 0xa0, 0xe6, 0xb0, 0xc0, 0x86, 0xc1, 0x39, 0x53, 0x3a, 0x30, 0x99, 0x49, 0x98, 0x80, 0x2c,
+  0x81, 0x40, 0xf6, 0x46, 0xac, 0x95, 0x2e, 0x64, 0x4e, 0x86, 0xc8, 0xd4, 0x49, 0xc8, 0xe9, 0xcc,
+  0x36, 0x49, 0x5f, 0x78, 0x50, 0xcd, 0x85, 0x82, 0xdc, 0x08, 0xb8, 0x9c, 0x76, 0x21, 0xbe, 0xcc,
+  0xde, 0xc2, 0x54, 0x53, 0xa4, 0x25, 0x04, 0xbc, 0x58, 0x40, 0xf0, 0x18, 0x7f, 0x6c, 0x78, 0x57,
+  0x7d, 0xef, 0x5d, 0xdf, 0xfa, 0xca, 0x45, 0x2c, 0x9b, 0xcc, 0x9c, 0x95, 0xbc, 0xd6, 0xf6, 0xaa,
+  0x4e, 0xef, 0xf5, 0x4f, 0xe3, 0x54, 0x28, 0xdc, 0x0f, 0x11, 0x0b, 0xf9, 0x9d, 0x2b, 0x7f, 0x8a,
+  0xbb, 0x15, 0xb9, 0xde, 0xf2, 0x36, 0xb3, 0xde, 0x5e, 0x73, 0x16, 0xb9, 0xa6, 0xe0, 0xab, 0xc6,
+  0x67, 0x7e, 0x16, 0x8c, 0x27, 0xc1, 0xab, 0x71, 0x53, 0xb7, 0xe2, 0xd5, 0x30, 0xb2, 0xbb, 0x6b,
+  0xb7, 0xc6, 0x1f, 0x97, 0x11, 0x11, 0xaf, 0xc6, 0x93, 0x6f, 0xdf, 0xec, 0xa6, 0xaa, 0x93, 0x02,
+  0x7a, 0xd1, 0x5a, 0xdf, 0x32, 0x61, 0x00, 0x79, 0xf4, 0x3b, 0x20, 0xaf, 0xa0, 0xe2, 0x0d, 0x26,
+  0x6b, 0x53, 0x4e, 0xbc, 0xc5, 0xc2, 0x6f, 0x52, 0x70, 0x85, 0xf7, 0x16, 0xf0, 0x6e, 0xa0, 0x64,
+  0xcb, 0x9b, 0x40, 0x96, 0x54, 0x74, 0x71, 0xae, 0x75, 0xa9, 0xc2, 0x5e, 0x6f, 0xca, 0x74, 0x5e,
+  0x27, 0x10, 0x20, 0x45, 0xef, 0x84, 0x55, 0xa9, 0x94, 0xf2, 0x8a, 0xd1, 0xde, 0xe7, 0xf3, 0xd7,
+  0xaf, 0x7a, 0x37, 0xec, 0x8a, 0xf5, 0x5a, 0xb3, 0xec, 0xd4, 0x60, 0xba, 0x7d, 0x06, 0xd3, 0x59,
+  0x35, 0x21, 0x29, 0xdd, 0x57, 0xcd, 0x3a, 0x5e, 0x63, 0x72, 0xba, 0xcd, 0xa4, 0xb7, 0xa4, 0xf2,
+  0xf1, 0x25, 0x4c, 0x3b, 0x93, 0x75, 0xea, 0x4f, 0x67, 0xdd, 0xc6, 0xb7, 0x2c, 0x83, 0xf0, 0xcc,
+  0x89, 0xa6, 0x33, 0x59, 0x7f, 0xe7, 0xc0, 0xef, 0x32, 0x6a, 0xd4, 0xba, 0x34, 0x74, 0xde, 0x8f,
+  0x5c, 0xaa, 0x7c, 0x97, 0x5d, 0x11, 0x4c, 0x06, 0x5d, 0xda, 0x38, 0xe4, 0x0e, 0x14, 0x97, 0x97,
+  0x21, 0xce, 0x48, 0x75, 0x85, 0x37, 0x47, 0x06, 0x37, 0xdc, 0x9c, 0x4e, 0x5b, 0x01, 0x1b, 0xd8,
+  0xe9, 0xa5, 0x9b, 0x7e, 0xd6, 0x50, 0x36, 0xb7, 0x61, 0x5e, 0x6a, 0xb3, 0x3a, 0x5e, 0x5a, 0x18,
+  0xe6, 0x43, 0x55, 0x17, 0x41, 0x99, 0x4b, 0x2d, 0x55, 0xef, 0xe0, 0xc5, 0x61, 0xbf, 0x77, 0xd0,
+  0x3f, 0xee, 0xe3, 0xf0, 0x81, 0xb3, 0x78, 0x25, 0x8e, 0xe5, 0xb4, 0x26, 0xd0, 0xa3, 0xb8, 0x5b,
+  0x95, 0x66, 0x03, 0x79, 0xf4, 0xb0, 0x3a, 0xf1, 0x93, 0x7e, 0xf8, 0x18, 0xc5, 0x01, 0xcc, 0x17,
+  0xcd, 0xd8, 0xdd, 0x8c, 0xdf, 0x48, 0x55, 0x69, 0xbc, 0xf2, 0x75, 0x4f, 0x05, 0x7f, 0xaa, 0x51,
+  0x19, 0x1f, 0xc1, 0xe4, 0xbe, 0xa2, 0x34, 0x3e, 0x1d, 0x26, 0x32, 0x9b, 0x41, 0x75, 0x13, 0x7a,
+  0x7f, 0x42, 0x0a, 0xc6, 0x67, 0xe1, 0xef, 0xb4, 0xca, 0x88, 0x20, 0xbe, 0x22, 0x42, 0x41, 0x48,
+  0x55, 0x6c, 0x12, 0x69, 0x7a, 0xab, 0xf7, 0x09, 0x38, 0x47, 0x84, 0x29, 0x35, 0xe1, 0x16, 0x25,
+  0xcb, 0x99, 0x35, 0xdc, 0x39, 0x3c, 0x3c, 0x8c, 0xdc, 0xa0, 0xb9, 0x33, 0x99, 0x4c, 0x22, 0x13,
+  0x07, 0xfb, 0x39, 0x35, 0x9e, 0x0c, 0x0f, 0xfb, 0xfd, 0x7f, 0x44, 0x05, 0xa9, 0xa6, 0x4c, 0x84,
+  0xfd, 0x45, 0x5e, 0xcd, 0x13, 0x59, 0xc1, 0xe8, 0xbd, 0xdf, 0x90, 0x3f, 0x7f, 0xfe, 0x7c, 0xe1,
+  0x26, 0xfc, 0xf9, 0x3a, 0xe0, 0xd1, 0xd1, 0xd1, 0x3a, 0xe0, 0x23, 0xc2, 0x39, 0xc8, 0x30, 0x38,
+  0x4a, 0x73, 0x04, 0xe5, 0x91, 0x65, 0xc8, 0x02, 0x34, 0xb1, 0x1a, 0xba, 0xc0, 0xdc, 0x4f, 0xa0,
+  0x2a, 0x5e, 0x39, 0x28, 0xc5, 0xfe, 0xa6, 0x20, 0x59, 0x79, 0xdb, 0x4a, 0x76, 0xbc, 0xfc, 0xdc,
+  0xd7, 0xb2, 0x0c, 0x0f, 0x0e, 0xcb, 0xdb, 0x45, 0x90, 0x53, 0x5e, 0x9e, 0xce, 0xd7, 0x34, 0xe7,
+  0x74, 0xa2, 0xa3, 0x52, 0x2a, 0x66, 0x42, 0x20, 0x24, 0x09, 0xf0, 0xaa, 0x35, 0x8d, 0xec, 0xa5,
+  0x28, 0x7c, 0x0e, 0x70, 0x0b, 0xdb, 0xe8, 0x7f, 0x82, 0x26, 0xcf, 0x36, 0x34, 0x71, 0xb0, 0x5f,
+  0xec, 0x30, 0xe2, 0x66, 0x91, 0x8b, 0xb9, 0x63, 0xfa, 0x0b, 0x2d, 0x16, 0xee, 0xbe, 0xf2, 0xf3,
+  0x99, 0xea, 0x6c, 0x5e, 0xc2, 0x8c, 0x01, 0xc1, 0x13, 0x5a, 0x73, 0x64, 0xcf, 0x5a, 0xa6, 0xc1,
+  0x33, 0x5a, 0x3c, 0x61, 0x85, 0xb9, 0x1b, 0x12, 0xa1, 0x4d, 0xe4, 0xd9, 0x38, 0x82, 0x09, 0x17,
+  0xee, 0x98, 0x30, 0xc4, 0x40, 0x3c, 0x21, 0x29, 0xb8, 0x24, 0xd0, 0x67, 0xa1, 0xde, 0x41, 0xc4,
+  0x41, 0xef, 0x2c, 0x3a, 0x66, 0xe8, 0xc1, 0xe6, 0xeb, 0x52, 0x61, 0xe4, 0xae, 0x98, 0xe3, 0x09,
+  0x6e, 0xae, 0x6c, 0x31, 0x06, 0xc3, 0x6a, 0x20, 0xcd, 0xd8, 0x35, 0xea, 0x58, 0x40, 0xbb, 0xe4,
+  0x6c, 0xad, 0x34, 0xdc, 0xcf, 0x66, 0x91, 0xf1, 0x4d, 0x7f, 0x2d, 0xf2, 0xda, 0x28, 0x82, 0xf8,
+  0x6b, 0x4e, 0x36, 0x33, 0x96, 0x75, 0x1d, 0x2c, 0x35, 0x97, 0xc7, 0x8e, 0x9b, 0xe3, 0xdc, 0x7f,
+  0x18, 0x64, 0x4b, 0x39, 0xe0, 0xc5, 0xf8, 0xad, 0x11, 0x6e, 0x34, 0xe8, 0xb9, 0x0d, 0x50, 0x00,
+  0x20, 0x96, 0x87, 0xee, 0x39, 0x73, 0x6a, 0xce, 0x74, 0xcc, 0x8d, 0x6d, 0x75, 0xee, 0xe1, 0x13,
+  0xae, 0x27, 0xe1, 0xa1, 0xf9, 0x5d, 0x3b, 0x03, 0x73, 0xa1, 0x2a, 0x09, 0x08, 0x67, 0xcc, 0xe2,
+  0x1a, 0x29, 0x6a, 0xf4, 0x76, 0x6a, 0x4d, 0x2b, 0x4a, 0xc5, 0x32, 0x8a, 0x6d, 0x55, 0x1d, 0xee,
+  0xee, 0x1c, 0xf4, 0xfb, 0xfd, 0x5f, 0x22, 0x74, 0x6e, 0x5a, 0x3c, 0x54, 0x6b, 0xd4, 0x26, 0xb8,
+  0x69, 0x8e, 0x34, 0x7b, 0xd2, 0x01, 0x6f, 0x00, 0xea, 0x10, 0x39, 0x70, 0x87, 0x6d, 0xda, 0xeb,
+  0x26, 0x76, 0x45, 0xb3, 0x2d, 0xe4, 0x4e, 0xdb, 0x72, 0x5f, 0xca, 0x9a, 0x67, 0x48, 0x48, 0x8d,
+  0x48, 0x9a, 0x52, 0xa5, 0x90, 0x9d, 0x26, 0xe0, 0xb8, 0x1b, 0x27, 0xd0, 0x6f, 0xe4, 0x8a, 0x22,
+  0x55, 0x57, 0x14, 0x31, 0x0d, 0xd7, 0x41, 0x44, 0x05, 0x49, 0xa0, 0x1d, 0x9b, 0x8b, 0x13, 0x74,
+  0x8a, 0x0a, 0x25, 0x95, 0xbc, 0x01, 0x8e, 0x41, 0x2b, 0xc9, 0x20, 0xaf, 0x5a, 0xcb, 0xe6, 0x87,
+  0xc3, 0xcf, 0x34, 0x31, 0x4d, 0xbd, 0x2e, 0x21, 0x5a, 0x0e, 0x87, 0x63, 0x5a, 0x5d, 0x53, 0xb8,
+  0x95, 0x50, 0x57, 0x91, 0x8c, 0xab, 0xdb, 0x31, 0xdc, 0x05, 0xc8, 0xab, 0x31, 0x46, 0x9d, 0x82,
+  0xdc, 0xba, 0x79, 0x2a, 0xc6, 0x47, 0xc6, 0xd1, 0x60, 0xba, 0xf1, 0x4c, 0xa4, 0xed, 0xd3, 0x80,
+  0x96, 0xd3, 0x29, 0xa7, 0xca, 0xdc, 0xc4, 0x21, 0x80, 0x29, 0x5c, 0xa2, 0xa1, 0x3c, 0xa2, 0x8a,
+  0xa6, 0x94, 0x5d, 0xd3, 0x25, 0x5e, 0x67, 0xfb, 0xa2, 0xd0, 0x44, 0xe0, 0x47, 0x07, 0x38, 0x60,
+  0xc3, 0xce, 0xc7, 0x9c, 0xa2, 0x89, 0xe4, 0x5c, 0xde, 0x98, 0x29, 0x03, 0x6c, 0x9b, 0xd6, 0xa0,
+  0x75, 0xc1, 0xfe, 0x26, 0x6d, 0x0b, 0x72, 0x96, 0x26, 0xa0, 0x7b, 0x2d, 0x18, 0x0c, 0x81, 0x8e,
+  0x27, 0x0c, 0x5f, 0x50, 0x9a, 0x91, 0x69, 0xcf, 0xa0, 0xca, 0x35, 0x4b, 0xa9, 0x95, 0x40, 0xe7,
+  0x60, 0x9d, 0x95, 0x35, 0x80, 0x49, 0xe7, 0x0f, 0x59, 0xa3, 0x1b, 0xc6, 0x39, 0x12, 0x14, 0x2c,
+  0x06, 0xe7, 0xec, 0xec, 0x06, 0x65, 0x1d, 0x91, 0x29, 0x4c, 0x82, 0x88, 0x4d, 0x50, 0x6d, 0x07,
+  0x5a, 0x82, 0x32, 0x36, 0x99, 0xd0, 0x0a, 0x6a, 0x6d, 0x0b, 0xe1, 0xb7, 0xd8, 0xe6, 0x3d, 0xc3,
+  0xb0, 0x3a, 0x7b, 0x6f, 0x6e, 0xb4, 0x15, 0xb8, 0xc8, 0xa1, 0x7f, 0xa0, 0x13, 0xf8, 0x27, 0xb7,
+  0xb2, 0x14, 0x06, 0x0d, 0x34, 0x00, 0x16, 0xa4, 0x2c, 0xf9, 0xcc, 0xbc, 0xf4, 0x88, 0x29, 0x55,
+  0xc1, 0xa0, 0xc7, 0x9c, 0xbe, 0x26, 0x5b, 0x4c, 0x74, 0x98, 0x2b, 0xc3, 0xb0, 0x73, 0x0e, 0xc9,
+  0x6a, 0xf8, 0xb6, 0x3a, 0x06, 0x41, 0xd0, 0xfa, 0xec, 0xc8, 0xbc, 0xf1, 0x9c, 0x94, 0x25, 0x25,
+  0xd0, 0x76, 0x52, 0x6a, 0xef, 0xb1, 0x2e, 0xb8, 0x9a, 0x64, 0xe3, 0xb6, 0xa5, 0x18, 0x57, 0xdf,
+  0x6f, 0x6c, 0xc3, 0xc9, 0x3c, 0xee, 0x5c, 0x36, 0xef, 0x38, 0x5b, 0xb7, 0xb8, 0xb5, 0x74, 0xb8,
+  0x03, 0xb4, 0xd3, 0xa0, 0xde, 0x0b, 0xea, 0x1e, 0x64, 0x7e, 0x08, 0xb4, 0xb3, 0x2d, 0xea, 0xfd,
+  0xa0, 0x2c, 0xbb, 0x13, 0xb1, 0x73, 0x86, 0xcc, 0x54, 0x84, 0xcc, 0x84, 0x62, 0x1f, 0x7a, 0x1e,
+  0x84, 0x82, 0xe9, 0xc6, 0x54, 0x02, 0x6b, 0xfd, 0x18, 0x9b, 0xe9, 0x0a, 0x6f, 0xe7, 0xfe, 0xc6,
+  0xa0, 0xd5, 0xa6, 0xe9, 0x66, 0x72, 0x42, 0x74, 0x7e, 0xce, 0x67, 0xe8, 0xc6, 0xa6, 0x26, 0x90,
+  0x8d, 0x90, 0xf1, 0xe3, 0xee, 0xce, 0xed, 0xc1, 0xaf, 0x2f, 0xfe, 0x79, 0x12, 0x59, 0xb1, 0xda,
+  0x74, 0x7b, 0xc4, 0x35, 0x9b, 0x57, 0xda, 0x82, 0x89, 0x18, 0xf7, 0x83, 0x3e, 0x7c, 0x91, 0xdb,
+  0x18, 0x1f, 0x98, 0x2f, 0xa8, 0xbe, 0xb4, 0xb4, 0xab, 0x07, 0x4e, 0x07, 0x37, 0x77, 0xd8, 0xf7,
+  0xaa, 0x4b, 0x4d, 0x92, 0x75, 0xab, 0x3c, 0xe2, 0x39, 0xc7, 0xb3, 0xf3, 0x03, 0x4c, 0x1f, 0xe2,
+  0x99, 0x4c, 0x37, 0x59, 0x76, 0x7e, 0x80, 0xe7, 0x1a, 0x88, 0xad, 0x78, 0x16, 0x64, 0xad, 0x90,
+  0xbc, 0x00, 0x3d, 0x1f, 0x53, 0x63, 0xfd, 0x8d, 0xed, 0x7e, 0xf8, 0x66, 0x96, 0xdb, 0x80, 0x03,
+  0x97, 0x5b, 0xb2, 0x26, 0x1a, 0x56, 0x83, 0xe2, 0xdd, 0x8c, 0xb6, 0x9e, 0xed, 0x1a, 0x5e, 0x9d,
+  0x07, 0x03, 0x6b, 0x7b, 0x18, 0xdc, 0x7e, 0x17, 0xe9, 0xac, 0xa2, 0x6e, 0x63, 0x76, 0x6e, 0xcb,
+  0xdd, 0xb6, 0x16, 0x66, 0x3a, 0xdf, 0x78, 0xa2, 0xe8, 0xdc, 0x1d, 0x89, 0xa6, 0x9a, 0xff, 0x40,
+  0x87, 0xdc, 0x68, 0x90, 0x9d, 0xff, 0xab, 0x43, 0xf6, 0xcc, 0xac, 0x00, 0x3f, 0x66, 0x9e, 0x30,
+  0xc3, 0x85, 0x79, 0xc6, 0xfe, 0x1f, 0x13, 0x4a, 0x4e, 0x49, 0xdc, 0x16, 0x00, 0x00
+};
 
 // Autogenerated from wled00/data/settings_sync.htm, do not edit!!
-const char PAGE_settings_sync[] PROGMEM = R"=====(<!DOCTYPE html><html lang="en"><head><meta name="viewport" content="width=500">
-<meta charset="utf-8"><title>Sync Settings</title><script>
-var d=document;function H(){window.open("https://github.com/Aircoookie/WLED/wiki/Settings#sync-settings")}function B(){window.open("/settings","_self")}function adj(){6454==d.Sf.DI.value?(1==d.Sf.DA.value&&(d.Sf.DA.value=0),1==d.Sf.EU.value&&(d.Sf.EU.value=0)):5568==d.Sf.DI.value&&(0==d.Sf.DA.value&&(d.Sf.DA.value=1),0==d.Sf.EU.value&&(d.Sf.EU.value=1))}function SP(){var e=d.Sf.DI.value;d.getElementById("xp").style.display=e>0?"none":"block",e>0&&(d.Sf.EP.value=e)}function SetVal(){switch(parseInt(d.Sf.EP.value)){case 5568:d.Sf.DI.value=5568;break;case 6454:d.Sf.DI.value=6454;break;case 4048:d.Sf.DI.value=4048}SP()}function S(){GetV(),SetVal()}function GetV() {
-%CSS%%SCSS%</head><body onload="S()"><form
- id="form_s" name="Sf" method="post"><div class="helpB"><button type="button" 
-onclick="H()">?</button></div><button type="button" onclick="B()">Back</button>
-<button type="submit">Save</button><hr><h2>Sync setup</h2><h3>Button setup</h3>
-On/Off button enabled: <input type="checkbox" name="BT"><br>Infrared remote: 
-<select name="IR"><option value="0">Disabled</option><option value="1">
-24-key RGB</option><option value="2">24-key with CT</option><option value="3">
-40-key blue</option><option value="4">44-key RGB</option><option value="5">
-21-key RGB</option><option value="6">6-key black</option><option value="7">
-9-key red</option></select><br><a 
-href="https://github.com/Aircoookie/WLED/wiki/Infrared-Control" target="_blank">
-IR info</a><h3>WLED Broadcast</h3>UDP Port: <input name="UP" type="number" 
-min="1" max="65535" class="d5" required><br>2nd Port: <input name="U2" 
-type="number" min="1" max="65535" class="d5" required><br>Receive <input 
-type="checkbox" name="RB">Brightness, <input type="checkbox" name="RC">
-Color, and <input type="checkbox" name="RX">Effects<br>
-Send notifications on direct change: <input type="checkbox" name="SD"><br>
-Send notifications on button press or IR: <input type="checkbox" name="SB"><br>
-Send Alexa notifications: <input type="checkbox" name="SA"><br>
-Send Philips Hue change notifications: <input type="checkbox" name="SH"><br>
-Send Macro notifications: <input type="checkbox" name="SM"><br>
-Send notifications twice: <input type="checkbox" name="S2"><br><i>
-Reboot required to apply changes.</i><h3>Realtime</h3>Receive UDP realtime: 
-<input type="checkbox" name="RD"><br><br><i>Network DMX input</i><br>Type: 
-<select name="DI" onchange="SP(),adj()"><option value="5568">E1.31 (sACN)
-</option><option value="6454">Art-Net</option><option value="4048">DDP</option>
-<option value="0" selected="selected">Custom port</option></select><br><div 
-id="xp">Port: <input name="EP" type="number" min="1" max="65535" value="5568" 
-class="d5" required><br></div>Multicast: <input type="checkbox" name="EM"><br>
-Start universe: <input name="EU" type="number" min="0" max="63999" required><br>
-<i>Reboot required.</i> Check out <a href="https://github.com/LedFx/LedFx" 
-target="_blank">LedFx</a>!<br>Skip out-of-sequence packets: <input 
-type="checkbox" name="ES"><br>DMX start address: <input name="DA" type="number" 
-min="0" max="510" required><br>DMX mode: <select name="DM"><option value="0">
-Disabled</option><option value="1">Single RGB</option><option value="2">
-Single DRGB</option><option value="3">Effect</option><option value="4">Multi RGB
-</option><option value="5">Dimmer + Multi RGB</option><option value="6">
-Multi RGBW</option></select><br><a 
-href="https://github.com/Aircoookie/WLED/wiki/E1.31-DMX" target="_blank">
-E1.31 info</a><br>Timeout: <input name="ET" type="number" min="1" max="65000" 
-required> ms<br>Force max brightness: <input type="checkbox" name="FB"><br>
-Disable realtime gamma correction: <input type="checkbox" name="RG"><br>
-Realtime LED offset: <input name="WO" type="number" min="-255" max="255" 
-required><h3>Alexa Voice Assistant</h3>Emulate Alexa device: <input 
-type="checkbox" name="AL"><br>Alexa invocation name: <input name="AI" 
-maxlength="32"><h3>Blynk</h3><b>
-Blynk, MQTT and Hue sync all connect to external hosts!<br>
-This may impact the responsiveness of the ESP8266.</b><br>
-For best results, only use one of these services at a time.<br>
-(alternatively, connect a second ESP to them and use the UDP sync)<br><br>Host: 
-<input name="BH" maxlength="32"> Port: <input name="BP" type="number" min="1" 
-max="65535" value="80" class="d5"><br>Device Auth token: <input name="BK" 
-maxlength="33"><br><i>Clear the token field to disable. </i><a 
-href="https://github.com/Aircoookie/WLED/wiki/Blynk" target="_blank">Setup info
-</a><h3>MQTT</h3>Enable MQTT: <input type="checkbox" name="MQ"><br>Broker: 
-<input name="MS" maxlength="32"> Port: <input name="MQPORT" type="number" 
-min="1" max="65535" class="d5"><br><b>
-The MQTT credentials are sent over an unsecured connection.<br>
-Never use the MQTT password for another service!</b><br>Username: <input 
-name="MQUSER" maxlength="40"><br>Password: <input type="password" name="MQPASS" 
-maxlength="40"><br>Client ID: <input name="MQCID" maxlength="40"><br>
-Device Topic: <input name="MD" maxlength="32"><br>Group Topic: <input name="MG" 
-maxlength="32"><br><i>Reboot required to apply changes. </i><a 
-href="https://github.com/Aircoookie/WLED/wiki/MQTT" target="_blank">MQTT info
-</a><h3>Philips Hue</h3><i>
-You can find the bridge IP and the light number in the 'About' section of the hue app.
-</i><br>Poll Hue light <input name="HL" type="number" min="1" max="99"> every 
-<input name="HI" type="number" min="100" max="65000"> ms: <input 
-type="checkbox" name="HP"><br>Then, receive <input type="checkbox" name="HO">
- On/Off, <input type="checkbox" name="HB"> Brightness, and <input 
-type="checkbox" name="HC"> Color<br>Hue Bridge IP:<br><input name="H0" 
-type="number" min="0" max="255"> . <input name="H1" type="number" min="0" 
-max="255"> . <input name="H2" type="number" min="0" max="255"> . <input 
-name="H3" type="number" min="0" max="255"><br><b>
-Press the pushlink button on the bridge, after that save this page!</b><br>
-(when first connecting)<br>Hue status: <span class="sip">Disabled in this build
-</span><hr><button type="button" onclick="B()">Back</button><button 
-type="submit">Save</button></form></body></html>)=====";
-
+const uint16_t PAGE_settings_sync_length = 2533;
+const uint8_t PAGE_settings_sync[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x6d, 0x73, 0xda, 0x48,
+  0x12, 0xfe, 0xae, 0x5f, 0x31, 0x51, 0xea, 0x76, 0x4d, 0x9d, 0x79, 0x31, 0x18, 0x5f, 0x82, 0x81,
+  0x14, 0x18, 0x27, 0x66, 0x2f, 0x4e, 0x88, 0x71, 0x92, 0xdd, 0xba, 0xba, 0x4a, 0x0d, 0xd2, 0x08,
+  0x4d, 0x90, 0x66, 0xb4, 0x9a, 0x91, 0x6d, 0xce, 0xe5, 0xff, 0x7e, 0xdd, 0x33, 0x12, 0x16, 0x18,
+  0x4c, 0x72, 0xb5, 0xf7, 0x21, 0x09, 0x1a, 0x75, 0xf7, 0xf4, 0x74, 0x3f, 0xfd, 0x74, 0x8f, 0xd2,
+  0x7d, 0x31, 0xfa, 0x78, 0x76, 0xfd, 0xc7, 0xe4, 0x9c, 0x84, 0x3a, 0x8e, 0xfa, 0x5d, 0xfc, 0x9b,
+  0x44, 0x54, 0xcc, 0x7b, 0x2e, 0x13, 0x2e, 0x3c, 0x33, 0xea, 0xf7, 0xbb, 0x31, 0xd3, 0x94, 0x08,
+  0x1a, 0xb3, 0x9e, 0x7b, 0xc3, 0xd9, 0x6d, 0x22, 0x53, 0xed, 0x12, 0x4f, 0x0a, 0xcd, 0x84, 0xee,
+  0xb9, 0xb7, 0xdc, 0xd7, 0x61, 0xaf, 0xdd, 0x68, 0xb8, 0x7d, 0xc7, 0x8a, 0x7a, 0x21, 0x4d, 0x15,
+  0x83, 0x57, 0x99, 0x0e, 0xaa, 0xaf, 0xc0, 0x8c, 0xe6, 0x3a, 0x62, 0xfd, 0xe9, 0x52, 0x78, 0x64,
+  0xca, 0xb4, 0xe6, 0x62, 0xae, 0xba, 0x75, 0xbb, 0xd8, 0x55, 0x5e, 0xca, 0x13, 0xdd, 0x77, 0x6e,
+  0x68, 0x4a, 0xfc, 0x9e, 0x2f, 0xbd, 0x2c, 0x06, 0xb3, 0xa7, 0x41, 0x26, 0x3c, 0xcd, 0xa5, 0x20,
+  0x17, 0x07, 0x95, 0xfb, 0x5b, 0x2e, 0x7c, 0x79, 0x5b, 0x93, 0x09, 0x13, 0x07, 0x6e, 0xa8, 0x75,
+  0xa2, 0x3a, 0xf5, 0xfa, 0x9c, 0xeb, 0x30, 0x9b, 0xd5, 0x3c, 0x19, 0xd7, 0x07, 0x3c, 0xf5, 0xa4,
+  0x94, 0x0b, 0xce, 0xea, 0x5f, 0xdf, 0x9f, 0x8f, 0xea, 0xb7, 0x7c, 0xc1, 0xeb, 0xc5, 0x4e, 0x2f,
+  0x15, 0xec, 0x5b, 0x55, 0xf9, 0x93, 0x5b, 0x79, 0x58, 0x99, 0x1e, 0x6e, 0x9a, 0xae, 0xaf, 0xa4,
+  0x0e, 0xdd, 0x6f, 0x8a, 0x45, 0x41, 0x59, 0x9a, 0xfa, 0xdf, 0x41, 0xfe, 0xe4, 0xb8, 0x7d, 0xdc,
+  0xeb, 0xf9, 0xb5, 0x69, 0x50, 0x1b, 0x8d, 0x6b, 0x37, 0x34, 0xca, 0xd8, 0x9b, 0x83, 0xa3, 0x62,
+  0x65, 0x60, 0x57, 0x7e, 0xf9, 0xe5, 0x60, 0xed, 0xb9, 0xd7, 0xa8, 0x1c, 0x16, 0x32, 0xe7, 0x9f,
+  0xd7, 0x65, 0x8a, 0x67, 0x90, 0xa9, 0x74, 0xda, 0xed, 0x93, 0x57, 0x1b, 0xd6, 0x41, 0xae, 0xb1,
+  0xcf, 0xfc, 0x51, 0xe5, 0xb0, 0xb1, 0xcf, 0xfc, 0x51, 0xa5, 0x74, 0x96, 0xe9, 0x04, 0x8e, 0x82,
+  0x11, 0x67, 0xeb, 0x9b, 0x9d, 0xfa, 0xb5, 0x39, 0xd3, 0xe7, 0x11, 0xc3, 0x1c, 0x0c, 0x97, 0x63,
+  0xff, 0xc0, 0xbd, 0x4b, 0xdc, 0x4a, 0x4d, 0xe9, 0x65, 0xc4, 0x6a, 0x3e, 0x57, 0x49, 0x44, 0x97,
+  0x3d, 0xd6, 0x6f, 0xbc, 0x71, 0x85, 0x14, 0xcc, 0xed, 0xb8, 0xb3, 0x48, 0x7a, 0x0b, 0xf7, 0x10,
+  0x96, 0x56, 0x3b, 0x4e, 0xf2, 0x1d, 0x59, 0x79, 0x43, 0xa6, 0xbf, 0xd0, 0x08, 0x36, 0x55, 0xb7,
+  0x5c, 0x7b, 0xe1, 0x41, 0x82, 0x08, 0x19, 0x0b, 0xbd, 0xae, 0x52, 0xa9, 0xdc, 0x7b, 0x54, 0x31,
+  0x82, 0x61, 0xe8, 0xac, 0x39, 0xd6, 0xc3, 0xa5, 0xd3, 0x59, 0xca, 0xe8, 0xe2, 0xd4, 0x88, 0x60,
+  0x1e, 0x36, 0x44, 0x70, 0xa9, 0x2c, 0x72, 0xdc, 0x38, 0xde, 0xb4, 0x82, 0x4b, 0x0f, 0x78, 0xf8,
+  0x92, 0x67, 0xe0, 0xd4, 0x3b, 0xf0, 0xee, 0xa0, 0x72, 0x58, 0x38, 0xf9, 0xd0, 0xad, 0xe7, 0xa8,
+  0xcc, 0xd1, 0x49, 0x54, 0xea, 0xf5, 0x1e, 0xd1, 0x51, 0x57, 0xb5, 0xef, 0xea, 0x4d, 0xd2, 0x3b,
+  0x06, 0x68, 0x3f, 0x4a, 0x62, 0x88, 0xfa, 0x33, 0xe9, 0x2f, 0xef, 0x03, 0x28, 0x8d, 0x6a, 0x40,
+  0x63, 0x1e, 0x2d, 0x3b, 0x5f, 0x58, 0xea, 0x53, 0x41, 0x0f, 0x15, 0x15, 0x0a, 0x40, 0x98, 0xf2,
+  0xe0, 0x54, 0xb3, 0x3b, 0x5d, 0xa5, 0x11, 0x9f, 0x8b, 0x8e, 0x07, 0x61, 0x66, 0xe9, 0xe9, 0x8c,
+  0x7a, 0x8b, 0x79, 0x2a, 0x33, 0xe1, 0x77, 0x5e, 0x36, 0x9b, 0xcd, 0x53, 0x4f, 0x46, 0x32, 0xed,
+  0xbc, 0x0c, 0x82, 0xe0, 0x34, 0xe2, 0x82, 0x55, 0x43, 0xc6, 0xe7, 0xa1, 0xee, 0x34, 0x1b, 0x8d,
+  0xbf, 0x9d, 0xc6, 0x34, 0x9d, 0x73, 0xd1, 0x69, 0x3c, 0x84, 0xe9, 0xfd, 0x4c, 0xa6, 0x3e, 0x4b,
+  0xab, 0xb9, 0xf8, 0xc9, 0xc9, 0xc9, 0xc3, 0x2c, 0xd3, 0x5a, 0x8a, 0xfb, 0xb2, 0xc1, 0x56, 0xab,
+  0x55, 0x36, 0xb8, 0xc7, 0x39, 0x6b, 0xb2, 0x53, 0x6b, 0x79, 0x21, 0x51, 0x32, 0xe2, 0x3e, 0x31,
+  0x06, 0xf2, 0xd4, 0x77, 0xb8, 0x30, 0x0e, 0x99, 0xac, 0x5b, 0x53, 0x8a, 0xff, 0x87, 0x81, 0x67,
+  0xc9, 0x5d, 0xe1, 0xd9, 0xab, 0xd5, 0xcf, 0xaa, 0x96, 0x49, 0xe7, 0xa8, 0x99, 0xdc, 0x3d, 0xd4,
+  0x42, 0x16, 0x25, 0xc3, 0xfb, 0xd2, 0xc9, 0x23, 0x16, 0xe8, 0xd3, 0x44, 0x2a, 0x8e, 0x49, 0xe8,
+  0xd0, 0x19, 0xec, 0x95, 0x69, 0x76, 0x6a, 0xc8, 0xa4, 0x73, 0x02, 0xe6, 0x1e, 0xb8, 0x48, 0x32,
+  0xfd, 0x17, 0x9c, 0xa4, 0xbd, 0x76, 0x12, 0x6b, 0xf6, 0x5f, 0x7a, 0x99, 0xb0, 0x9e, 0xc8, 0xe2,
+  0x19, 0x4b, 0xff, 0x7d, 0x6f, 0x37, 0x3d, 0x66, 0xf1, 0x03, 0xd4, 0x3c, 0xf3, 0xfe, 0x0f, 0x9b,
+  0x6a, 0xff, 0x3e, 0xa1, 0xbe, 0x0f, 0xe0, 0xe9, 0x98, 0x70, 0xf8, 0xed, 0x62, 0xd3, 0x5a, 0x9b,
+  0xc5, 0x2f, 0x78, 0x8c, 0x9c, 0x4a, 0x85, 0x46, 0xe4, 0x19, 0x1c, 0x75, 0xeb, 0x96, 0x7a, 0x11,
+  0x4f, 0x44, 0x8a, 0x48, 0x52, 0xbf, 0xe7, 0x02, 0x54, 0x01, 0x71, 0x81, 0x4c, 0x63, 0x87, 0x70,
+  0x78, 0xc6, 0x5f, 0xdf, 0x94, 0x9b, 0x53, 0xf3, 0x34, 0x70, 0x09, 0xd0, 0x6f, 0x28, 0xe1, 0x0d,
+  0x04, 0x56, 0x83, 0xa8, 0xcf, 0x6f, 0x88, 0x17, 0x51, 0xa5, 0x7a, 0xae, 0x49, 0x00, 0x2c, 0x59,
+  0x80, 0x10, 0x73, 0x7e, 0xd7, 0x3e, 0xb8, 0xc4, 0x91, 0xc2, 0x8b, 0xb8, 0xb7, 0xe8, 0xb9, 0x17,
+  0xb8, 0xc5, 0x9b, 0x6e, 0xdd, 0xbe, 0x01, 0x37, 0xc0, 0xc4, 0x0e, 0xa5, 0x95, 0xce, 0x10, 0x75,
+  0x86, 0x10, 0xb2, 0x95, 0x9a, 0xb3, 0xae, 0xa1, 0xb2, 0x59, 0xcc, 0xc1, 0x9f, 0x29, 0xbd, 0x61,
+  0x8f, 0xa6, 0xc3, 0x14, 0xfe, 0x34, 0x6d, 0x57, 0x80, 0xca, 0xca, 0x12, 0x38, 0x73, 0x13, 0x96,
+  0x5a, 0xfd, 0xa1, 0x55, 0x2e, 0x16, 0x5b, 0x7d, 0xe7, 0xa3, 0xa8, 0x7f, 0x0c, 0x02, 0x92, 0x5b,
+  0x65, 0x82, 0xce, 0x22, 0xe6, 0x77, 0x48, 0xd7, 0x24, 0x33, 0xdf, 0xc5, 0x0b, 0x99, 0xb7, 0x98,
+  0xc9, 0xbb, 0x22, 0x1e, 0xc3, 0x6b, 0x3c, 0x6e, 0xda, 0x1f, 0x8b, 0x20, 0xa5, 0x29, 0xf3, 0x49,
+  0xca, 0x62, 0xa9, 0x59, 0x87, 0x38, 0x5d, 0x9b, 0xe6, 0x5c, 0x6e, 0x7c, 0x05, 0x72, 0x32, 0x31,
+  0x64, 0x60, 0x59, 0xc2, 0x85, 0x56, 0x36, 0xe2, 0xca, 0x6c, 0xd2, 0xad, 0xdb, 0x57, 0x9b, 0x22,
+  0x47, 0xd0, 0xed, 0x9a, 0xc7, 0xd5, 0x05, 0x5b, 0x92, 0xab, 0x77, 0xc3, 0x5d, 0x52, 0x4d, 0xb7,
+  0x9f, 0x0b, 0x01, 0xed, 0x85, 0xe4, 0xec, 0x7a, 0x97, 0x60, 0x0b, 0xcc, 0x1d, 0x37, 0x8c, 0xe4,
+  0x0c, 0x16, 0x76, 0x89, 0x01, 0xe3, 0x1c, 0xef, 0xdd, 0xb4, 0x8d, 0xae, 0x1d, 0xed, 0x93, 0x3a,
+  0x71, 0xfb, 0x27, 0xf9, 0x7e, 0x26, 0x75, 0xdb, 0xa5, 0xfe, 0x01, 0xb6, 0x5e, 0x1b, 0xb1, 0xb4,
+  0x1c, 0x8b, 0xba, 0x8d, 0xa0, 0x89, 0x6f, 0x97, 0x12, 0x27, 0x4c, 0x59, 0xd0, 0xfb, 0xe1, 0xce,
+  0x5c, 0x64, 0xa4, 0x7a, 0x06, 0xc5, 0x94, 0xca, 0xc8, 0x25, 0x1a, 0xf8, 0x02, 0x07, 0x86, 0x6f,
+  0xe0, 0x8c, 0x58, 0xc0, 0x9e, 0xe3, 0x2b, 0xc2, 0x45, 0x20, 0xbb, 0x75, 0x6a, 0x10, 0x81, 0xba,
+  0x64, 0x98, 0x42, 0x15, 0x00, 0xb3, 0x6b, 0x83, 0x89, 0xcf, 0xa3, 0x09, 0x99, 0x40, 0xd5, 0xac,
+  0x50, 0x60, 0xb3, 0xf9, 0x79, 0xe2, 0xe6, 0x78, 0xb0, 0xd5, 0x0d, 0xe0, 0x8e, 0xb9, 0xc0, 0x7c,
+  0x91, 0x98, 0xde, 0xc1, 0xb1, 0xdb, 0xed, 0x56, 0xdb, 0x2d, 0xaa, 0xc2, 0x87, 0x9f, 0x29, 0xfb,
+  0x33, 0xe3, 0xe0, 0x8d, 0x39, 0x4c, 0x53, 0xf8, 0x5b, 0xad, 0x36, 0xc1, 0xce, 0xba, 0xd9, 0x9f,
+  0xb1, 0x7a, 0xc5, 0x3c, 0xc6, 0x6f, 0x58, 0x61, 0xd3, 0xd9, 0x0e, 0xd8, 0x2b, 0xa8, 0xcf, 0x61,
+  0x8a, 0x4c, 0x2f, 0x98, 0x52, 0x87, 0xcf, 0xa3, 0xfb, 0xea, 0x0c, 0xa2, 0x74, 0x86, 0xbc, 0x74,
+  0x48, 0x28, 0x38, 0xfd, 0xbc, 0xf0, 0xef, 0x6e, 0xff, 0x3c, 0x08, 0x20, 0x63, 0x0a, 0xdd, 0x71,
+  0xa6, 0x0c, 0x34, 0x84, 0xd4, 0x3c, 0xe0, 0x1e, 0xc5, 0x8c, 0x2a, 0xa8, 0x66, 0xe2, 0x83, 0xbf,
+  0x50, 0x15, 0x30, 0xbd, 0x89, 0x39, 0xdb, 0x53, 0x5c, 0xd3, 0x91, 0x2d, 0xae, 0x1d, 0xa6, 0xf2,
+  0x42, 0x4d, 0x52, 0x38, 0x08, 0x91, 0x29, 0x19, 0x5f, 0xed, 0xb3, 0x37, 0x2c, 0xdb, 0x1b, 0x44,
+  0xec, 0x8e, 0xae, 0x5b, 0xdd, 0xa7, 0x3f, 0x28, 0xeb, 0x4f, 0x42, 0x1e, 0xf1, 0x44, 0x91, 0x8b,
+  0x8c, 0xe5, 0xc7, 0xf9, 0x39, 0x63, 0x17, 0x65, 0x63, 0x97, 0xd4, 0x4b, 0xe5, 0xcf, 0xe9, 0x5f,
+  0xee, 0x0e, 0x8e, 0xbe, 0xe5, 0xde, 0xde, 0xe0, 0x36, 0xad, 0x7e, 0x97, 0xf7, 0x9d, 0x2b, 0x36,
+  0x93, 0x52, 0xaf, 0xe0, 0x44, 0xb4, 0x24, 0x34, 0x49, 0xa2, 0x65, 0x7e, 0x2e, 0x55, 0xeb, 0xd6,
+  0xb9, 0x29, 0x91, 0x2b, 0x46, 0x23, 0xcd, 0x63, 0x66, 0x8a, 0xa3, 0x00, 0x1c, 0x16, 0x49, 0x9a,
+  0xbf, 0x40, 0xe2, 0x7b, 0x16, 0x24, 0x79, 0x4a, 0xf3, 0x9d, 0x3f, 0x30, 0x7d, 0x2b, 0xd3, 0x05,
+  0x19, 0x5d, 0xfe, 0x4e, 0x8c, 0x9a, 0xd9, 0x08, 0xde, 0x5d, 0x83, 0xf6, 0x13, 0x12, 0x1d, 0x8d,
+  0x4d, 0x43, 0x30, 0x3e, 0xc1, 0x01, 0x60, 0xc2, 0x3a, 0x34, 0xf3, 0xf2, 0x13, 0x6a, 0xc5, 0x39,
+  0x0e, 0xc0, 0x78, 0x54, 0x6b, 0x1d, 0x91, 0x03, 0x35, 0x38, 0xfb, 0x50, 0x71, 0x76, 0x32, 0x14,
+  0xcc, 0x73, 0x6e, 0x7f, 0x90, 0xea, 0x2a, 0xf8, 0xb2, 0x93, 0x11, 0x61, 0xa2, 0x03, 0xb6, 0x1e,
+  0x4d, 0x56, 0x02, 0xce, 0x13, 0x32, 0x27, 0xd6, 0x55, 0x06, 0x8d, 0xb1, 0xf8, 0xe5, 0xf6, 0xcf,
+  0x32, 0xa5, 0x65, 0x4c, 0xb0, 0xf1, 0xee, 0xe0, 0x35, 0xec, 0x9e, 0x0e, 0xf6, 0x59, 0x18, 0x81,
+  0xfb, 0x5b, 0x48, 0xe1, 0xfc, 0x09, 0xd5, 0x6c, 0xe3, 0x84, 0xf2, 0xb9, 0x89, 0xb3, 0x8b, 0x21,
+  0x6c, 0xa3, 0xbd, 0xcc, 0x20, 0x53, 0xc8, 0x70, 0x7b, 0x00, 0x72, 0xbe, 0x02, 0x18, 0x10, 0xa7,
+  0x26, 0x99, 0x80, 0x5c, 0xc3, 0x3c, 0xbd, 0xe9, 0xdf, 0xe7, 0xad, 0xfe, 0x35, 0x0a, 0xff, 0x5a,
+  0xaf, 0x5f, 0xbf, 0xde, 0x70, 0x03, 0x10, 0xd2, 0xdf, 0x40, 0x9c, 0x01, 0x18, 0x39, 0x43, 0x0f,
+  0x88, 0x04, 0xdb, 0x40, 0xf7, 0x3b, 0xd9, 0xfe, 0x3d, 0xf3, 0xdf, 0xde, 0xd9, 0xbf, 0x91, 0x2f,
+  0x37, 0x48, 0xdd, 0xac, 0x23, 0xa3, 0xbf, 0xc0, 0xad, 0xa6, 0x0b, 0x9e, 0xa0, 0xc1, 0xaa, 0x0c,
+  0x60, 0x76, 0xfa, 0x33, 0x63, 0xc2, 0x63, 0x24, 0x81, 0x56, 0xc4, 0xf4, 0x63, 0x7d, 0xed, 0x60,
+  0xca, 0xf3, 0xa9, 0x3d, 0x3f, 0x62, 0x53, 0x99, 0x10, 0xc0, 0x70, 0x85, 0x5c, 0xb3, 0x11, 0x81,
+  0xd1, 0x60, 0x7b, 0x33, 0x28, 0x42, 0xd0, 0x3e, 0x6a, 0x6c, 0x04, 0x00, 0x2d, 0xc6, 0xd2, 0xc7,
+  0x50, 0xae, 0xe3, 0xfb, 0x72, 0xdb, 0x90, 0xe0, 0xfc, 0xc0, 0x94, 0x30, 0x85, 0xa1, 0x2f, 0x62,
+  0x7b, 0x86, 0x04, 0x27, 0x97, 0x1a, 0x3d, 0x23, 0xd6, 0x2a, 0x38, 0xfc, 0x99, 0xe1, 0xc0, 0x00,
+  0x08, 0xf7, 0x72, 0x9e, 0x19, 0x0e, 0x46, 0x3c, 0x8e, 0x59, 0x4a, 0xfe, 0x4e, 0x56, 0xd2, 0xcf,
+  0xcc, 0x08, 0xce, 0x4a, 0xe8, 0xeb, 0x5f, 0xd5, 0xfe, 0x4d, 0xf1, 0x57, 0x21, 0xd2, 0x5b, 0xfa,
+  0xbe, 0x25, 0x86, 0x55, 0xeb, 0x47, 0xba, 0x01, 0xea, 0x02, 0x98, 0x6c, 0x62, 0xfb, 0x7a, 0x4f,
+  0xed, 0x35, 0x1a, 0x90, 0x5a, 0x67, 0x95, 0x5b, 0x12, 0x9b, 0xce, 0xf7, 0x56, 0xa6, 0x80, 0x32,
+  0x10, 0x21, 0xb3, 0x55, 0xa3, 0xdd, 0x53, 0x6b, 0x6f, 0x8b, 0xce, 0x94, 0xe7, 0x7a, 0xc5, 0xa7,
+  0x64, 0x4e, 0xe3, 0x98, 0x12, 0x4f, 0xa6, 0xd8, 0x36, 0xf1, 0x16, 0xb3, 0xa7, 0x09, 0xbf, 0xcb,
+  0x0d, 0x15, 0x4c, 0x4d, 0x70, 0xa8, 0x91, 0x41, 0x00, 0x73, 0xee, 0xc6, 0xe9, 0xbe, 0x7e, 0xdc,
+  0x7a, 0xba, 0x6a, 0xb3, 0xdd, 0xce, 0x0f, 0x68, 0x7e, 0x39, 0x6b, 0xd0, 0x2d, 0x73, 0x3d, 0xf9,
+  0xce, 0x35, 0x5c, 0x2c, 0xa1, 0x0f, 0x03, 0x62, 0xd2, 0x0d, 0xeb, 0xbf, 0x0d, 0x77, 0xf1, 0x82,
+  0x63, 0x6c, 0x1f, 0x97, 0x6a, 0x82, 0xc0, 0xa4, 0x16, 0x33, 0x45, 0x0e, 0x1a, 0xa4, 0x87, 0xbe,
+  0x56, 0xec, 0x44, 0x0d, 0xb6, 0x13, 0x19, 0x51, 0xcd, 0xc8, 0x0c, 0xda, 0x04, 0x63, 0x22, 0x97,
+  0xdb, 0x57, 0xb8, 0xbf, 0x8d, 0x5d, 0xd3, 0xac, 0x6c, 0x83, 0xff, 0x22, 0xa1, 0x17, 0x92, 0x81,
+  0x52, 0x5c, 0xe1, 0xe5, 0xc7, 0x74, 0xae, 0xf3, 0x38, 0x33, 0x76, 0xad, 0x84, 0xcf, 0x6e, 0xca,
+  0xed, 0x72, 0x87, 0xd5, 0xc1, 0x7b, 0x1b, 0x59, 0xab, 0xc3, 0xc5, 0x8d, 0xb4, 0xdd, 0xd6, 0xbc,
+  0xde, 0x38, 0xfc, 0x60, 0x6c, 0x8f, 0x19, 0x31, 0x31, 0xd7, 0x21, 0x54, 0x55, 0xd3, 0x7a, 0x34,
+  0x8c, 0x96, 0x62, 0x61, 0x3c, 0xe8, 0xce, 0xfa, 0x8e, 0x79, 0x3a, 0x24, 0x97, 0x9f, 0xae, 0xaf,
+  0xcd, 0x74, 0x85, 0x83, 0x04, 0x7e, 0x46, 0x22, 0x34, 0x8a, 0xf0, 0xcb, 0x97, 0x40, 0x66, 0x80,
+  0x56, 0x0c, 0xf7, 0x59, 0x96, 0x0a, 0x1a, 0x91, 0x10, 0x2e, 0x5c, 0xca, 0xf0, 0x9a, 0x73, 0x1d,
+  0x72, 0x05, 0x49, 0x5a, 0x12, 0xb8, 0xd5, 0x51, 0x14, 0x0b, 0x11, 0x33, 0x2a, 0x81, 0xee, 0x0f,
+  0x34, 0x2d, 0xcc, 0x44, 0x14, 0x98, 0xd5, 0xf3, 0xe9, 0xe4, 0x55, 0xf3, 0xe4, 0x04, 0x18, 0x76,
+  0x66, 0x91, 0x01, 0xf0, 0x84, 0x80, 0x2a, 0x24, 0x5f, 0x05, 0x65, 0x07, 0x33, 0x20, 0x5c, 0xfd,
+  0x96, 0x24, 0x53, 0x0c, 0x7e, 0xb0, 0x5c, 0x0d, 0x1e, 0xe0, 0xae, 0x89, 0x71, 0x51, 0x84, 0x02,
+  0xf3, 0x11, 0x4c, 0x78, 0xcd, 0xe8, 0x1f, 0x40, 0xf6, 0xd1, 0x1f, 0x0d, 0x1b, 0x45, 0xcb, 0xc3,
+  0x95, 0xa7, 0x14, 0x34, 0xe0, 0xb7, 0x8f, 0x3b, 0xa2, 0xdb, 0x60, 0x25, 0x36, 0xe7, 0x42, 0xcb,
+  0xe8, 0x09, 0x62, 0x07, 0xcf, 0x57, 0x29, 0x06, 0x80, 0x0b, 0x89, 0x4d, 0xc8, 0x59, 0x0b, 0xdd,
+  0xf0, 0xc2, 0x80, 0xaf, 0x1c, 0xb9, 0x6d, 0xb3, 0xf2, 0x70, 0x67, 0x5b, 0x74, 0xb6, 0xf4, 0xc5,
+  0x57, 0x8d, 0xf2, 0xd8, 0x6c, 0x39, 0xd8, 0x24, 0x9d, 0x0c, 0x32, 0xb8, 0x31, 0x69, 0xb9, 0x60,
+  0x62, 0x73, 0x83, 0x7f, 0x6e, 0xa4, 0xb0, 0xb5, 0x1a, 0x97, 0xce, 0x22, 0x46, 0x53, 0x73, 0x22,
+  0xa3, 0x48, 0x02, 0xce, 0x22, 0x33, 0x33, 0xf9, 0xb6, 0x78, 0x6b, 0xc4, 0x4c, 0x31, 0x3f, 0x4d,
+  0x59, 0x06, 0x0f, 0x4f, 0xe9, 0x6a, 0x8a, 0x37, 0x54, 0xc3, 0x56, 0x4e, 0x71, 0x53, 0x41, 0xc8,
+  0x58, 0x20, 0x9b, 0x4b, 0xaa, 0x81, 0xd0, 0x1e, 0x62, 0xb8, 0xfc, 0x64, 0xfd, 0x87, 0xfb, 0xcd,
+  0x02, 0x8b, 0x75, 0x3d, 0xea, 0x97, 0xd3, 0x1f, 0x8a, 0xfa, 0xe5, 0xa7, 0xc9, 0xc7, 0xab, 0xeb,
+  0x9f, 0xbc, 0xfb, 0xe4, 0xf3, 0x1e, 0x62, 0xd6, 0x7a, 0x4a, 0x3c, 0x28, 0x7a, 0x26, 0x34, 0xa7,
+  0x11, 0x80, 0x2b, 0x45, 0xa4, 0x09, 0x4d, 0x24, 0x4c, 0x17, 0x00, 0x17, 0x98, 0x33, 0x00, 0x46,
+  0x19, 0x4e, 0xa1, 0x39, 0xb0, 0xa0, 0xc6, 0x2c, 0xf0, 0x3e, 0x30, 0x14, 0x29, 0xd0, 0x64, 0x2c,
+  0x25, 0xb0, 0x09, 0x0c, 0x90, 0x3e, 0x09, 0x24, 0x2a, 0x4b, 0x78, 0x91, 0x16, 0xc0, 0x7d, 0x51,
+  0x20, 0xfe, 0xb3, 0x42, 0xb8, 0x96, 0x8a, 0xd4, 0x29, 0x4e, 0xf3, 0x79, 0x7a, 0x7e, 0xb5, 0x76,
+  0xf0, 0xe3, 0x86, 0x75, 0x77, 0x92, 0xdb, 0xdd, 0x08, 0x6a, 0xb1, 0xdd, 0x63, 0x50, 0x27, 0x83,
+  0xe9, 0x74, 0x1d, 0x28, 0x85, 0x89, 0xb3, 0x88, 0xe3, 0xb1, 0xc6, 0xa3, 0x27, 0x31, 0x3c, 0x1b,
+  0x8f, 0xb6, 0x6e, 0xea, 0xe4, 0x98, 0xbc, 0x96, 0x09, 0xf7, 0x36, 0xb5, 0x46, 0x4f, 0x12, 0x84,
+  0x2a, 0xef, 0x52, 0x09, 0xd8, 0xd8, 0xaa, 0xf0, 0x6e, 0x0b, 0x05, 0x59, 0xfc, 0xee, 0x9d, 0xf6,
+  0xff, 0x47, 0xfc, 0x62, 0x46, 0x9e, 0xc2, 0xd7, 0xe4, 0x69, 0x0d, 0xbd, 0xa5, 0x8b, 0x93, 0xe5,
+  0x42, 0xb8, 0x81, 0xfc, 0x21, 0x33, 0xe2, 0x51, 0xac, 0x25, 0x20, 0x0c, 0x4c, 0x2f, 0xb4, 0x4e,
+  0x1f, 0x6e, 0x54, 0xe3, 0x89, 0xa1, 0x10, 0x5c, 0x89, 0xb0, 0x97, 0x12, 0x0b, 0x3a, 0x30, 0x68,
+  0xd6, 0x7e, 0x1d, 0xcc, 0xa0, 0x6d, 0xff, 0x8a, 0xcc, 0x63, 0xb8, 0x38, 0xe7, 0xbc, 0x10, 0x98,
+  0x14, 0x8e, 0x54, 0x73, 0x8a, 0xeb, 0xc4, 0x44, 0x02, 0xa5, 0x22, 0xbf, 0x5a, 0x23, 0x6b, 0x91,
+  0xba, 0x78, 0xff, 0x6c, 0x97, 0x87, 0xf1, 0xb5, 0x4f, 0x10, 0x79, 0xcb, 0x8d, 0x9a, 0xb9, 0x18,
+  0x6f, 0xd7, 0x6b, 0x34, 0xd6, 0xe6, 0x03, 0x9c, 0x0a, 0xf6, 0xf5, 0x96, 0x8b, 0x89, 0x4d, 0x0e,
+  0x54, 0x88, 0x38, 0x84, 0xc4, 0xac, 0x5d, 0xe4, 0x77, 0xa8, 0x7c, 0x84, 0x41, 0x86, 0xd8, 0x4f,
+  0x56, 0x7b, 0x6e, 0xf1, 0x17, 0x30, 0x5c, 0x90, 0xf2, 0x9d, 0xbf, 0x74, 0x95, 0xdf, 0xe5, 0x10,
+  0x5c, 0xfc, 0x89, 0xb9, 0xf8, 0x1b, 0x9e, 0x86, 0xc0, 0x0d, 0x8b, 0x7c, 0x74, 0x2c, 0x8a, 0xca,
+  0x81, 0x68, 0x6c, 0xff, 0x6e, 0xd1, 0x28, 0x8d, 0x11, 0x7d, 0x52, 0xdb, 0x88, 0xfa, 0xd1, 0xf3,
+  0xf3, 0xc1, 0x76, 0xa5, 0xe6, 0xb3, 0x97, 0x8d, 0x0d, 0x9d, 0xbc, 0xcc, 0x2f, 0x5a, 0xfb, 0x95,
+  0x0a, 0x8a, 0x9a, 0x98, 0x6f, 0x09, 0x08, 0xa1, 0x24, 0x53, 0x61, 0xc4, 0xc5, 0xa2, 0xf8, 0xca,
+  0x20, 0x45, 0x09, 0x96, 0x10, 0xc2, 0x00, 0x27, 0x1f, 0x1d, 0x42, 0x6f, 0x54, 0xf4, 0x06, 0x19,
+  0x09, 0xfa, 0x71, 0x42, 0xe7, 0x8f, 0xac, 0xe3, 0x1c, 0xdc, 0x86, 0xa6, 0x39, 0xa4, 0xd0, 0x6a,
+  0x0b, 0x2a, 0x13, 0xf3, 0x4a, 0x11, 0x50, 0x98, 0x46, 0x74, 0x86, 0xc8, 0x50, 0x09, 0xe0, 0x3e,
+  0xa7, 0x4b, 0xc5, 0x93, 0xc7, 0xaf, 0x82, 0x16, 0xe4, 0x60, 0x77, 0x96, 0xf1, 0xc8, 0x07, 0x2c,
+  0xa3, 0xa4, 0xfd, 0xa4, 0xf9, 0xb3, 0xdf, 0x4a, 0x0b, 0x05, 0xe7, 0xb9, 0x6f, 0xa5, 0x75, 0xfc,
+  0xd4, 0x0b, 0xff, 0xe0, 0xe7, 0x60, 0xfc, 0x36, 0x8c, 0xff, 0x59, 0xf7, 0x5f, 0xaa, 0xc5, 0xf0,
+  0x7c, 0xbc, 0x1b, 0x00, 0x00
+};
 
 // Autogenerated from wled00/data/settings_time.htm, do not edit!!
-const char PAGE_settings_time[] PROGMEM = R"=====(<!DOCTYPE html><html lang="en"><head><meta name="viewport" content="width=500">
-<meta charset="utf-8"><title>Time Settings</title><script>
-var d=document;function H(){window.open("https://github.com/Aircoookie/WLED/wiki/Settings#time-settings")}function B(){window.open("/settings","_self")}function S(){BTa(),GetV(),Cs(),FC()}function gId(t){return d.getElementById(t)}function Cs(){gId("cac").style.display="none",gId("coc").style.display="block",gId("ccc").style.display="none",gId("ca").selected&&(gId("cac").style.display="block"),gId("cc").selected&&(gId("coc").style.display="none",gId("ccc").style.display="block"),gId("cn").selected&&(gId("coc").style.display="none")}function BTa(){var t="<tr><th>Active</th><th>Hour</th><th>Minute</th><th>Preset</th><th>M</th><th>T</th><th>W</th><th>T</th><th>F</th><th>S</th><th>S</th></tr>";for(i=0;i<8;i++)for(t+='<tr><td><input name="W'+i+'" id="W'+i+'" type="number" style="display:none"><input id="W'+i+'0" type="checkbox"></td><td><input name="H'+i+'" type="number" min="0" max="24"></td><td><input name="N'+i+'" type="number" min="0" max="59"></td><td><input name="T'+i+'" type="number" min="0" max="250"></td>',j=1;j<8;j++)t+='<td><input id="W'+i+j+'" type="checkbox"></td>';gId("TMT").innerHTML=t}function FC(){for(j=0;j<8;j++)for(i=0;i<8;i++)gId("W"+i+j).checked=gId("W"+i).value>>j&1}function Wd(){for(a=[0,0,0,0,0,0,0,0],i=0;i<8;i++){for(m=1,j=0;j<8;j++)a[i]+=gId("W"+i+j).checked*m,m*=2;gId("W"+i).value=a[i]}}function GetV() {
-%CSS%%SCSS%</head><body onload="S()"><form
- id="form_s" name="Sf" method="post" onsubmit="Wd()"><div class="helpB"><button 
-type="button" onclick="H()">?</button></div><button type="button" onclick="B()">
-Back</button><button type="submit">Save</button><hr><h2>Time setup</h2>
-Get time from NTP server: <input type="checkbox" name="NT"><br><input name="NS" 
-maxlength="32"><br>Use 24h format: <input type="checkbox" name="CF"><br>
-Time zone: <select name="TZ"><option value="0" selected="selected">GMT(UTC)
-</option><option value="1">GMT/BST</option><option value="2">CET/CEST</option>
-<option value="3">EET/EEST</option><option value="4">US-EST/EDT</option><option 
-value="5">US-CST/CDT</option><option value="6">US-MST/MDT</option><option 
-value="7">US-AZ</option><option value="8">US-PST/PDT</option><option value="9">
-CST(AWST)</option><option value="10">JST(KST)</option><option value="11">
-AEST/AEDT</option><option value="12">NZST/NZDT</option><option value="13">
-North Korea</option><option value="14">IST (India)</option><option value="15">
-CA-Saskatchewan</option><option value="16">ACST</option><option value="17">
-ACST/ACDT</option><option value="18">HST (Hawaii)</option></select><br>
-UTC offset: <input name="UO" type="number" min="-65500" max="65500" required>
- seconds (max. 18 hours)<br>Current local time is <span class="times">unknown
-</span>.<h3>Clock</h3>Clock Overlay: <select name="OL" onchange="Cs()"><option 
-value="0" id="cn" selected="selected">None</option><option value="1" id="ca">
-Analog Clock</option><option value="2">Single Digit Clock</option><option 
-value="3" id="cc">Cronixie Clock</option></select><br><div id="coc">First LED: 
-<input name="O1" type="number" min="0" max="255" required> Last LED: <input 
-name="O2" type="number" min="0" max="255" required><br><div id="cac">12h LED: 
-<input name="OM" type="number" min="0" max="255" required><br>Show 5min marks: 
-<input type="checkbox" name="O5"><br></div>Seconds (as trail): <input 
-type="checkbox" name="OS"><br></div><div id="ccc">Cronixie Display: <input 
-name="CX" maxlength="6"><br>Cronixie Backlight: <input type="checkbox" 
-name="CB"><br></div>Countdown Mode: <input type="checkbox" name="CE"><br>
-Countdown Goal:<br>Year: 20 <input name="CY" type="number" min="0" max="99" 
-required> Month: <input name="CI" type="number" min="1" max="12" required> Day: 
-<input name="CD" type="number" min="1" max="31" required><br>Hour: <input 
-name="CH" type="number" min="0" max="23" required> Minute: <input name="CM" 
-type="number" min="0" max="59" required> Second: <input name="CS" type="number" 
-min="0" max="59" required><br><h3>Macro presets</h3><b>Macros have moved!</b>
-<br><i>
-Presets now also can be used as macros to save both JSON and HTTP API commands.
-<br>Just enter the preset id below!</i> <i>
-Use 0 for the default action instead of a preset</i><br>Alexa On/Off Preset: 
-<input name="A0" type="number" min="0" max="250" required> <input name="A1" 
-type="number" min="0" max="250" required><br>Button short press Preset: <input 
-name="MP" type="number" min="0" max="250" required><br>Long Press: <input 
-name="ML" type="number" min="0" max="250" required> Double press: <input 
-name="MD" type="number" min="0" max="250" required><br>Countdown-Over Preset: 
-<input name="MC" type="number" min="0" max="250" required><br>
-Timed-Light-Over Presets: <input name="MN" type="number" min="0" max="250" 
-required><br><h3>Time-controlled presets</h3><div style="display:inline-block">
-<table id="TMT"></table></div><hr><button type="button" onclick="B()">Back
-</button><button type="submit">Save</button></form></body></html>)=====";
-
+const uint16_t PAGE_settings_time_length = 2061;
+const uint8_t PAGE_settings_time[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0xfd, 0x6f, 0xdb, 0x36,
+  0x13, 0xfe, 0x5d, 0x7f, 0x05, 0xab, 0x62, 0x8d, 0xbd, 0xc4, 0x9f, 0xa9, 0xb3, 0xd6, 0xb6, 0x34,
+  0x38, 0xb6, 0xdb, 0xa4, 0x8b, 0x93, 0x00, 0x76, 0x97, 0xb5, 0x45, 0x31, 0xd0, 0x12, 0x6d, 0x31,
+  0x91, 0x48, 0xbf, 0x22, 0x15, 0x27, 0x33, 0xf2, 0xbf, 0xbf, 0x47, 0x52, 0xfe, 0x52, 0xac, 0x78,
+  0x01, 0x86, 0x02, 0xa9, 0x2c, 0xde, 0x3d, 0x3c, 0x1e, 0xef, 0x9e, 0xbb, 0x53, 0xfb, 0x4d, 0xef,
+  0xaa, 0x3b, 0xfa, 0x76, 0xdd, 0x47, 0x81, 0x8c, 0x42, 0xb7, 0xad, 0xfe, 0xa2, 0x10, 0xb3, 0xa9,
+  0x63, 0x13, 0x66, 0xc3, 0x6f, 0x82, 0x7d, 0xb7, 0x1d, 0x11, 0x89, 0x11, 0xc3, 0x11, 0x71, 0xec,
+  0x7b, 0x4a, 0xe6, 0x33, 0x1e, 0x4b, 0x1b, 0x79, 0x9c, 0x49, 0xc2, 0xa4, 0x63, 0xcf, 0xa9, 0x2f,
+  0x03, 0xa7, 0x51, 0xad, 0xda, 0xae, 0x65, 0x44, 0xbd, 0x00, 0xc7, 0x82, 0xc0, 0x52, 0x22, 0x27,
+  0xa5, 0x0f, 0x00, 0x23, 0xa9, 0x0c, 0x89, 0x3b, 0xa2, 0x11, 0x41, 0x43, 0x22, 0x25, 0x65, 0x53,
+  0xd1, 0xae, 0x98, 0x97, 0x6d, 0xe1, 0xc5, 0x74, 0x26, 0x5d, 0xeb, 0x1e, 0xc7, 0xc8, 0x77, 0x7c,
+  0xee, 0x25, 0x11, 0xc0, 0xb6, 0x26, 0x09, 0xf3, 0x24, 0xe5, 0x0c, 0x9d, 0x15, 0x8a, 0x8b, 0x39,
+  0x65, 0x3e, 0x9f, 0x97, 0xf9, 0x8c, 0xb0, 0x82, 0x1d, 0x48, 0x39, 0x13, 0xcd, 0x4a, 0x65, 0x4a,
+  0x65, 0x90, 0x8c, 0xcb, 0x1e, 0x8f, 0x2a, 0x1d, 0x1a, 0x7b, 0x9c, 0xf3, 0x3b, 0x4a, 0x2a, 0x37,
+  0x17, 0xfd, 0x5e, 0x65, 0x4e, 0xef, 0x68, 0x65, 0xb9, 0xd3, 0x5b, 0x09, 0xfb, 0x96, 0x44, 0xfa,
+  0xcb, 0x2e, 0x3e, 0xad, 0xa0, 0x4f, 0xb3, 0xd0, 0x95, 0x95, 0xd4, 0x91, 0xfd, 0xb7, 0x20, 0xe1,
+  0x64, 0x53, 0x7a, 0x08, 0xd2, 0xa7, 0x23, 0x5c, 0x28, 0x1e, 0x7d, 0x26, 0xf2, 0x4f, 0xf8, 0xaf,
+  0x2b, 0xe0, 0xcf, 0xa7, 0x6e, 0x61, 0x43, 0x66, 0x7a, 0xee, 0x17, 0x64, 0x71, 0x11, 0x13, 0x99,
+  0xc4, 0x0c, 0xf9, 0xe5, 0x29, 0x91, 0xfd, 0x90, 0xa8, 0x03, 0x9d, 0x3e, 0xea, 0xa5, 0xb5, 0xa8,
+  0xd2, 0x5e, 0x28, 0x79, 0xdb, 0xc3, 0x9e, 0x5d, 0x2c, 0x0b, 0xf9, 0x18, 0x92, 0xb2, 0x4f, 0xc5,
+  0x2c, 0xc4, 0x8f, 0x8e, 0xcd, 0x38, 0x23, 0xf6, 0x91, 0x59, 0xe7, 0x3b, 0xd6, 0xc7, 0x21, 0xf7,
+  0xee, 0x96, 0x02, 0xde, 0x1e, 0x00, 0xac, 0x96, 0x49, 0x48, 0x3c, 0x49, 0xfc, 0x77, 0xef, 0x0a,
+  0xf9, 0xbb, 0x1a, 0xd4, 0xe2, 0x12, 0x76, 0x97, 0x1a, 0xdf, 0xb3, 0x97, 0xb7, 0x17, 0x96, 0xbd,
+  0x0a, 0x76, 0xf3, 0xbe, 0x94, 0xf7, 0x17, 0x2a, 0x50, 0x20, 0xb6, 0xda, 0x32, 0x86, 0xc0, 0x0a,
+  0xdc, 0x0e, 0xac, 0xdd, 0x13, 0x08, 0xa7, 0x40, 0xff, 0x3c, 0xe3, 0x49, 0xbc, 0xfa, 0x31, 0xa0,
+  0x2c, 0x91, 0xeb, 0xb5, 0xeb, 0x98, 0xc0, 0x05, 0xaf, 0x57, 0x57, 0x4f, 0xa3, 0xd5, 0xd3, 0xcd,
+  0x8e, 0x77, 0x9f, 0x56, 0x4f, 0xc3, 0xec, 0x53, 0x05, 0x8c, 0xb0, 0x5b, 0x13, 0x1e, 0x17, 0xa8,
+  0x53, 0x6d, 0xd1, 0xf6, 0x87, 0x16, 0x3d, 0x3c, 0x2c, 0xaa, 0xdf, 0xf2, 0xd0, 0x39, 0x30, 0x26,
+  0x42, 0x02, 0x51, 0x36, 0x4b, 0x64, 0x9a, 0x41, 0x37, 0x07, 0x87, 0xf4, 0xf0, 0xc0, 0x46, 0xd4,
+  0x5f, 0x3f, 0xcb, 0xc7, 0x19, 0xac, 0xb0, 0x24, 0x1a, 0x93, 0xd8, 0x46, 0xda, 0x0b, 0x8e, 0x9d,
+  0xba, 0xa1, 0xa9, 0xbd, 0xb0, 0xc4, 0x58, 0x6b, 0x55, 0x97, 0x6a, 0x5e, 0x40, 0xbc, 0xbb, 0x31,
+  0x7f, 0xb0, 0x95, 0x39, 0xfe, 0xf3, 0x0d, 0xcf, 0x76, 0x6e, 0x12, 0x51, 0xe6, 0xd8, 0x80, 0x11,
+  0xe1, 0x07, 0xc7, 0xae, 0xbf, 0xcf, 0x53, 0xbe, 0xdc, 0xaf, 0xdc, 0xf8, 0x98, 0xa7, 0x3c, 0xfa,
+  0x17, 0x3b, 0x37, 0xaa, 0xa9, 0xf6, 0xc1, 0xd1, 0xad, 0x53, 0x6b, 0xdd, 0x82, 0x0b, 0x6f, 0xc1,
+  0x85, 0xc6, 0x7d, 0xfe, 0xb3, 0x63, 0xdf, 0xae, 0xf1, 0x32, 0xe7, 0x3e, 0x68, 0xe9, 0x40, 0x1a,
+  0x0d, 0x46, 0x10, 0x48, 0x94, 0x31, 0x12, 0x9f, 0x8d, 0x06, 0x17, 0x8e, 0x5c, 0x87, 0x8f, 0x4a,
+  0xd5, 0x85, 0xba, 0x9b, 0x5b, 0xb8, 0xab, 0xe5, 0x46, 0xd9, 0xbb, 0xd3, 0x20, 0x37, 0xb6, 0xda,
+  0xaa, 0x58, 0xd6, 0x5b, 0x10, 0xdf, 0x59, 0xbd, 0x2c, 0x96, 0xef, 0x71, 0x98, 0x10, 0xd7, 0xbd,
+  0x7d, 0x57, 0x5b, 0x03, 0xdf, 0xf8, 0x29, 0x30, 0x76, 0x7e, 0x54, 0x8f, 0xb6, 0xfe, 0xfd, 0x3c,
+  0xda, 0x04, 0xd7, 0x42, 0x91, 0x53, 0x3b, 0xda, 0xb4, 0x00, 0xff, 0xa0, 0x3f, 0x0f, 0x9d, 0x5d,
+  0xfb, 0xfe, 0x1a, 0x1d, 0x45, 0xbf, 0x3a, 0xf5, 0x56, 0x76, 0x7b, 0x47, 0xa9, 0x3c, 0x3d, 0xb5,
+  0x2b, 0x29, 0x77, 0xa6, 0x1c, 0x8a, 0x44, 0xec, 0x39, 0x6b, 0x0e, 0xab, 0x88, 0xf2, 0xad, 0xf8,
+  0x7d, 0xe6, 0x34, 0x94, 0x83, 0x56, 0x92, 0x2a, 0xb6, 0xdc, 0x31, 0xf7, 0x1f, 0xc1, 0x16, 0x26,
+  0x4b, 0x13, 0x1c, 0xd1, 0xf0, 0xb1, 0xf9, 0x27, 0x89, 0x7d, 0xcc, 0xf0, 0x91, 0xc0, 0x4c, 0x00,
+  0x55, 0xc6, 0x74, 0xd2, 0x92, 0xe4, 0x41, 0x96, 0x70, 0x48, 0xa7, 0xac, 0xe9, 0x01, 0x7f, 0x91,
+  0xb8, 0x35, 0xc6, 0xde, 0xdd, 0x34, 0xe6, 0x09, 0xf3, 0x9b, 0x6f, 0xeb, 0xf5, 0x7a, 0xcb, 0xe3,
+  0x21, 0x8f, 0x9b, 0x6f, 0x27, 0x93, 0x49, 0x2b, 0xa4, 0x8c, 0x94, 0x02, 0x42, 0xa7, 0x81, 0x6c,
+  0xd6, 0xab, 0xd5, 0x5f, 0x5a, 0x11, 0x8e, 0xa7, 0x94, 0x35, 0xab, 0x4f, 0x41, 0xbc, 0x18, 0xf3,
+  0xd8, 0x27, 0x71, 0x29, 0x15, 0x3f, 0x39, 0x39, 0x79, 0x1a, 0x27, 0x52, 0x72, 0xb6, 0xd8, 0x04,
+  0x3c, 0x3e, 0x3e, 0xde, 0x04, 0xdc, 0x63, 0x9c, 0x81, 0x6c, 0x96, 0x8f, 0xbd, 0x00, 0x09, 0x1e,
+  0x52, 0x1f, 0x69, 0x80, 0x65, 0xca, 0x50, 0xa6, 0x0d, 0xd2, 0xb4, 0x63, 0xa0, 0x04, 0xfd, 0x87,
+  0x80, 0x65, 0xb3, 0x87, 0xa5, 0x65, 0x1f, 0x56, 0x8f, 0x25, 0xc9, 0x67, 0xcd, 0x5a, 0x7d, 0xf6,
+  0xf0, 0x54, 0x0e, 0x48, 0x38, 0x3b, 0x5d, 0x6c, 0x9c, 0x3c, 0x24, 0x13, 0xd9, 0x9a, 0x71, 0x41,
+  0xd5, 0x3d, 0x37, 0xf1, 0x18, 0xf6, 0x02, 0x42, 0x69, 0xe9, 0x92, 0xd7, 0x3c, 0x01, 0xb8, 0x27,
+  0x1d, 0x9f, 0xff, 0xc1, 0x49, 0x1a, 0x5b, 0x27, 0x31, 0xb0, 0x3f, 0x74, 0xa0, 0x9b, 0xbc, 0xf9,
+  0xb9, 0x30, 0x9b, 0xbe, 0x27, 0xd1, 0x93, 0x21, 0xcf, 0xff, 0x7e, 0x53, 0xe9, 0x2f, 0x66, 0xd8,
+  0xf7, 0x21, 0x78, 0x9a, 0xda, 0x1d, 0x7e, 0x63, 0xb9, 0x69, 0xb9, 0x41, 0xa2, 0x37, 0x34, 0x52,
+  0x95, 0x1f, 0x33, 0xa9, 0x22, 0x4f, 0xc7, 0x51, 0xbb, 0x62, 0x1a, 0x04, 0x15, 0x4f, 0x88, 0xb3,
+  0x90, 0x63, 0xc8, 0x53, 0xa8, 0x93, 0x10, 0x71, 0x10, 0xe9, 0x91, 0xa5, 0xf3, 0x56, 0x3d, 0xfd,
+  0x2d, 0xec, 0x94, 0x13, 0x86, 0x13, 0xc8, 0x7c, 0x22, 0x03, 0x0e, 0x2b, 0xe0, 0x58, 0x68, 0x24,
+  0x38, 0x13, 0xc9, 0x38, 0xa2, 0x40, 0xe9, 0x2a, 0x8f, 0x40, 0xd5, 0xa7, 0xf7, 0xc8, 0x0b, 0xb1,
+  0x10, 0x8e, 0xad, 0x2f, 0x04, 0x5e, 0x99, 0x80, 0x41, 0x96, 0xc9, 0x7c, 0xf3, 0x4b, 0x69, 0x7a,
+  0x21, 0xf5, 0xee, 0x80, 0xe2, 0x94, 0xde, 0xef, 0xed, 0x8a, 0x59, 0x00, 0xb3, 0x00, 0x62, 0xa5,
+  0x94, 0xa3, 0x73, 0xaa, 0x74, 0xac, 0x53, 0xf0, 0xe1, 0x5a, 0x6f, 0x4b, 0xc3, 0x58, 0x65, 0xbb,
+  0x43, 0xac, 0xca, 0xcb, 0x52, 0x24, 0x00, 0x4a, 0x0f, 0xea, 0xa6, 0x97, 0x81, 0x4c, 0x4b, 0x66,
+  0xe0, 0x83, 0xba, 0x6b, 0x41, 0x4b, 0x80, 0x54, 0x9f, 0x81, 0x26, 0x31, 0x8f, 0xd0, 0xe5, 0xe8,
+  0x1a, 0x16, 0xe3, 0x7b, 0xf0, 0x31, 0x4a, 0x19, 0x2c, 0xc3, 0x59, 0x4b, 0x7a, 0x1d, 0xa9, 0xc3,
+  0xc5, 0x19, 0xce, 0x1d, 0xda, 0xc8, 0x02, 0x76, 0x0c, 0x09, 0x9b, 0x42, 0x67, 0x65, 0x1f, 0xd7,
+  0x8d, 0xd0, 0x57, 0x41, 0x50, 0xfd, 0x7d, 0x80, 0x94, 0x43, 0xb1, 0xdc, 0x83, 0xdc, 0xfd, 0x64,
+  0x94, 0x2c, 0x6d, 0xe9, 0x3f, 0x50, 0x43, 0x40, 0xc1, 0x04, 0xce, 0x92, 0x9d, 0xbf, 0x83, 0x04,
+  0x9f, 0x69, 0x06, 0x33, 0xb4, 0xa2, 0x58, 0x79, 0x59, 0x98, 0xe1, 0xfc, 0xe9, 0x93, 0xed, 0x7e,
+  0x1e, 0x8c, 0x0a, 0x5f, 0x47, 0xdd, 0xa2, 0xd5, 0xae, 0x18, 0xf9, 0xac, 0x5e, 0x4d, 0xcb, 0x54,
+  0x4e, 0x87, 0xa3, 0x3c, 0x09, 0x38, 0x42, 0xb7, 0x3f, 0xaa, 0x74, 0xfb, 0x1b, 0x22, 0x56, 0x46,
+  0xe6, 0xd8, 0x76, 0xfb, 0x20, 0xd3, 0xef, 0xe7, 0xc3, 0x40, 0x9d, 0xfa, 0x3a, 0x2c, 0x81, 0x40,
+  0xa5, 0xdf, 0x7b, 0x2e, 0x64, 0xa5, 0x52, 0x0d, 0x2d, 0xd5, 0x05, 0xa9, 0x6e, 0x2f, 0x17, 0xea,
+  0x44, 0x0b, 0x0d, 0x40, 0x68, 0xf0, 0x02, 0xd4, 0x6f, 0x5a, 0xaa, 0xf3, 0x3d, 0x0f, 0xe5, 0x83,
+  0x5e, 0xbf, 0x06, 0x94, 0xeb, 0xfc, 0xad, 0xa0, 0x40, 0x5a, 0x60, 0x4d, 0xa1, 0x73, 0x33, 0x1c,
+  0x15, 0x73, 0x7d, 0x08, 0x85, 0xf0, 0x0b, 0x08, 0xfd, 0xf1, 0x92, 0x0c, 0x38, 0xda, 0xea, 0xa8,
+  0xe3, 0x77, 0xfa, 0xf9, 0xdb, 0xd5, 0xc0, 0xd9, 0x97, 0xdf, 0x41, 0xe8, 0xf2, 0xfb, 0x0b, 0x42,
+  0xe0, 0x6d, 0xeb, 0x12, 0xf2, 0x39, 0x40, 0x7f, 0xf0, 0x98, 0xe0, 0x5c, 0x39, 0x70, 0xf9, 0xf9,
+  0x70, 0x84, 0x0a, 0xe7, 0xcc, 0xa7, 0x38, 0xdf, 0xb2, 0x86, 0x3a, 0x63, 0xa7, 0x34, 0xc4, 0xe2,
+  0x0e, 0x4b, 0x08, 0xc6, 0x39, 0x66, 0xb9, 0xb2, 0xe0, 0xfa, 0x4e, 0x37, 0xff, 0x92, 0x6b, 0xbf,
+  0xa9, 0x53, 0xaa, 0xeb, 0xeb, 0xbc, 0x70, 0x7f, 0x35, 0x70, 0xfd, 0x99, 0x32, 0xec, 0x0c, 0xcf,
+  0x31, 0xa5, 0x1b, 0x96, 0x55, 0x4c, 0xe4, 0x9a, 0xf0, 0x87, 0xb8, 0x45, 0x7c, 0x32, 0x81, 0x54,
+  0x5d, 0x25, 0x8c, 0x09, 0xff, 0xaf, 0x57, 0x3b, 0x1b, 0x93, 0xd2, 0x49, 0x43, 0x8d, 0x32, 0xa6,
+  0x3b, 0x49, 0x9f, 0x63, 0xf2, 0xbf, 0x84, 0xc6, 0xc4, 0x77, 0x2d, 0x48, 0x0f, 0x98, 0x7b, 0x7c,
+  0x81, 0x0a, 0xb0, 0x5e, 0x46, 0xb5, 0x0f, 0x28, 0x80, 0x7e, 0x53, 0x14, 0xd5, 0x56, 0xdd, 0x24,
+  0x8e, 0xa1, 0x50, 0x22, 0x28, 0x3a, 0x38, 0x34, 0x64, 0x40, 0x05, 0xe4, 0xdc, 0x0c, 0xb3, 0x25,
+  0x9d, 0xa9, 0x97, 0xc2, 0x76, 0x13, 0x76, 0xc7, 0xf8, 0x9c, 0x41, 0x3a, 0xa9, 0x45, 0xb7, 0xdc,
+  0x0e, 0x8e, 0xdd, 0xae, 0xaa, 0x55, 0xc0, 0x25, 0xe9, 0x13, 0xba, 0x02, 0xf2, 0x50, 0xa5, 0x2c,
+  0x93, 0xb4, 0x57, 0x17, 0x9a, 0xc2, 0x02, 0x18, 0xd1, 0x54, 0x92, 0x0b, 0x4d, 0x98, 0x99, 0x98,
+  0xad, 0x9a, 0xe6, 0x12, 0xfa, 0xec, 0x9d, 0xd9, 0x7c, 0x09, 0x5c, 0x90, 0x9f, 0xc8, 0x46, 0x15,
+  0xab, 0x1b, 0x60, 0x38, 0xe4, 0x53, 0x94, 0x1a, 0x96, 0x9b, 0xd6, 0x43, 0x28, 0x17, 0x21, 0x41,
+  0x3d, 0x0a, 0xf3, 0x58, 0x8e, 0xb0, 0xb5, 0x4a, 0x70, 0x83, 0xee, 0x01, 0x19, 0xc4, 0x9c, 0xd1,
+  0x07, 0x4a, 0xb2, 0x1a, 0x9b, 0x77, 0xa7, 0x0b, 0x81, 0x56, 0x80, 0xe1, 0xc0, 0xfd, 0x44, 0x63,
+  0x21, 0x11, 0x4c, 0x77, 0x4d, 0x64, 0x6d, 0x5d, 0xe4, 0x55, 0x6d, 0x4f, 0x87, 0xd9, 0xd8, 0xb8,
+  0x41, 0x74, 0x81, 0x97, 0x28, 0x29, 0x88, 0x95, 0xa2, 0xd4, 0x5f, 0x81, 0xb2, 0x6d, 0x1d, 0x0c,
+  0x52, 0x6e, 0xad, 0x1e, 0xec, 0xb4, 0x6d, 0xf0, 0x4a, 0xd4, 0x61, 0xc0, 0xe7, 0xa8, 0x01, 0x42,
+  0x20, 0x10, 0xdf, 0x89, 0x35, 0xde, 0x6e, 0x96, 0xbf, 0x6a, 0xa4, 0xf5, 0x43, 0x57, 0xbc, 0xe1,
+  0x32, 0x38, 0xb1, 0x40, 0x32, 0xc6, 0x34, 0x2c, 0xae, 0x4f, 0x99, 0xa3, 0x3f, 0xdc, 0xd4, 0x5f,
+  0x1f, 0x69, 0xeb, 0x8a, 0x7a, 0x69, 0x57, 0x95, 0xf1, 0x58, 0xf7, 0x2f, 0x7d, 0x8a, 0x65, 0x95,
+  0x3a, 0x31, 0x48, 0x2b, 0x2d, 0x55, 0x59, 0x43, 0xdd, 0x10, 0xe6, 0x15, 0xaa, 0x25, 0xce, 0xe9,
+  0xa6, 0x0d, 0x5d, 0xe8, 0x67, 0x24, 0x4c, 0xe4, 0x0c, 0x0d, 0xb8, 0x4f, 0xf6, 0x15, 0xb9, 0x7e,
+  0x5a, 0xe4, 0xd6, 0x5a, 0x9f, 0x39, 0x0e, 0x9b, 0xea, 0xdd, 0x37, 0x82, 0xa1, 0xfa, 0xd6, 0xab,
+  0xdb, 0x59, 0xdf, 0xfd, 0xf6, 0xe2, 0x85, 0x7c, 0xfc, 0x08, 0x66, 0xad, 0x83, 0x65, 0x00, 0x6d,
+  0x54, 0x90, 0xe1, 0x8d, 0xee, 0xf9, 0x4e, 0x84, 0x5a, 0x8a, 0x00, 0xe4, 0xbb, 0x11, 0x6d, 0x3d,
+  0xe5, 0xb6, 0xed, 0x90, 0xe8, 0xf6, 0x5e, 0xd4, 0x3f, 0xae, 0x65, 0x22, 0x42, 0x0d, 0xb4, 0xcf,
+  0x5c, 0x7f, 0xf6, 0x72, 0x58, 0x1d, 0x6f, 0xda, 0x60, 0x86, 0xe0, 0xec, 0x29, 0x20, 0x30, 0xad,
+  0x97, 0x87, 0xba, 0x0d, 0x08, 0x13, 0x58, 0x59, 0x88, 0x61, 0xd6, 0x08, 0x2b, 0x1f, 0x42, 0x5f,
+  0x30, 0x90, 0xdb, 0x00, 0x7b, 0x31, 0x47, 0x33, 0x3d, 0x88, 0x0b, 0x4d, 0x77, 0xed, 0xb1, 0x79,
+  0x29, 0x50, 0x00, 0x8d, 0x16, 0x8a, 0xf8, 0x3d, 0xf1, 0xdf, 0x40, 0xbf, 0x05, 0xed, 0x81, 0x6e,
+  0x8c, 0x5c, 0xcb, 0x8c, 0xed, 0x02, 0x01, 0x67, 0x22, 0x1c, 0x0a, 0x8e, 0x3c, 0x60, 0xd4, 0x31,
+  0x41, 0x89, 0x20, 0x3e, 0x82, 0x50, 0x8f, 0x8c, 0xba, 0xe4, 0x48, 0x28, 0x84, 0x31, 0x87, 0x9a,
+  0xf6, 0x65, 0x78, 0x75, 0x89, 0x30, 0xf3, 0xd1, 0xd9, 0x08, 0x7a, 0xb1, 0xce, 0xf5, 0x39, 0xf2,
+  0x78, 0x14, 0xc1, 0x0b, 0x51, 0xd6, 0xb8, 0x5f, 0x12, 0xa0, 0x01, 0x3d, 0xd6, 0x20, 0x19, 0x90,
+  0xd4, 0x20, 0x88, 0x7d, 0xc0, 0x0d, 0xf9, 0x1c, 0xf6, 0xa7, 0x2e, 0x52, 0x7b, 0xab, 0x9e, 0xab,
+  0xaa, 0x3a, 0x2e, 0x2d, 0xe6, 0x93, 0x09, 0x4e, 0x42, 0x89, 0xb0, 0x99, 0xfb, 0x28, 0x13, 0x12,
+  0xfa, 0x5f, 0xa8, 0x2f, 0x08, 0xa7, 0x10, 0x4a, 0x51, 0xe1, 0x77, 0x42, 0xf2, 0x80, 0xd1, 0x15,
+  0xab, 0x5c, 0x4d, 0x26, 0xc8, 0x1c, 0x20, 0x1b, 0x08, 0x9d, 0xea, 0xde, 0xc9, 0x78, 0xe3, 0x0a,
+  0xb6, 0x55, 0x6b, 0x2f, 0xdf, 0xde, 0xb6, 0xae, 0xb2, 0xe7, 0xd4, 0x74, 0xb6, 0x22, 0x80, 0x8a,
+  0xaf, 0x4d, 0x15, 0x2b, 0xab, 0xb6, 0x43, 0x6b, 0x70, 0xfd, 0x0a, 0xab, 0x14, 0xf2, 0x05, 0x67,
+  0x53, 0x8d, 0x25, 0x9e, 0x41, 0x5d, 0xbc, 0xe6, 0x80, 0x3d, 0x9e, 0x8c, 0x43, 0x73, 0x13, 0xcf,
+  0x91, 0x7a, 0xaf, 0x34, 0x6a, 0xc5, 0x07, 0x25, 0x55, 0x47, 0x73, 0x2e, 0x60, 0xd0, 0x7d, 0x25,
+  0xaa, 0xee, 0xa5, 0xfd, 0xd2, 0x85, 0x62, 0xb5, 0x4d, 0x60, 0x91, 0xc9, 0x8c, 0xc1, 0xe5, 0x7e,
+  0x60, 0xeb, 0x59, 0x6a, 0x28, 0xf0, 0x92, 0xfa, 0xaa, 0x1a, 0xf3, 0x30, 0x84, 0xc8, 0xde, 0x4a,
+  0x12, 0xc5, 0xcc, 0x99, 0xef, 0x42, 0x9b, 0x43, 0xae, 0xfa, 0xf4, 0x2a, 0xb1, 0xf2, 0x9f, 0xa2,
+  0x6f, 0xf5, 0x0d, 0x44, 0x7d, 0x14, 0x51, 0x2f, 0x96, 0xd4, 0xae, 0xe6, 0x96, 0x7f, 0x31, 0x10,
+  0x29, 0xd6, 0xb6, 0x5e, 0x35, 0x10, 0x55, 0xd4, 0x38, 0x02, 0xff, 0xa9, 0x19, 0x50, 0x0d, 0x84,
+  0xea, 0x3b, 0xf2, 0xff, 0x01, 0x22, 0x60, 0x75, 0x05, 0x57, 0x16, 0x00, 0x00
+};
 
 // Autogenerated from wled00/data/settings_sec.htm, do not edit!!
-const char PAGE_settings_sec[] PROGMEM = R"=====(<!DOCTYPE html><html lang="en"><head><meta name="viewport" content="width=500">
-<meta charset="utf-8"><title>Misc Settings</title><script>
-function H(){window.open("https://github.com/Aircoookie/WLED/wiki/Settings#security-settings")}function B(){window.open("/settings","_self")}function U(){window.open("/update","_self")}function GetV() {var d=document;
-%CSS%%SCSS%</head><body onload="GetV()">
-<form id="form_s" name="Sf" method="post"><div class="helpB"><button 
-type="button" onclick="H()">?</button></div><button type="button" onclick="B()">
-Back</button><button type="submit">Save & Reboot</button><hr><h2>
-Security & Update setup</h2>Lock wireless (OTA) software update: <input 
-type="checkbox" name="NO"><br>Passphrase: <input type="password" name="OP" 
-maxlength="32"><br>
-To enable OTA, for security reasons you need to also enter the correct password!
-<br>The password should be changed when OTA is enabled.<br><b>
-Disable OTA when not in use, otherwise an attacker can reflash device software!
-</b><br><i>Settings on this page are only changable if OTA lock is disabled!</i>
-<br>Deny access to WiFi settings if locked: <input type="checkbox" name="OW">
-<br><br>Factory reset: <input type="checkbox" name="RS"><br>
-All EEPROM content (settings) will be erased.<br><br>
-HTTP traffic is unencrypted. An attacker in the same network can intercept form data!
-<h3>Software Update</h3><button type="button" onclick="U()">Manual OTA Update
-</button><br>Enable ArduinoOTA: <input type="checkbox" name="AO"><br><h3>About
-</h3><a href="https://github.com/Aircoookie/WLED/" target="_blank">WLED</a>
- version 0.11.1<br><br><a 
-href="https://github.com/Aircoookie/WLED/wiki/Contributors-and-credits" 
-target="_blank">Contributors, dependencies and special thanks</a><br>
-A huge thank you to everyone who helped me create WLED!<br><br>
-(c) 2016-2021 Christian Schwinne<br><i>Licensed under the <a 
-href="https://github.com/Aircoookie/WLED/blob/master/LICENSE" target="_blank">
-MIT license</a></i><br><br>Server message: <span class="sip">Response error!
-</span><hr><button type="button" onclick="B()">Back</button><button 
-type="submit">Save & Reboot</button></form></body></html>)=====";
-
+const uint16_t PAGE_settings_sec_length = 1327;
+const uint8_t PAGE_settings_sec[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x56, 0x6d, 0x4f, 0xe3, 0x46,
+  0x10, 0xfe, 0xee, 0x5f, 0x31, 0xf8, 0xd4, 0x0a, 0x24, 0x12, 0x87, 0xa4, 0xa0, 0x53, 0x48, 0x5c,
+  0x05, 0xc8, 0xf5, 0x4e, 0x82, 0x03, 0x91, 0xdc, 0x9d, 0xaa, 0xaa, 0x3a, 0xad, 0x77, 0xc7, 0xf1,
+  0x36, 0xf6, 0xae, 0xb5, 0xbb, 0x26, 0xa4, 0x11, 0xff, 0xbd, 0xb3, 0x76, 0x0c, 0x39, 0xae, 0x15,
+  0x54, 0x6a, 0x3f, 0x04, 0x92, 0xf5, 0xbc, 0x3e, 0xf3, 0x3c, 0xb3, 0x1e, 0xed, 0x5d, 0x5c, 0x9f,
+  0xcf, 0x7f, 0xbd, 0x99, 0x42, 0xe6, 0x8a, 0x3c, 0x1e, 0xf9, 0xbf, 0x90, 0x33, 0xb5, 0x18, 0x87,
+  0xa8, 0x42, 0xfa, 0x8d, 0x4c, 0xc4, 0xa3, 0x02, 0x1d, 0x03, 0xc5, 0x0a, 0x1c, 0x87, 0x77, 0x12,
+  0x57, 0xa5, 0x36, 0x2e, 0x04, 0xae, 0x95, 0x43, 0xe5, 0xc6, 0xe1, 0x4a, 0x0a, 0x97, 0x8d, 0x8f,
+  0x7b, 0xbd, 0x30, 0x0e, 0x1a, 0x53, 0x9e, 0x31, 0x63, 0x91, 0x1e, 0x55, 0x2e, 0xed, 0xbc, 0xa5,
+  0x30, 0x4e, 0xba, 0x1c, 0xe3, 0x2b, 0x69, 0x39, 0xcc, 0xd0, 0x39, 0xa9, 0x16, 0x76, 0x14, 0x35,
+  0x87, 0x23, 0xcb, 0x8d, 0x2c, 0x5d, 0x1c, 0xa4, 0x95, 0xe2, 0x4e, 0x6a, 0x05, 0xef, 0xf7, 0x0f,
+  0x36, 0x2b, 0xa9, 0x84, 0x5e, 0x75, 0x75, 0x89, 0x6a, 0x3f, 0xcc, 0x9c, 0x2b, 0xed, 0x30, 0x8a,
+  0x16, 0xd2, 0x65, 0x55, 0xd2, 0xe5, 0xba, 0x88, 0x26, 0xd2, 0x70, 0xad, 0xf5, 0x52, 0x62, 0xf4,
+  0xe5, 0x72, 0x7a, 0x11, 0xad, 0xe4, 0x52, 0x46, 0x6d, 0xe8, 0x37, 0x16, 0x79, 0x65, 0xa4, 0x5b,
+  0x77, 0xec, 0xf6, 0x24, 0x3c, 0x78, 0x78, 0x0c, 0x7f, 0xf6, 0x3c, 0x7c, 0xf4, 0x68, 0x75, 0x18,
+  0x7e, 0xb5, 0x98, 0xa7, 0xbb, 0xd6, 0x9f, 0xbe, 0xb3, 0xae, 0x4a, 0xc1, 0x1c, 0xee, 0xd8, 0x8e,
+  0xa2, 0x6d, 0x0b, 0xdb, 0x56, 0xc0, 0x1a, 0x3e, 0x7e, 0x8a, 0x1a, 0xd9, 0xee, 0x1f, 0xf6, 0xe7,
+  0x72, 0x7c, 0x42, 0x38, 0x3c, 0x59, 0xba, 0x35, 0xf5, 0x9e, 0x68, 0xb1, 0xde, 0xa4, 0x84, 0x63,
+  0x27, 0x65, 0x85, 0xcc, 0xd7, 0xc3, 0xcf, 0x68, 0x04, 0x53, 0xec, 0xd0, 0x32, 0x65, 0xa9, 0x78,
+  0x23, 0xd3, 0x53, 0x87, 0xf7, 0xae, 0xc3, 0x72, 0xb9, 0x50, 0x43, 0x4e, 0x70, 0xa3, 0x39, 0x4d,
+  0x18, 0x5f, 0x2e, 0x8c, 0xae, 0x94, 0x18, 0xbe, 0xe9, 0xf7, 0xfb, 0xa7, 0x5c, 0xe7, 0xda, 0x0c,
+  0xdf, 0xa4, 0x69, 0x7a, 0x9a, 0x4b, 0x85, 0x9d, 0x0c, 0xe5, 0x22, 0x73, 0xc3, 0x7e, 0xaf, 0xf7,
+  0xc3, 0x69, 0xc1, 0xcc, 0x42, 0xaa, 0x61, 0xef, 0x21, 0x33, 0x9b, 0x44, 0x1b, 0x81, 0xa6, 0xb3,
+  0x35, 0x3f, 0x39, 0x39, 0x79, 0x48, 0x2a, 0xe7, 0xb4, 0xda, 0xec, 0x06, 0x1c, 0x0c, 0x06, 0xbb,
+  0x01, 0x5f, 0x28, 0xae, 0x09, 0x39, 0xec, 0x0e, 0x78, 0x06, 0x56, 0xe7, 0x52, 0x40, 0x1d, 0x40,
+  0x48, 0x5b, 0xe6, 0x6c, 0x3d, 0x94, 0xaa, 0x2e, 0x28, 0xc9, 0x35, 0x5f, 0x36, 0xa1, 0xac, 0xfc,
+  0x13, 0xa9, 0xb2, 0xf2, 0xbe, 0xad, 0xec, 0xed, 0xe3, 0xd7, 0x8e, 0xd3, 0xe5, 0xf0, 0xa8, 0x5f,
+  0xde, 0x3f, 0x74, 0x33, 0xcc, 0xcb, 0xb3, 0xcd, 0x4e, 0xe7, 0x39, 0xa6, 0xee, 0xb4, 0xd4, 0x56,
+  0xfa, 0x99, 0x0c, 0x59, 0x42, 0xb9, 0x2a, 0x87, 0xa7, 0x35, 0xf3, 0x86, 0x27, 0x14, 0xee, 0x41,
+  0xaa, 0xb2, 0x72, 0xff, 0x41, 0x27, 0xc7, 0xdf, 0x74, 0xd2, 0x84, 0xfd, 0xcd, 0xad, 0x4b, 0x1c,
+  0xab, 0xaa, 0x48, 0xd0, 0xfc, 0xbe, 0x69, 0x92, 0xfe, 0x84, 0xc5, 0x03, 0xcd, 0x1f, 0xf9, 0xff,
+  0x90, 0xd4, 0x89, 0x4d, 0xc9, 0x84, 0x20, 0xf2, 0x0c, 0x6b, 0x38, 0xc4, 0x71, 0x9b, 0xb4, 0x7b,
+  0x8c, 0xc5, 0x9e, 0x2c, 0xbc, 0x00, 0x99, 0x72, 0x9e, 0x79, 0x35, 0x8f, 0x46, 0x51, 0xa3, 0x53,
+  0xcf, 0x27, 0xd0, 0x2a, 0xd7, 0x4c, 0x8c, 0xc3, 0x5f, 0xd0, 0x7d, 0xde, 0x3f, 0xf0, 0x9a, 0x4c,
+  0xb5, 0x29, 0x40, 0xd2, 0x91, 0xff, 0xf2, 0xd5, 0x86, 0x5b, 0x29, 0xcf, 0xd2, 0x10, 0x48, 0xae,
+  0x99, 0xa6, 0x27, 0x84, 0xad, 0x23, 0x7e, 0x0a, 0x79, 0x07, 0x3c, 0x67, 0xd6, 0x8e, 0xc3, 0x7a,
+  0x06, 0x74, 0xd4, 0x70, 0x04, 0x82, 0x1a, 0x83, 0xb0, 0xf9, 0x15, 0x52, 0x12, 0x9e, 0x4b, 0xbe,
+  0x1c, 0x87, 0xef, 0x7d, 0x8a, 0x9f, 0x47, 0x51, 0xf3, 0x80, 0x2a, 0xa1, 0x10, 0x8f, 0x4e, 0xff,
+  0xe0, 0x73, 0x56, 0x97, 0x75, 0x46, 0xb0, 0x3d, 0xf9, 0x7d, 0xe3, 0x61, 0xab, 0xa4, 0x90, 0x54,
+  0xcf, 0x8c, 0xdd, 0x21, 0xfc, 0x08, 0xb7, 0x98, 0x68, 0xed, 0x9e, 0x6c, 0x33, 0x43, 0x9f, 0x7e,
+  0x1c, 0xcc, 0xb6, 0x32, 0x27, 0x93, 0x4f, 0xb5, 0x28, 0x81, 0x34, 0x57, 0x95, 0x84, 0x46, 0x3f,
+  0xbe, 0x24, 0xca, 0xc1, 0x4a, 0x1a, 0x1a, 0x91, 0xb5, 0xb0, 0x7f, 0x3d, 0x9f, 0x1c, 0x10, 0xc4,
+  0xa9, 0x5b, 0x31, 0x83, 0xd0, 0x48, 0x78, 0x08, 0xa3, 0x7a, 0xbc, 0x6d, 0x6f, 0x3c, 0x43, 0xbe,
+  0x4c, 0xf4, 0x7d, 0x8b, 0xcf, 0xc7, 0x6b, 0xdf, 0xbe, 0x89, 0x6f, 0x08, 0x8f, 0x32, 0x33, 0xcc,
+  0x3e, 0x79, 0x34, 0x0e, 0x25, 0x3d, 0x58, 0xd1, 0x08, 0x5b, 0x87, 0xeb, 0x9b, 0x10, 0x82, 0x82,
+  0xdd, 0xe7, 0xa8, 0x16, 0xb4, 0x11, 0xc3, 0x41, 0xbf, 0x09, 0x10, 0xcc, 0x35, 0xa0, 0x62, 0x49,
+  0x8e, 0x40, 0x75, 0x1c, 0x02, 0x8d, 0x01, 0xda, 0x15, 0x05, 0x06, 0x99, 0xd5, 0xca, 0xc2, 0x5a,
+  0x57, 0xa0, 0x10, 0x05, 0x38, 0x0d, 0x2c, 0xb7, 0xde, 0x83, 0xc4, 0x0e, 0x2e, 0x43, 0xda, 0xb4,
+  0xc6, 0x10, 0xd1, 0xa0, 0xcd, 0xb7, 0x17, 0xf8, 0xa8, 0x73, 0x7a, 0xd2, 0x9e, 0x80, 0xcd, 0x74,
+  0x95, 0x0b, 0x48, 0xd0, 0xef, 0x5e, 0xb5, 0xa0, 0x30, 0xab, 0x0c, 0x95, 0x4f, 0x07, 0xd2, 0x6e,
+  0x93, 0x8b, 0xae, 0x77, 0x1b, 0x25, 0x71, 0x70, 0x21, 0x6d, 0x5b, 0x4d, 0x63, 0xa7, 0xb4, 0x03,
+  0xa9, 0xa0, 0xb2, 0x78, 0x08, 0x9a, 0x52, 0x9a, 0x95, 0xb4, 0x08, 0x4c, 0x01, 0x73, 0x8e, 0xc6,
+  0x44, 0x75, 0x70, 0xfa, 0x61, 0x30, 0x25, 0x6e, 0x64, 0x20, 0xf0, 0x4e, 0x72, 0x7c, 0x84, 0x93,
+  0xca, 0x89, 0x92, 0xba, 0xd1, 0x91, 0x8c, 0xdb, 0x1d, 0x0c, 0x7e, 0x98, 0x19, 0xe5, 0x2e, 0xd9,
+  0x82, 0x22, 0x11, 0xe8, 0xc4, 0xcb, 0x75, 0x53, 0x5d, 0x9d, 0x5b, 0xa6, 0x75, 0x7a, 0xbf, 0x1a,
+  0x7c, 0x89, 0xa2, 0x29, 0x49, 0xec, 0x8d, 0x22, 0x19, 0xd7, 0xfd, 0x5d, 0xa0, 0x5a, 0x03, 0xe3,
+  0xdc, 0xcf, 0x8f, 0x30, 0xf9, 0x22, 0xdf, 0x49, 0x68, 0x77, 0xaa, 0xf7, 0xf6, 0x9e, 0x28, 0x9e,
+  0x8d, 0xe4, 0xf9, 0x0c, 0xaf, 0xbf, 0x84, 0x4d, 0x34, 0xff, 0x79, 0xc7, 0xb8, 0xd3, 0xc6, 0x43,
+  0x4e, 0x71, 0x5e, 0x70, 0xbc, 0x9d, 0x6d, 0x67, 0x37, 0xc9, 0x73, 0x98, 0x4e, 0x6f, 0x6e, 0xaf,
+  0xaf, 0xda, 0x1b, 0x0f, 0xf6, 0xdb, 0x32, 0x0e, 0x88, 0x61, 0xf4, 0x98, 0x50, 0x47, 0x4f, 0x8f,
+  0x16, 0x60, 0xf2, 0x7a, 0x3f, 0x9f, 0xdf, 0x80, 0x33, 0x2c, 0x4d, 0x25, 0xf7, 0xed, 0x55, 0x0a,
+  0x15, 0x37, 0xeb, 0xd2, 0x91, 0x11, 0x4c, 0x76, 0x70, 0x95, 0xaa, 0x1e, 0xb1, 0xa5, 0xa4, 0x34,
+  0x7e, 0x47, 0xc3, 0x5c, 0xd6, 0x58, 0x4b, 0x3f, 0x7d, 0x8e, 0x74, 0x9b, 0xd4, 0xea, 0x25, 0xbe,
+  0x32, 0xc2, 0x39, 0x1b, 0xc4, 0xb3, 0x96, 0xc4, 0x0d, 0xe5, 0x89, 0xec, 0x83, 0x97, 0xf4, 0xf6,
+  0xc9, 0xeb, 0xed, 0x8a, 0xa9, 0x8a, 0xe5, 0x35, 0xe6, 0x8d, 0x67, 0xb0, 0x23, 0x3e, 0x13, 0x4f,
+  0x1b, 0x7e, 0x4e, 0x8c, 0xa8, 0xa4, 0xd2, 0x64, 0xf5, 0x02, 0x3e, 0x93, 0xad, 0x38, 0x7c, 0x49,
+  0x93, 0x44, 0x57, 0x2e, 0x68, 0x2a, 0x61, 0x90, 0x11, 0x4d, 0xc6, 0xaf, 0xb9, 0xb3, 0x43, 0x70,
+  0xb4, 0xf8, 0xfd, 0x6b, 0xc2, 0xd7, 0x84, 0x5e, 0x39, 0x96, 0x61, 0xec, 0x8f, 0x47, 0x11, 0x8b,
+  0x03, 0xb8, 0x43, 0x63, 0xfd, 0xf5, 0xdb, 0xeb, 0x1e, 0x1d, 0x75, 0x8f, 0x5a, 0x58, 0x29, 0x7a,
+  0xf0, 0xea, 0xf0, 0xf5, 0x2b, 0xc1, 0x39, 0x8d, 0xcc, 0x48, 0xea, 0x53, 0x1b, 0xdb, 0x61, 0x4a,
+  0x74, 0xb8, 0x41, 0x21, 0x1d, 0xed, 0xc0, 0xe0, 0x79, 0xf2, 0x5d, 0xd3, 0x43, 0xe2, 0x38, 0xdd,
+  0xf6, 0x82, 0x86, 0x26, 0xd1, 0x92, 0x10, 0x48, 0x61, 0x25, 0x72, 0x49, 0x00, 0x3a, 0x62, 0xf0,
+  0xd2, 0xfa, 0x2a, 0x1b, 0x7a, 0x40, 0x56, 0x11, 0xc1, 0xeb, 0xd3, 0x5a, 0xc3, 0x44, 0x55, 0xa4,
+  0xea, 0xd7, 0x5a, 0x21, 0x69, 0x4b, 0x83, 0xdf, 0xa3, 0x24, 0x47, 0x1a, 0x2f, 0xa5, 0xf6, 0x3b,
+  0xca, 0x17, 0xb7, 0xf7, 0x48, 0x94, 0x7d, 0x7e, 0x00, 0xfd, 0xde, 0xd1, 0x49, 0xa7, 0xdf, 0xeb,
+  0x1f, 0xc1, 0x79, 0x66, 0xa4, 0x75, 0x92, 0xe6, 0x3f, 0xe3, 0x19, 0xbd, 0x76, 0x28, 0xdc, 0xca,
+  0xea, 0x92, 0x04, 0xa7, 0x88, 0x61, 0x44, 0x24, 0xb1, 0xdd, 0x0a, 0xff, 0x0a, 0x0c, 0xba, 0x82,
+  0x93, 0xa8, 0x60, 0x96, 0x48, 0x15, 0x5d, 0x7e, 0x38, 0x9f, 0x7e, 0x9c, 0x4d, 0xbf, 0x87, 0x3f,
+  0xb8, 0xfa, 0x30, 0x87, 0xbc, 0xc9, 0x54, 0x37, 0x48, 0x52, 0x6c, 0x0b, 0x9d, 0xa1, 0xa1, 0xae,
+  0xa8, 0x0d, 0x6b, 0x49, 0xd0, 0x44, 0x0e, 0x5b, 0x52, 0x95, 0xdb, 0xbb, 0xc2, 0xca, 0x32, 0x8c,
+  0x6f, 0xd1, 0x96, 0xb4, 0xc8, 0xbc, 0x16, 0x8c, 0x36, 0x7e, 0x29, 0x78, 0x93, 0x66, 0x5b, 0xbf,
+  0xe2, 0x3e, 0xf8, 0xdb, 0xeb, 0x20, 0x78, 0xd5, 0x7d, 0x10, 0x79, 0x89, 0xd0, 0x3f, 0x7f, 0xfd,
+  0xf9, 0xbb, 0xd0, 0xbf, 0xc9, 0xfe, 0x05, 0x56, 0x70, 0x52, 0x8f, 0xd9, 0x0a, 0x00, 0x00
+};
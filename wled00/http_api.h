@@ -0,0 +1,100 @@
+#ifndef WLED_HTTP_API_H
+#define WLED_HTTP_API_H
+
+/*
+ * Tokenizer for the HTTP API (/win&A=128&FX=5...).
+ * The request is split at '&' in a single pass, each parameter is looked up by its key
+ * and the position of its value is recorded, so handleSet() does not have to search the request once per key.
+ * Independent of Arduino, so it can be compiled on a host and checked against recorded requests.
+ *
+ * Positions are the same the previous indexOf() based parser used (key position + 3),
+ * only the first occurrence of a key counts.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+//key name, first and second character (0 for single letter keys, which must be preceded by '&')
+#define HTTP_API_KEYS(KEY) \
+  KEY(A , 'A', 0 ) KEY(AX, 'A','X') KEY(B , 'B', 0 ) KEY(B2, 'B','2') KEY(C2, 'C','2') KEY(C3, 'C','3') KEY(CL, 'C','L') KEY(CT, 'C','T') \
+  KEY(CY, 'C','Y') KEY(FP, 'F','P') KEY(FX, 'F','X') KEY(G , 'G', 0 ) KEY(G2, 'G','2') KEY(GP, 'G','P') KEY(H2, 'H','2') KEY(HU, 'H','U') \
+  KEY(IN, 'I','N') KEY(IX, 'I','X') KEY(K , 'K', 0 ) KEY(K2, 'K','2') KEY(LO, 'L','O') KEY(LX, 'L','X') KEY(LY, 'L','Y') KEY(M , 'M', 0 ) \
+  KEY(MI, 'M','I') KEY(NB, 'N','B') KEY(ND, 'N','D') KEY(NF, 'N','F') KEY(NL, 'N','L') KEY(NM, 'N','M') KEY(NN, 'N','N') KEY(NT, 'N','T') \
+  KEY(NX, 'N','X') KEY(OL, 'O','L') KEY(P1, 'P','1') KEY(P2, 'P','2') KEY(PL, 'P','L') KEY(PS, 'P','S') KEY(PT, 'P','T') KEY(R , 'R', 0 ) \
+  KEY(R2, 'R','2') KEY(RB, 'R','B') KEY(RD, 'R','D') KEY(RN, 'R','N') KEY(RV, 'R','V') KEY(S , 'S', 0 ) KEY(S2, 'S','2') KEY(SA, 'S','A') \
+  KEY(SB, 'S','B') KEY(SC, 'S','C') KEY(SM, 'S','M') KEY(SN, 'S','N') KEY(SP, 'S','P') KEY(SR, 'S','R') KEY(SS, 'S','S') KEY(ST, 'S','T') \
+  KEY(SV, 'S','V') KEY(SX, 'S','X') KEY(T , 'T', 0 ) KEY(TT, 'T','T') KEY(U0, 'U','0') KEY(U1, 'U','1') KEY(W , 'W', 0 ) KEY(W2, 'W','2')
+
+enum HttpApiKey : uint8_t {
+  #define HTTP_API_ENUM(name, c0, c1) API_##name,
+  HTTP_API_KEYS(HTTP_API_ENUM)
+  #undef HTTP_API_ENUM
+  API_KEY_COUNT
+};
+
+//perfect hash of the two key characters, the compiler turns the switch into a lookup
+inline uint8_t httpApiKey(char c0, char c1)
+{
+  switch (((uint8_t)c0 << 8) | (uint8_t)c1) {
+    #define HTTP_API_CASE(name, k0, k1) case (((uint8_t)k0 << 8) | (uint8_t)k1): return API_##name;
+    HTTP_API_KEYS(HTTP_API_CASE)
+    #undef HTTP_API_CASE
+  }
+  return API_KEY_COUNT;
+}
+
+//keys that are switches and match without a value
+inline bool httpApiFlag(uint8_t key)
+{
+  switch (key) {
+    case API_H2: case API_IN: case API_K2: case API_ND: case API_NN: case API_RB: case API_SC: case API_SR: return true;
+  }
+  return false;
+}
+
+class HttpApiRequest {
+  public:
+    HttpApiRequest(const char* req, uint16_t len) : _req(req), _len(len)
+    {
+      for (uint8_t i = 0; i < API_KEY_COUNT; i++) _pos[i] = 0;
+      parse();
+    }
+
+    bool has(uint8_t key) const { return _pos[key]; }
+
+    //value of the key, empty if it is absent or has none
+    const char* val(uint8_t key) const { return _req + (_pos[key] ? _pos[key] : _len); }
+
+    long num(uint8_t key) const { return atol(val(key)); }
+
+  private:
+    const char* _req;
+    uint16_t _len;
+    uint16_t _pos[API_KEY_COUNT]; //0 if the key is absent, a key can never be at the start of the request
+
+    void parse()
+    {
+      uint16_t i = 0;
+      while (i < _len && _req[i] != '&') i++; //"win" prefix
+      while (i < _len) {
+        uint16_t s = ++i; //after '&'
+        while (i < _len && _req[i] != '&') i++;
+        if (i - s < 2) continue;
+
+        uint8_t key; uint16_t pos;
+        if (_req[s+1] == '=') { //single letter
+          key = httpApiKey(_req[s], 0);
+          pos = s +2;
+        } else {
+          key = httpApiKey(_req[s], _req[s+1]);
+          if (key < API_KEY_COUNT && !httpApiFlag(key) && (s +2 >= _len || _req[s+2] != '=')) continue;
+          pos = s +3;
+        }
+        if (key >= API_KEY_COUNT || _pos[key]) continue;
+        _pos[key] = (pos > _len) ? _len : pos;
+      }
+    }
+};
+
+#endif
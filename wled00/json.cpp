@@ -4,7 +4,58 @@
  * JSON API (De)serialization
  */
 
-void deserializeSegment(JsonObject elem, byte it)
+//individual LEDs ("i"), entries are applied one by one so they can be streamed
+void beginSegmentPixels(byte id)
+{
+  WS2812FX::Segment& seg = strip.getSegment(id);
+  strip.setPixelSegment(id);
+
+  //freeze and init to black
+  if (!seg.getOption(SEG_OPTION_FREEZE)) {
+    seg.setOption(SEG_OPTION_FREEZE, true);
+    strip.fill(0);
+  }
+}
+
+//an index sets the start, a second one the end of a range, a color fills it (or the next LED), returns false on invalid entries
+bool applySegmentPixel(JsonVariant entry, SegmentPixelCursor& cur)
+{
+  if (entry.is<JsonInteger>()) {
+    if (!cur.set) {
+      cur.start = entry;
+      cur.set = 1;
+    } else {
+      cur.stop = entry;
+      cur.set = 2;
+    }
+    return true;
+  }
+  JsonArray icol = entry;
+  if (icol.isNull()) return false;
+
+  byte sz = icol.size();
+  if (sz == 0 && sz > 4) return false;
+
+  int rgbw[] = {0,0,0,0};
+  copyArray(icol, rgbw);
+
+  if (cur.set < 2) cur.stop = cur.start + 1;
+  for (uint16_t i = cur.start; i < cur.stop; i++) {
+    strip.setPixelColor(i, rgbw[0], rgbw[1], rgbw[2], rgbw[3]);
+  }
+  if (!cur.set) cur.start++;
+  cur.set = 0;
+  return true;
+}
+
+void endSegmentPixels()
+{
+  strip.setPixelSegment(255);
+  strip.trigger();
+}
+
+//pixelsStreamed: "i" is applied separately, keep the segment frozen even if elem has none
+void deserializeSegment(JsonObject elem, byte it, bool pixelsStreamed)
 {
   byte id = elem[F("id")] | it;
   if (id < strip.getMaxSegments())
@@ -106,58 +157,24 @@ void deserializeSegment(JsonObject elem, byte it)
 
     JsonArray iarr = elem[F("i")]; //set individual LEDs
     if (!iarr.isNull()) {
-      strip.setPixelSegment(id);
-
-      //freeze and init to black
-      if (!seg.getOption(SEG_OPTION_FREEZE)) {
-        seg.setOption(SEG_OPTION_FREEZE, true);
-        strip.fill(0);
+      beginSegmentPixels(id);
+      SegmentPixelCursor cur;
+      for (JsonVariant entry : iarr) {
+        if (!applySegmentPixel(entry, cur)) break;
       }
-
-      uint16_t start = 0, stop = 0;
-      byte set = 0; //0 nothing set, 1 start set, 2 range set
-
-      for (uint16_t i = 0; i < iarr.size(); i++) {
-        if(iarr[i].is<JsonInteger>()) {
-          if (!set) {
-            start = iarr[i];
-            set = 1;
-          } else {
-            stop = iarr[i];
-            set = 2;
-          }
-        } else {
-          JsonArray icol = iarr[i];
-          if (icol.isNull()) break;
-
-          byte sz = icol.size();
-          if (sz == 0 && sz > 4) break;
-
-          int rgbw[] = {0,0,0,0};
-          byte cp = copyArray(icol, rgbw);
-
-          if (set < 2) stop = start + 1;
-          for (uint16_t i = start; i < stop; i++) {
-            strip.setPixelColor(i, rgbw[0], rgbw[1], rgbw[2], rgbw[3]);
-          }
-          if (!set) start++;
-          set = 0;
-        }
-      }
-      strip.setPixelSegment(255);
-      strip.trigger();
-    } else { //return to regular effect
+      endSegmentPixels();
+    } else if (!pixelsStreamed) { //return to regular effect
       seg.setOption(SEG_OPTION_FREEZE, false);
     }
 
   }
 }
 
-bool deserializeState(JsonObject root)
+//state fields applied before the segments, the incremental parser also applies them when a "seg" is too large to be kept
+void deserializeStateFields(JsonObject root)
 {
   strip.applyToAllSelected = false;
-  bool stateResponse = root[F("v")] | false;
-  
+
   bri = root["bri"] | bri;
   
   bool on = root["on"] | (bri > 0);
@@ -198,7 +215,6 @@ bool deserializeState(JsonObject root)
   JsonObject udpn = root["udpn"];
   notifyDirect         = udpn[F("send")] | notifyDirect;
   receiveNotifications = udpn[F("recv")] | receiveNotifications;
-  bool noNotification  = udpn[F("nn")]; //send no notification just for this request
 
   unsigned long timein = root[F("time")] | -1;
   if (timein != -1) {
@@ -220,10 +236,21 @@ bool deserializeState(JsonObject root)
   byte prevMain = strip.getMainSegmentId();
   strip.mainSegment = root[F("mainseg")] | prevMain;
   if (strip.getMainSegmentId() != prevMain) setValuesFromMainSeg();
+}
+
+//parser: root is from the incremental parser, which keeps "seg" as raw JSON and applies it itself
+bool deserializeState(JsonObject root, JsonStateParser* parser)
+{
+  bool stateResponse = root[F("v")] | false;
+  deserializeStateFields(root);
+  bool noNotification = root["udpn"][F("nn")]; //send no notification just for this request
 
   int it = 0;
   JsonVariant segVar = root["seg"];
-  if (segVar.is<JsonObject>())
+  if (parser)
+  {
+    parser->applySegments();
+  } else if (segVar.is<JsonObject>())
   {
     int id = segVar[F("id")] | -1;
     
@@ -331,8 +358,9 @@ void serializeSegment(JsonObject& root, WS2812FX::Segment& seg, byte id, bool fo
   root[F("mi")]  = seg.getOption(SEG_OPTION_MIRROR);
 }
 
-void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segmentBounds)
-{ 
+//all state fields except the segments
+void serializeStateFields(JsonObject root, bool forPreset, bool includeBri)
+{
   if (includeBri) {
     root["on"] = (bri > 0);
     root["bri"] = briLast;
@@ -374,6 +402,11 @@ void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segme
   }
 
   root[F("mainseg")] = strip.getMainSegmentId();
+}
+
+void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segmentBounds)
+{ 
+  serializeStateFields(root, forPreset, includeBri);
 
   JsonArray seg = root.createNestedArray("seg");
   for (byte s = 0; s < strip.getMaxSegments(); s++)
@@ -444,6 +477,7 @@ void serializeInfo(JsonObject root)
     case REALTIME_MODE_ARTNET:   root["lm"] = F("Art-Net"); break;
     case REALTIME_MODE_TPM2NET:  root["lm"] = F("tpm2.net"); break;
     case REALTIME_MODE_DDP:      root["lm"] = F("DDP"); break;
+    case REALTIME_MODE_WEBSOCKET: root["lm"] = F("WebSocket"); break;
   }
 
   if (realtimeIP[0] == 0)
@@ -473,6 +507,52 @@ void serializeInfo(JsonObject root)
   fs_info["u"] = fsBytesUsed / 1000;
   fs_info["t"] = fsBytesTotal / 1000;
   fs_info[F("pmt")] = presetsModifiedTime;
+
+  JsonObject e131_info = root.createNestedObject("e131");
+  e131_info[F("frm")] = e131FramesComplete; //frames shown with all universes
+  e131_info[F("part")] = e131FramesPartial; //frames shown after timeout or early sync
+  e131_info[F("drop")] = e131FramesDropped; //frames overwritten before showing
+  e131_info[F("sync")] = e131SyncActive();
+  e131_info[F("filt")] = e131.getFilteredCount(); //packets for universes not handled
+  e131_info[F("polls")] = artPollReplyCount;      //Art-Net polls answered
+  //totals over all universes, per universe arrays would not fit the document with many universes
+  uint32_t e131Packets = 0, e131Lost = 0, e131WorstLost = 0;
+  uint16_t e131Worst = 0;
+  e131Lock();
+  for (uint8_t i = 0; i < e131UniverseCount; i++) {
+    e131Packets += e131UniverseStats[i].packets;
+    e131Lost += e131UniverseStats[i].lost;
+    if (e131UniverseStats[i].lost > e131WorstLost) {
+      e131WorstLost = e131UniverseStats[i].lost;
+      e131Worst = e131Universe + i;
+    }
+  }
+  uint8_t e131Universes = e131UniverseCount;
+  e131Unlock();
+  e131_info[F("univ")] = e131Universes; //universes handled
+  e131_info[F("pkt")] = e131Packets;    //packets received
+  e131_info[F("lost")] = e131Lost;      //sequence gaps (lost or reordered packets)
+  if (e131WorstLost) {
+    e131_info[F("wu")] = e131Worst;     //universe with the most sequence gaps
+    e131_info[F("wl")] = e131WorstLost;
+  }
+
+  JsonObject udp_info = root.createNestedObject("udp");
+  udp_info[F("rx")] = udpPacketsReceived;
+  udp_info[F("proc")] = udpPacketsProcessed;
+  udp_info[F("drop")] = udpPacketsDropped;
+
+  JsonObject web_info = root.createNestedObject("web");
+  web_info[F("heavy")] = webHeavyActive;
+  web_info[F("rej")] = webRequestsRejected;
+
+  JsonObject rtbuf_info = root.createNestedObject("rtbuf");
+  rtbuf_info[F("depth")] = realtimeBufferFrames;
+  rtbuf_info[F("interp")] = realtimeInterpolate;
+  rtbuf_info[F("q")] = rtBufQueued;
+  rtbuf_info[F("ivl")] = rtBufInterval; //averaged frame period in ms
+  rtbuf_info[F("under")] = rtBufUnderruns;
+  rtbuf_info[F("over")] = rtBufOverruns;
   
   #ifdef ARDUINO_ARCH_ESP32
   #ifdef WLED_DEBUG
@@ -535,6 +615,204 @@ void serializeInfo(JsonObject root)
   root["mac"] = escapedMac;
 }
 
+/*
+ * State deltas for pushed state messages (WebSocket, SSE).
+ * The top level state fields and each segment are hashed, a delta lists the ones whose hash differs from the base message.
+ */
+//FNV-1a over the serialized JSON
+class JsonHashWriter {
+  public:
+    uint32_t hash = 2166136261UL;
+    size_t write(uint8_t c) { hash = (hash ^ c) * 16777619UL; return 1; }
+    size_t write(const uint8_t* s, size_t n) { for (size_t i = 0; i < n; i++) write(s[i]); return n; }
+};
+
+//writes JSON text into a buffer of size cap, or only counts its length if there is none
+//len keeps counting past cap, so an overflow shows as len > cap
+class JsonBufferWriter {
+  public:
+    char* p;
+    size_t len = 0;
+    size_t cap;
+    JsonBufferWriter(char* buf, size_t size = SIZE_MAX) : p(buf), cap(size) {}
+    size_t write(uint8_t c) { if (p && len < cap) *p++ = c; len++; return 1; }
+    size_t write(const uint8_t* s, size_t n) {
+      if (p && len + n <= cap) { memcpy(p, s, n); p += n; len += n; }
+      else for (size_t i = 0; i < n; i++) write(s[i]);
+      return n;
+    }
+    void print(const char* s) { write((const uint8_t*)s, strlen(s)); }
+};
+
+//index is 0 for top level fields and the position +1 for segments
+static StateFieldHash hashStateField(const char* key, byte index, JsonVariantConst value)
+{
+  JsonHashWriter k, v;
+  k.write((const uint8_t*)key, strlen(key));
+  k.write(index);
+  serializeJson(value, v);
+  return {k.hash, v.hash};
+}
+
+//state fields are the top level keys, each segment counts as a field of its own
+byte hashStateFields(JsonObject state, StateFieldHash* hashes)
+{
+  byte n = 0;
+  for (JsonPair kv : state) {
+    const char* key = kv.key().c_str();
+    JsonArray seg = (strcmp(key, "seg") == 0) ? kv.value().as<JsonArray>() : JsonArray();
+    byte count = seg.isNull() ? 1 : seg.size();
+    for (byte i = 0; i < count; i++) {
+      if (n == STATE_DELTA_FIELDS) return STATE_DELTA_FIELDS +1; //too many to track
+      hashes[n++] = seg.isNull() ? hashStateField(key, 0, kv.value()) : hashStateField(key, i +1, seg[i]);
+    }
+  }
+  return n;
+}
+
+static bool stateFieldChanged(const StateDeltaBase& base, const StateFieldHash &h)
+{
+  for (byte i = 0; i < base.count; i++) {
+    if (base.fields[i].key == h.key) return base.fields[i].value != h.value;
+  }
+  return true;
+}
+
+bool stateChanged(const StateDeltaBase& base, const StateFieldHash* hashes, byte n)
+{
+  if (n != base.count) return true;
+  for (byte i = 0; i < n; i++) {
+    if (stateFieldChanged(base, hashes[i])) return true;
+  }
+  return false;
+}
+
+//{"rev":n,"base":m,"state":{changed fields,"seg":[changed segments]}}
+static void writeStateDelta(JsonObject state, const StateFieldHash* hashes, const StateDeltaBase& base, JsonBufferWriter &out)
+{
+  char head[48];
+  sprintf_P(head, PSTR("{\"rev\":%u,\"base\":%u,\"state\":{"), stateRevision, base.rev);
+  out.print(head);
+  bool first = true;
+  byte f = 0;
+  for (JsonPair kv : state) {
+    const char* key = kv.key().c_str();
+    JsonArray seg = (strcmp(key, "seg") == 0) ? kv.value().as<JsonArray>() : JsonArray();
+    byte count = seg.isNull() ? 1 : seg.size();
+    bool open = false;
+    for (byte i = 0; i < count; i++, f++) {
+      if (!stateFieldChanged(base, hashes[f])) continue;
+      if (open) out.write(',');
+      else {
+        if (!first) out.write(',');
+        out.write('"'); out.print(key); out.print("\":");
+        if (!seg.isNull()) out.write('[');
+        first = false;
+        open = true;
+      }
+      if (seg.isNull()) serializeJson(kv.value(), out);
+      else              serializeJson(seg[i], out);
+    }
+    if (open && !seg.isNull()) out.write(']');
+  }
+  out.print("}}");
+}
+
+//returns the length of the delta message and writes it to dest unless it is nullptr (dest needs one more byte for the terminator)
+//a delta cannot express removed fields or segments, in that case 0 is returned and clients need the full message
+size_t serializeStateDelta(JsonObject state, const StateFieldHash* hashes, byte n, const StateDeltaBase& base, char* dest)
+{
+  if (n > STATE_DELTA_FIELDS || n < base.count || !base.count) return 0;
+  JsonBufferWriter out(dest);
+  writeStateDelta(state, hashes, base, out);
+  if (dest) *out.p = 0;
+  return out.len;
+}
+
+/*
+ * The same messages built section by section (the state fields, then each segment) in small documents like JsonStream,
+ * for senders that would otherwise hold a document for the whole state.
+ * With base, a delta {"rev":n,"base":m,"state":{changed fields}} is written, else the full state {"state":{...},"rev":n}.
+ * The hashes of all sections are written to hashes, their count to n, STATE_DELTA_FIELDS +1 if there are too many to track.
+ */
+static void addStateSection(StateFieldHash h, StateFieldHash* hashes, byte& n)
+{
+  if (n < STATE_DELTA_FIELDS) hashes[n] = h;
+  if (n <= STATE_DELTA_FIELDS) n++;
+}
+
+static void writeStateSections(const StateDeltaBase* base, StateFieldHash* hashes, byte& n, JsonBufferWriter &out)
+{
+  char head[48];
+  if (base) sprintf_P(head, PSTR("{\"rev\":%u,\"base\":%u,\"state\":{"), stateRevision, base->rev);
+  else strcpy_P(head, PSTR("{\"state\":{"));
+  out.print(head);
+  n = 0;
+  bool first = true;
+  {
+    DynamicJsonDocument doc(JSON_STREAM_DOC_SIZE);
+    JsonObject fields = doc.to<JsonObject>();
+    serializeStateFields(fields, false, true);
+    for (JsonPair kv : fields) {
+      StateFieldHash h = hashStateField(kv.key().c_str(), 0, kv.value());
+      addStateSection(h, hashes, n);
+      if (base && !stateFieldChanged(*base, h)) continue;
+      if (!first) out.write(',');
+      first = false;
+      out.write('"'); out.print(kv.key().c_str()); out.print("\":");
+      serializeJson(kv.value(), out);
+    }
+  }
+  bool open = false;
+  byte i = 0;
+  for (byte s = 0; s < strip.getMaxSegments(); s++) {
+    WS2812FX::Segment sg = strip.getSegment(s);
+    if (!sg.isActive()) continue;
+    DynamicJsonDocument doc(JSON_STREAM_DOC_SIZE);
+    JsonObject seg = doc.to<JsonObject>();
+    serializeSegment(seg, sg, s, false, true);
+    StateFieldHash h = hashStateField("seg", ++i, seg);
+    addStateSection(h, hashes, n);
+    if (base && !stateFieldChanged(*base, h)) continue;
+    if (open) out.write(',');
+    else {
+      if (!first) out.write(',');
+      out.print("\"seg\":[");
+      first = false;
+      open = true;
+    }
+    serializeJson(seg, out);
+  }
+  if (!base && !open) { //the full state always has the array
+    if (!first) out.write(',');
+    out.print("\"seg\":[");
+    open = true;
+  }
+  if (open) out.write(']');
+  if (base) out.print("}}");
+  else {
+    sprintf_P(head, PSTR("},\"rev\":%u}"), stateRevision);
+    out.print(head);
+  }
+}
+
+//returns the length of the message and writes it to dest if it fits into size (which needs one more byte for the terminator)
+size_t serializeStateSections(const StateDeltaBase* base, StateFieldHash* hashes, byte& n, char* dest, size_t size)
+{
+  JsonBufferWriter out(dest, size ? size -1 : 0);
+  writeStateSections(base, hashes, n, out);
+  if (dest && out.len < size) *out.p = 0;
+  return out.len;
+}
+
+//the message just sent becomes the base for the next delta
+void setStateDeltaBase(StateDeltaBase& base, const StateFieldHash* hashes, byte n)
+{
+  base.count = (n > STATE_DELTA_FIELDS) ? 0 : n;
+  memcpy(base.fields, hashes, sizeof(StateFieldHash) * base.count);
+  base.rev = stateRevision;
+}
+
 void serveJson(AsyncWebServerRequest* request)
 {
   byte subJson = 0;
@@ -546,10 +824,14 @@ void serveJson(AsyncWebServerRequest* request)
     serveLiveLeds(request);
     return;
   }
-  else if (url.indexOf(F("eff"))   > 0) {
-    request->send_P(200, "application/json", JSON_mode_names);
-    return;
+  else if (url.indexOf(F("fxdata")) > 0) { //effect metadata, unchanged until the next update so it is served with an ETag
+    if (strip.getUsermodEffectCount()) subJson = 5; //unless usermods add to it
+    else {
+      serveStaticAsset(request, "application/json", (const uint8_t*)JSON_mode_data, strlen_P(JSON_mode_data));
+      return;
+    }
   }
+  else if (url.indexOf(F("eff"))   > 0) subJson = 4;
   else if (url.indexOf(F("pal"))   > 0) {
     request->send_P(200, "application/json", JSON_palette_names);
     return;
@@ -559,32 +841,151 @@ void serveJson(AsyncWebServerRequest* request)
     return;
   }
   
-  AsyncJsonResponse* response = new AsyncJsonResponse(JSON_BUFFER_SIZE);
-  JsonObject doc = response->getRoot();
+  //streamed in sections, so the memory needed does not grow with the number of segments
+  std::shared_ptr<JsonStream> stream(new JsonStream(subJson));
+  AsyncWebServerResponse* response = request->beginChunkedResponse("application/json",
+    [stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      return stream->fill(buffer, maxLen);
+    });
+  request->send(response);
+}
 
-  switch (subJson)
-  {
-    case 1: //state
-      serializeState(doc); break;
-    case 2: //info
-      serializeInfo(doc); break;
-    default: //all
-      JsonObject state = doc.createNestedObject("state");
-      serializeState(state);
-      JsonObject info  = doc.createNestedObject("info");
-      serializeInfo(info);
-      if (subJson != 3)
-      {
-        doc[F("effects")]  = serialized((const __FlashStringHelper*)JSON_mode_names);
-        doc[F("palettes")] = serialized((const __FlashStringHelper*)JSON_palette_names);
-      }
+/*
+ * /json writer. Each section (state fields, a segment, info) is serialized on its own
+ * into a small document when the previous one has been sent, the effect and palette
+ * names are copied from flash directly.
+ */
+JsonStream::~JsonStream()
+{
+  free(_text);
+}
+
+void JsonStream::setFlash(const char* text, size_t len)
+{
+  _flash = text;
+  _len = (len == SIZE_MAX) ? strlen_P(text) : len;
+  _pos = 0;
+}
+
+//renders doc after prefix, an open object leaves the closing brace off to append more fields
+bool JsonStream::setDoc(JsonDocument& doc, const char* prefix, const char* suffix)
+{
+  size_t plen = strlen_P(prefix), slen = strlen_P(suffix), jlen = measureJson(doc);
+  _text = (char*)malloc(plen + jlen + slen +1);
+  if (!_text) return false;
+  strcpy_P(_text, prefix);
+  serializeJson(doc, _text + plen, jlen +1);
+  _len = plen + jlen;
+  if (slen) {
+    _len--; //strip closing brace
+    strcpy_P(_text + _len, suffix);
+    _len += slen;
+  }
+  _flash = nullptr;
+  _pos = 0;
+  return true;
+}
+
+//effects registered by usermods follow the built-in ones, as names (,"name") or /json/fxdata entries (,["name","uses",pal])
+//the closing bracket of the array is appended
+bool JsonStream::setUsermodEffects(bool data)
+{
+  size_t len = 2;
+  for (uint8_t i = 0; i < strip.getUsermodEffectCount(); i++) {
+    const WS2812FX::UsermodEffect* fx = strip.getUsermodEffect(MODE_COUNT + i);
+    len += strlen_P(fx->name) + (data ? strlen_P(fx->uses) + 12 : 3);
+  }
+  _text = (char*)malloc(len);
+  if (!_text) return false;
+  char* p = _text;
+  for (uint8_t i = 0; i < strip.getUsermodEffectCount(); i++) {
+    const WS2812FX::UsermodEffect* fx = strip.getUsermodEffect(MODE_COUNT + i);
+    strcpy_P(p, data ? PSTR(",[\"") : PSTR(",\"")); p += strlen(p);
+    strcpy_P(p, fx->name); p += strlen(p);
+    if (data) {
+      strcpy_P(p, PSTR("\",\"")); p += strlen(p);
+      strcpy_P(p, fx->uses); p += strlen(p);
+      p += sprintf_P(p, PSTR("\",%u]"), (unsigned)fx->palette);
+    } else *p++ = '"';
+  }
+  *p++ = ']'; *p = 0;
+  _len = p - _text;
+  _flash = nullptr;
+  _pos = 0;
+  return true;
+}
+
+bool JsonStream::nextPart()
+{
+  free(_text);
+  _text = nullptr;
+  _flash = nullptr;
+  bool all = (_subJson == 0 || _subJson == 3);
+  bool state = (_subJson == 1 || all), info = (_subJson == 2 || all);
+  bool effects = (_subJson == 0 || _subJson == 4);
+
+  while (true) {
+    switch (_part++) {
+      case 0:
+        if (all) { setFlash(PSTR("{\"state\":")); return true; }
+        break;
+      case 1:
+        if (state) {
+          DynamicJsonDocument doc(JSON_STREAM_DOC_SIZE);
+          serializeStateFields(doc.to<JsonObject>(), false, true);
+          return setDoc(doc, PSTR(""), PSTR(",\"seg\":["));
+        }
+        break;
+      case 2:
+        if (!state) break;
+        for (; _seg < strip.getMaxSegments(); _seg++) {
+          WS2812FX::Segment sg = strip.getSegment(_seg);
+          if (!sg.isActive()) continue;
+          DynamicJsonDocument doc(JSON_STREAM_DOC_SIZE);
+          JsonObject seg0 = doc.to<JsonObject>();
+          serializeSegment(seg0, sg, _seg, false, true);
+          _seg++;
+          _part--; //stay here until all segments are sent
+          bool first = _firstSeg;
+          _firstSeg = false;
+          return setDoc(doc, first ? PSTR("") : PSTR(","), PSTR(""));
+        }
+        setFlash(PSTR("]}"));
+        return true;
+      case 3:
+        if (info) {
+          DynamicJsonDocument doc(JSON_STREAM_DOC_SIZE);
+          serializeInfo(doc.to<JsonObject>());
+          return setDoc(doc, all ? PSTR(",\"info\":") : PSTR(""), PSTR(""));
+        }
+        break;
+      case 4: if (_subJson == 0) { setFlash(PSTR(",\"effects\":")); return true; } break;
+      case 5: if (effects) { setFlash(JSON_mode_names, strlen_P(JSON_mode_names) -2); return true; } break; //without the trailing ",]"
+      case 6: if (effects) return setUsermodEffects(false); break;
+      case 7: if (_subJson == 0) { setFlash(PSTR(",\"palettes\":")); return true; } break;
+      case 8: if (_subJson == 0) { setFlash(JSON_palette_names); return true; } break;
+      case 9: if (all) { setFlash(PSTR("}")); return true; } break;
+      case 10: if (_subJson == 5) { setFlash(JSON_mode_data, strlen_P(JSON_mode_data) -1); return true; } break; //without the closing bracket
+      case 11: if (_subJson == 5) return setUsermodEffects(true); break;
+      default: return false;
+    }
   }
-  
-  response->setLength();
-  request->send(response);
 }
 
-#define MAX_LIVE_LEDS 180
+size_t JsonStream::fill(uint8_t* buffer, size_t maxLen)
+{
+  size_t written = 0;
+  while (written < maxLen) {
+    if (_pos >= _len && !nextPart()) break;
+    size_t n = _len - _pos;
+    if (n > maxLen - written) n = maxLen - written;
+    if (_flash) memcpy_P(buffer + written, _flash + _pos, n);
+    else        memcpy(buffer + written, _text + _pos, n);
+    _pos += n;
+    written += n;
+  }
+  return written;
+}
 
 bool serveLiveLeds(AsyncWebServerRequest* request, uint32_t wsClient)
 {
@@ -621,3 +1022,377 @@ bool serveLiveLeds(AsyncWebServerRequest* request, uint32_t wsClient)
   #endif
   return true;
 }
+
+/*
+ * Incremental state parser. Tracks the structure byte by byte with a small stack and
+ * copies each value into the buffer it belongs to, so no document for the whole message is needed:
+ * - root fields go to _rest, parsed into _doc at the end. "seg" is kept there as raw JSON, for applySegments()
+ *   and for a request saved as preset ("psave" with "o")
+ * - if "seg" does not fit, it is streamed: each element goes to _seg and is applied when it is complete,
+ *   each entry of a segment's "i" array goes to _pix and is applied right away
+ * applySegments() streams the kept "seg" the same way, so the document for one segment is all that is needed.
+ */
+
+//root fields applied by deserializeStateFields(), "udpn" is left out since deserializeState() reads "nn" from it again
+static const char* const stateFieldKeys[] = {"on", "bri", "transition", "tt", "pl", "ccnf", "nl", "time", "rb", "lor", "live", "mainseg"};
+
+void JsonStateParser::begin()
+{
+  _doc.clear();
+  _restLen = _segLen = 0;
+  _fieldStart = _segKeyStart = _segStart = _segEnd = 0;
+  _segVal = _segValLen = 0;
+  _appliedFields = _segTargets = 0;
+  _pixLen = _keyLen = _depth = 0;
+  _elemDepth = 0;
+  _key[0] = '\0';
+  _error = _done = false;
+  _inKey = _expectKey = false;
+  _capSeg = _streaming = _segStreamed = false;
+  _cap = CAP_NONE;
+  _capLevel = 0;
+  _capStr = _capEsc = false;
+  _inSegArray = _segObject = _inElement = _inPixels = _elemPixels = _pixStop = false;
+  _segIt = _segFields = 0;
+}
+
+bool JsonStateParser::feed(const uint8_t* data, size_t len)
+{
+  for (size_t i = 0; i < len && !_error; i++) parse(data[i]);
+  return !_error;
+}
+
+bool JsonStateParser::end()
+{
+  if (_error || !_done) return false;
+  uint16_t fields = _restLen;
+  if (_segEnd) { //move "seg" behind the other root fields
+    uint16_t segLen = _segEnd - _segKeyStart;
+    std::rotate(_rest + _segKeyStart, _rest + _segEnd, _rest + _restLen);
+    fields = _restLen - segLen;
+    if (!_segKeyStart && fields) _rest[0] = '{'; //"seg" was the first field
+    _segVal = fields + (_segStart - _segKeyStart);
+    _segValLen = _segEnd - _segStart;
+  }
+  //{root fields}\0, the key of "seg" is overwritten
+  if (!fields) _rest[fields++] = '{';
+  _rest[fields] = '}';
+  _rest[fields +1] = '\0';
+  DeserializationError error = deserializeJson(_doc, _rest); //strings stay in _rest
+  if (error || !_doc.is<JsonObject>()) return false;
+  JsonObject root = _doc.as<JsonObject>();
+  if (_segValLen) root["seg"] = serialized((const char*)(_rest + _segVal), _segValLen); //raw, applied by applySegments()
+
+  if (_segStreamed) {
+    if ((root["psave"] | 0) > 0 && root["o"]) return false; //the request cannot be saved without its segments
+    for (byte i = 0; i < sizeof(stateFieldKeys) / sizeof(stateFieldKeys[0]); i++) {
+      if (_appliedFields & (1 << i)) root.remove(stateFieldKeys[i]); //applied before the segments already
+    }
+  }
+  return true;
+}
+
+void JsonStateParser::applySegments()
+{
+  if (!_segValLen) return;
+  replaySeg(_rest + _segVal, _segValLen);
+  _segValLen = 0;
+}
+
+void JsonStateParser::put(char c)
+{
+  switch (_cap) {
+    case CAP_REST:
+      if (_restLen >= JSON_PARSER_REST_SIZE -2 && _segEnd) streamSeg(); //root fields take precedence over keeping "seg"
+      if (_restLen < JSON_PARSER_REST_SIZE -2) _rest[_restLen++] = c; else _error = true;
+      break;
+    case CAP_SEG:  if (_segLen < JSON_PARSER_SEG_SIZE -2)   _seg[_segLen++] = c;   else _error = true; break;
+    case CAP_PIX:  if (_pixLen < JSON_PARSER_PIX_SIZE -1)   _pix[_pixLen++] = c;   else _error = true; break;
+    default: break;
+  }
+}
+
+void JsonStateParser::put(const char* s)
+{
+  while (*s) put(*s++);
+}
+
+void JsonStateParser::parse(char c)
+{
+  if (_capSeg && _restLen >= JSON_PARSER_REST_SIZE -2) streamSeg(); //"seg" does not fit, continue applying it as it arrives
+  if (_cap) { //inside a value being copied
+    if (_capKind == KIND_LITERAL) {
+      if (isalnum(c) || c == '-' || c == '+' || c == '.') { put(c); return; }
+      endValue(); //the delimiter is handled below
+    } else {
+      put(c);
+      if (_capStr) {
+        if (_capEsc) _capEsc = false;
+        else if (c == '\\') _capEsc = true;
+        else if (c == '"') {
+          _capStr = false;
+          if (_capKind == KIND_STRING) endValue();
+        }
+        return;
+      }
+      if (c == '"') _capStr = true;
+      else if (c == '{' || c == '[') _capLevel++;
+      else if (c == '}' || c == ']') { if (--_capLevel == 0) endValue(); }
+      return;
+    }
+  }
+
+  if (_inKey) {
+    if (c == '"') { _inKey = false; _key[_keyLen] = '\0'; return; }
+    if (c == '\\' || _keyLen >= sizeof(_key) -1) { _error = true; return; } //no known key is that long or escaped
+    _key[_keyLen++] = c;
+    return;
+  }
+  if (c == ' ' || c == '\t' || c == '\r' || c == '\n') return;
+  if (_done) { _error = true; return; } //data after the root object
+
+  if (!_depth) {
+    if (c != '{') { _error = true; return; }
+    _stack[_depth++] = '{';
+    _expectKey = true;
+    return;
+  }
+
+  if (_stack[_depth -1] == '{') {
+    if (_expectKey) {
+      if (c == '"') { _inKey = true; _keyLen = 0; _expectKey = false; }
+      else if (c == '}') closeContainer(c);
+      else if (c != ',') _error = true;
+      return;
+    }
+    if (c == ':') return;
+    _expectKey = true; //after this value
+    startValue(c);
+    return;
+  }
+
+  //array
+  if (c == ',') return;
+  if (c == ']') { closeContainer(c); return; }
+  startValue(c);
+}
+
+void JsonStateParser::startValue(char c)
+{
+  bool container = (c == '{' || c == '[');
+  if (container && _depth >= JSON_PARSER_DEPTH) { _error = true; return; }
+
+  bool seg = (_depth == 1 && container && !strcmp(_key, "seg"));
+  if (seg && (_streaming || _restLen + 8 >= JSON_PARSER_REST_SIZE -2)) { //applied as it arrives
+    if (!_streaming) {
+      applyFields(_restLen);
+      _streaming = _segStreamed = true;
+    }
+    _stack[_depth++] = c;
+    if (c == '[') _inSegArray = true;
+    else { _segObject = true; beginElement(); }
+    return;
+  }
+  if (_depth == 2 && _inSegArray && c == '{') {
+    _stack[_depth++] = c;
+    beginElement();
+    return;
+  }
+  if (_inElement && _depth == _elemDepth && c == '[' && !strcmp(_key, "i")) {
+    _stack[_depth++] = c;
+    beginPixels();
+    return;
+  }
+
+  //copy the value as a whole
+  if (_depth == 1) {
+    _cap = CAP_REST;
+    _fieldStart = _restLen;
+    _capSeg = seg;
+    if (seg) _segKeyStart = _restLen;
+    put(_restLen ? ',' : '{');
+    put('"'); put(_key); put("\":");
+    if (seg) _segStart = _restLen;
+  } else if (_inElement && _depth == _elemDepth) {
+    _cap = CAP_SEG;
+    if (_segFields++) put(',');
+    put('"'); put(_key); put("\":");
+  } else if (_inPixels && _depth == _elemDepth +1) {
+    _cap = CAP_PIX;
+    _pixLen = 0;
+  } else _cap = CAP_SKIP; //not part of the state API
+  _capKind = container ? KIND_CONTAINER : (c == '"') ? KIND_STRING : KIND_LITERAL;
+  _capLevel = container;
+  _capStr = (c == '"');
+  _capEsc = false;
+  put(c);
+}
+
+void JsonStateParser::endValue()
+{
+  if (_cap == CAP_PIX && _inPixels && !_pixStop && _segTargets) {
+    _pix[_pixLen] = '\0';
+    StaticJsonDocument<128> entry;
+    if (deserializeJson(entry, _pix)) _pixStop = true; //invalid entry ends "i"
+    SegmentPixelCursor cur;
+    for (byte s = 0; s < strip.getMaxSegments() && !_pixStop; s++) {
+      if (!(_segTargets & (1 << s))) continue;
+      cur = _cursor; //the same entries go to each segment
+      strip.setPixelSegment(s);
+      _pixStop = !applySegmentPixel(entry.as<JsonVariant>(), cur);
+    }
+    _cursor = cur;
+  }
+  if (_capSeg) { //"seg" is kept
+    _capSeg = false;
+    _segEnd = _restLen;
+  }
+  _cap = CAP_NONE;
+}
+
+void JsonStateParser::closeContainer(char c)
+{
+  char open = _stack[--_depth];
+  if ((open == '{') != (c == '}')) { _error = true; return; }
+  _expectKey = true; //the parent, if an object, continues with a key
+
+  if (_depth == _elemDepth && _inPixels) { //end of "i"
+    if (_segTargets) endSegmentPixels();
+    _inPixels = false;
+    _elemPixels = true;
+    //fields after "i" are applied to the same segments
+    _segLen = _segFields = 0;
+    _cap = CAP_SEG; put('{'); _cap = CAP_NONE;
+  } else if (_depth == _elemDepth -1 && _inElement) { //end of a segment
+    _inElement = false;
+    if (!_elemPixels || _segFields) applySegment(_elemPixels);
+    _segIt++;
+    _segObject = false;
+  } else if (_depth == 1 && _inSegArray) {
+    _inSegArray = false;
+  } else if (!_depth) {
+    _done = true;
+  }
+}
+
+void JsonStateParser::beginElement()
+{
+  _expectKey = true;
+  _inElement = true;
+  _elemPixels = false;
+  _elemDepth = _depth;
+  _segLen = _segFields = 0;
+  _cap = CAP_SEG; put('{'); _cap = CAP_NONE;
+}
+
+//segments an element is applied to, a "seg" object without "id" goes to the selected segments like in deserializeState()
+uint16_t JsonStateParser::segmentTargets(JsonObject elem)
+{
+  int id = elem["id"] | (_segObject ? -1 : _segIt);
+  if (id >= 0) return (id < strip.getMaxSegments()) ? 1 << id : 0;
+
+  uint16_t targets = 0;
+  byte lowestActive = 99;
+  for (byte s = 0; s < strip.getMaxSegments(); s++) {
+    WS2812FX::Segment& sg = strip.getSegment(s);
+    if (!sg.isActive()) continue;
+    if (lowestActive == 99) lowestActive = s;
+    if (sg.isSelected()) targets |= 1 << s;
+  }
+  if (!targets && lowestActive < strip.getMaxSegments()) targets = 1 << lowestActive;
+  return targets;
+}
+
+//applies the segment fields collected so far
+bool JsonStateParser::applySegment(bool pixelsStreamed)
+{
+  _cap = CAP_SEG; put('}'); _cap = CAP_NONE;
+  if (_error) return false;
+  _seg[_segLen] = '\0';
+  StaticJsonDocument<JSON_PARSER_SEG_SIZE> doc;
+  if (deserializeJson(doc, _seg) || !doc.is<JsonObject>()) return false;
+  JsonObject elem = doc.as<JsonObject>();
+  if (!_segIt) strip.applyToAllSelected = false;
+  if (!_elemPixels) _segTargets = segmentTargets(elem); //fields after "i" go to the same segments
+  for (byte s = 0; s < strip.getMaxSegments(); s++) {
+    if (_segTargets & (1 << s)) deserializeSegment(elem, s, pixelsStreamed);
+  }
+  return true;
+}
+
+void JsonStateParser::beginPixels()
+{
+  if (!_elemPixels) _segTargets = 0;
+  applySegment(true);
+  _cursor = SegmentPixelCursor();
+  _inPixels = true;
+  _pixStop = false;
+  for (byte s = 0; s < strip.getMaxSegments(); s++) {
+    if (_segTargets & (1 << s)) beginSegmentPixels(s);
+  }
+}
+
+//applies the complete root fields in _rest[0, len) before the segments, deserializeState() does not apply them again
+void JsonStateParser::applyFields(uint16_t len)
+{
+  if (!len) return;
+  char next = _rest[len];
+  _rest[len] = '}'; //more fields may follow
+  if (!deserializeJson(_doc, (const char*)_rest, len +1)) { //copies strings, _rest stays intact
+    JsonObject fields = _doc.as<JsonObject>();
+    deserializeStateFields(fields);
+    for (byte i = 0; i < sizeof(stateFieldKeys) / sizeof(stateFieldKeys[0]); i++) {
+      if (fields.containsKey(stateFieldKeys[i])) _appliedFields |= 1 << i;
+    }
+  }
+  _doc.clear();
+  _rest[len] = next;
+}
+
+//"seg" does not fit into _rest, or leaves no room for the root fields after it: the root fields received so far
+//are applied, then "seg" is applied from its copy and removed. The rest of it is applied as it arrives
+void JsonStateParser::streamSeg()
+{
+  bool complete = _segEnd;
+  uint16_t segEnd = complete ? _segEnd : _restLen;
+  uint16_t segLen = segEnd - _segKeyStart;
+  uint16_t fields = complete ? _fieldStart - segLen : _segKeyStart; //without the field being copied
+  std::rotate(_rest + _segKeyStart, _rest + segEnd, _rest + _restLen); //"seg" to the end
+  uint16_t tail = _restLen - segLen;
+  if (!_segKeyStart && tail) _rest[0] = '{'; //"seg" was the first field
+  applyFields(fields);
+  _streaming = _segStreamed = true;
+  _capSeg = false;
+  _segEnd = 0;
+
+  //a field after "seg" is being copied, its state is kept
+  Target cap = _cap; Kind capKind = _capKind; byte capLevel = _capLevel;
+  bool capStr = _capStr, capEsc = _capEsc;
+  char key[sizeof(_key)];
+  memcpy(key, _key, sizeof(key));
+  replaySeg(_rest + tail + (_segStart - _segKeyStart), segEnd - _segStart);
+  if (complete) {
+    _cap = cap; _capKind = capKind; _capLevel = capLevel;
+    _capStr = capStr; _capEsc = capEsc;
+    memcpy(_key, key, sizeof(key));
+    _fieldStart -= segLen;
+  }
+  _restLen = tail;
+}
+
+//feeds a "seg" value through the parser, as if it followed the "seg" key of the root object
+void JsonStateParser::replaySeg(const char* json, uint16_t len)
+{
+  _depth = 1;
+  _stack[0] = '{';
+  strcpy(_key, "seg");
+  _expectKey = false;
+  _cap = CAP_NONE;
+  _streaming = true;
+  _inSegArray = _segObject = _inElement = _inPixels = false;
+  _segIt = 0;
+  bool done = _done; //replayed after end() by applySegments()
+  _done = false;
+  for (uint16_t i = 0; i < len && !_error; i++) parse(json[i]);
+  _done = done;
+}
@@ -178,6 +178,14 @@ void sendNTPPacket()
   ntpUdp.endPacket();
 }
 
+//current NTP time as used by DDP timecodes (low 16 bits of seconds, 16 bits fraction), 0 if never synced
+uint32_t getNtpTimecode()
+{
+  if (!ntpSyncMillis) return 0;
+  uint32_t elapsed = millis() - ntpSyncMillis;
+  return ntpSyncTimecode + (uint32_t)(((uint64_t)elapsed << 16) / 1000);
+}
+
 bool checkNTPResponse()
 {
   int cb = ntpUdp.parsePacket();
@@ -196,6 +204,9 @@ bool checkNTPResponse()
     DEBUG_PRINT(F("Unix time = "));
     unsigned long epoch = secsSince1900 - 2208988799UL; //subtract 70 years -1sec (on avg. more precision)
     setTime(epoch);
+    ntpSyncTimecode = (lowWord << 16) | word(pbuf[44], pbuf[45]); //keep the fraction for DDP timecodes
+    ntpSyncMillis = millis();
+    if (!ntpSyncMillis) ntpSyncMillis = 1;
     DEBUG_PRINTLN(epoch);
     if (countdownTime - now() > 0) countdownOverTriggered = false;
     return true;
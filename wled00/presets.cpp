@@ -35,24 +35,22 @@ bool applyPreset(byte index)
   return false;
 }
 
+//saveobj is the JSON API request, its fields ("n", "ql", or the whole command if "o" is set) are stored with the preset
 void savePreset(byte index, bool persist, const char* pname, JsonObject saveobj)
 {
   if (index == 0 || index > 250) return;
-  bool docAlloc = (fileDoc != nullptr);
-  JsonObject sObj = saveobj;
+  DEBUGFS_PRINTLN(F("Allocating saving buffer"));
+  DynamicJsonDocument lDoc(JSON_BUFFER_SIZE);
 
-  if (!docAlloc) {
-    DEBUGFS_PRINTLN(F("Allocating saving buffer"));
-    DynamicJsonDocument lDoc(JSON_BUFFER_SIZE);
-    sObj = lDoc.to<JsonObject>();
+  if (saveobj.isNull()) {
+    JsonObject sObj = lDoc.to<JsonObject>();
     if (pname) sObj["n"] = pname;
     DEBUGFS_PRINTLN(F("Save current state"));
     serializeState(sObj, true);
     currentPreset = index;
-
-    writeObjectToFileUsingId("/presets.json", index, &lDoc);
-  } else { //from JSON API
-    DEBUGFS_PRINTLN(F("Reuse recv buffer"));
+  } else { //from JSON API, the request is copied since the parser's document has no room for the state
+    lDoc.set(saveobj);
+    JsonObject sObj = lDoc.as<JsonObject>();
     sObj.remove(F("psave"));
     sObj.remove(F("v"));
 
@@ -66,9 +64,9 @@ void savePreset(byte index, bool persist, const char* pname, JsonObject saveobj)
     sObj.remove("sb");
     sObj.remove(F("error"));
     sObj.remove(F("time"));
-
-    writeObjectToFileUsingId("/presets.json", index, fileDoc);
   }
+
+  writeObjectToFileUsingId("/presets.json", index, &lDoc);
   presetsModifiedTime = now(); //unix time
   updateFSInfo();
 }
@@ -0,0 +1,246 @@
+#include "wled.h"
+
+/*
+ * Jitter buffer for UDP realtime streams (WARLS/DRGB/DRGBW/DNRGB, Hyperion, TPM2.NET).
+ * Frames are queued as they arrive and presented at the averaged arrival rate,
+ * so that Wi-Fi bursts and gaps do not show up as stutter on the strip.
+ * None of these protocols carry timestamps, so the cadence is taken from the arrival times.
+ * With interpolation enabled, the strip is blended from the previous to the next frame
+ * at its own frame rate in between, which smooths out low-rate sources.
+ * Timecoded DDP frames use the same ring, but are shown at their own due time instead.
+ */
+
+#define RTBUF_BPP 4                  // slots hold RGBW after offset and gamma correction
+#define RTBUF_MIN_INTERVAL 5         // ms, upper bound of 200 fps for the presentation cadence
+#define RTBUF_MAX_INTERVAL 500       // ms, arrival gaps longer than this are pauses, not frame periods
+
+static byte* rtBufSlot(byte i)
+{
+  return rtBufSlots + (uint32_t)i * rtBufLeds * RTBUF_BPP;
+}
+
+//slots taking part in the ring, the last shown frame and the blend output follow after them
+static byte rtBufRing()
+{
+  return rtBufInterpolate ? rtBufAllocated -1 : rtBufAllocated;
+}
+
+//lerps the last shown frame towards the oldest queued one by t/256 and shows the result
+//two channels are blended per 32 bit multiply, RGBW slots are 4 byte aligned
+static void showRealtimeBlend(byte t)
+{
+  const uint32_t* from = (const uint32_t*)rtBufSlot(rtBufRing());
+  const uint32_t* to   = (const uint32_t*)rtBufSlot(rtBufHead);
+  uint32_t* out = (uint32_t*)rtBufSlot(rtBufRing() +1);
+  uint32_t ti = t +1, fi = 256 - ti;
+  for (uint16_t i = 0; i < rtBufLeds; i++) {
+    uint32_t a = from[i], b = to[i];
+    uint32_t rb = (((a & 0x00FF00FF) * fi + (b & 0x00FF00FF) * ti) >> 8) & 0x00FF00FF;
+    uint32_t gw = ((((a >> 8) & 0x00FF00FF) * fi + ((b >> 8) & 0x00FF00FF) * ti)) & 0xFF00FF00;
+    out[i] = rb | gw;
+  }
+  strip.setRealtimePixels(0, (const byte*)out, rtBufLeds, RTBUF_BPP, false);
+  strip.show();
+}
+
+//frames queued before presenting, interpolation needs at least the frame it is blending towards
+static byte realtimeBufferDepth()
+{
+  if (realtimeMode == REALTIME_MODE_DDP && ddpTimecoded) return DDP_TIMECODE_FRAMES;
+  if (realtimeBufferFrames) return realtimeBufferFrames;
+  return realtimeInterpolate ? 1 : 0;
+}
+
+bool realtimeBufferActive()
+{
+  if (!rtBufSlots || !realtimeBufferDepth()) return false;
+  if (realtimeMode == REALTIME_MODE_DDP) return ddpTimecoded;
+  return realtimeMode == REALTIME_MODE_UDP || realtimeMode == REALTIME_MODE_HYPERION || realtimeMode == REALTIME_MODE_TPM2NET;
+}
+
+static void resetRealtimeBuffer()
+{
+  rtBufHead = 0;
+  rtBufQueued = 0;
+  rtBufWriting = false;
+  rtBufPrefill = true;
+  rtBufLast = 0;
+  if (!rtBufSlots) return;
+  memset(rtBufSlot(0), 0, (uint32_t)rtBufLeds * RTBUF_BPP); //slot 0 is the base for the next stream
+  if (rtBufInterpolate) memset(rtBufSlot(rtBufRing()), 0, (uint32_t)rtBufLeds * RTBUF_BPP); //which fades in from black
+}
+
+//(re)allocates the frame slots if the depth or LED count changed, one slot more than the depth is needed for the frame being received
+//interpolation additionally keeps the last shown frame and a slot to render the blend into, which is not part of the ring
+static void allocRealtimeBuffer()
+{
+  byte depth = realtimeBufferDepth();
+  byte slots = depth ? depth +1 : 0;
+  if (slots && realtimeInterpolate) slots++;
+  //the same number of slots can mean a different layout (buf=2 is 3 ring slots, buf=0 with interpolation 1 ring slot and 2 more)
+  if (slots == rtBufAllocated && realtimeInterpolate == rtBufInterpolate && ledCount == rtBufLeds && (rtBufSlots || !slots)) return;
+
+  free(rtBufSlots);
+  rtBufSlots = nullptr;
+  rtBufAllocated = 0;
+  rtBufInterpolate = realtimeInterpolate;
+  resetRealtimeBuffer();
+  if (!slots) return;
+
+  rtBufLeds = ledCount;
+  rtBufSlots = (byte*)calloc((uint32_t)(slots + rtBufInterpolate) * ledCount, RTBUF_BPP);
+  if (!rtBufSlots) {
+    DEBUG_PRINTLN(F("Realtime buffer allocation failed, streaming unbuffered."));
+    realtimeBufferFrames = 0;
+    realtimeInterpolate = false;
+    rtBufInterpolate = false;
+    return;
+  }
+  rtBufAllocated = slots;
+}
+
+//returns the slot currently being received into, opening it as a copy of the previous frame so partial updates keep the other pixels
+static byte* realtimeBufferWriteSlot()
+{
+  byte slot = (rtBufHead + rtBufQueued) % rtBufRing();
+  if (!rtBufWriting) {
+    if (slot != rtBufLast) memcpy(rtBufSlot(slot), rtBufSlot(rtBufLast), (uint32_t)rtBufLeds * RTBUF_BPP);
+    rtBufWriting = true;
+  }
+  return rtBufSlot(slot);
+}
+
+void realtimeBufferPixel(uint16_t pix, byte r, byte g, byte b, byte w)
+{
+  if (pix >= rtBufLeds) return;
+  byte* p = realtimeBufferWriteSlot() + (uint32_t)pix * RTBUF_BPP;
+  p[0] = r; p[1] = g; p[2] = b; p[3] = w;
+}
+
+void realtimeBufferPixels(uint16_t pix, const byte* data, uint16_t count, byte stride, bool gamma)
+{
+  if (pix >= rtBufLeds) return;
+  if (pix + count > rtBufLeds) count = rtBufLeds - pix;
+  byte* p = realtimeBufferWriteSlot() + (uint32_t)pix * RTBUF_BPP;
+  for (uint16_t i = 0; i < count; i++) {
+    byte w = (stride > 3) ? data[3] : 0;
+    if (gamma) {
+      p[0] = strip.gamma8(data[0]); p[1] = strip.gamma8(data[1]); p[2] = strip.gamma8(data[2]); p[3] = strip.gamma8(w);
+    } else {
+      p[0] = data[0]; p[1] = data[1]; p[2] = data[2]; p[3] = w;
+    }
+    p += RTBUF_BPP;
+    data += stride;
+  }
+}
+
+//called where an unbuffered stream would call strip.show(), closes the received frame and queues it
+//unbuffered frames are shown once the UDP receive loop has drained all pending packets
+void realtimeShow()
+{
+  if (!realtimeBufferActive()) {
+    realtimeShowPending = true;
+    return;
+  }
+  if (!rtBufWriting) return; //nothing received since the last frame
+
+  unsigned long now = millis();
+  if (rtBufQueued == realtimeBufferDepth()) { //queue full, the oldest frame is dropped
+    rtBufHead = (rtBufHead +1) % rtBufRing();
+    rtBufQueued--;
+    rtBufOverruns++;
+  }
+  rtBufLast = (rtBufHead + rtBufQueued) % rtBufRing();
+  rtBufQueued++;
+  rtBufWriting = false;
+
+  //moving average of the frame period
+  unsigned long gap = now - rtBufLastArrival;
+  rtBufLastArrival = now;
+  if (gap < RTBUF_MIN_INTERVAL || gap > RTBUF_MAX_INTERVAL) return;
+  if (!rtBufInterval) rtBufInterval = gap;
+  else rtBufInterval = (rtBufInterval * 7 + gap) >> 3;
+}
+
+//queues the received frame to be shown at millis() due, for streams carrying their own timing (DDP timecodes)
+//the queued frames are all due before this one, so a full queue drops the new frame rather than the oldest
+void realtimeShowAt(unsigned long due)
+{
+  if (!rtBufWriting) return;
+  rtBufWriting = false;
+  if (rtBufQueued == realtimeBufferDepth()) {
+    rtBufOverruns++;
+    return; //the slot is reopened as a copy of the last queued frame
+  }
+  rtBufLast = (rtBufHead + rtBufQueued) % rtBufRing();
+  rtBufDue[rtBufLast] = due;
+  rtBufQueued++;
+}
+
+//shows the queued timecoded frame that is due, skipping those the loop was too late for
+static void handleRealtimeTimecoded(unsigned long now)
+{
+  if (!rtBufQueued || (long)(now - rtBufDue[rtBufHead]) < 0) return;
+  while (rtBufQueued > 1 && (long)(now - rtBufDue[(rtBufHead +1) % rtBufRing()]) >= 0) {
+    rtBufHead = (rtBufHead +1) % rtBufRing();
+    rtBufQueued--;
+  }
+  strip.setRealtimePixels(0, rtBufSlot(rtBufHead), rtBufLeds, RTBUF_BPP, false);
+  strip.show();
+  rtBufHead = (rtBufHead +1) % rtBufRing();
+  rtBufQueued--;
+}
+
+void handleRealtimeBuffer()
+{
+  if (realtimeMode != REALTIME_MODE_DDP) ddpTimecoded = false;
+  allocRealtimeBuffer();
+  if (!realtimeBufferActive()) {
+    if (rtBufQueued || rtBufWriting) resetRealtimeBuffer();
+    return;
+  }
+
+  unsigned long now = millis();
+  if (realtimeMode == REALTIME_MODE_DDP) {
+    handleRealtimeTimecoded(now);
+    return;
+  }
+  uint16_t interval = rtBufInterval ? rtBufInterval : RTBUF_MIN_INTERVAL;
+
+  if (!rtBufQueued) {
+    if (!rtBufPrefill && (long)(now - rtBufNextShow) >= 0) { //a frame is due but none arrived in time
+      rtBufUnderruns++;
+      rtBufPrefill = true;
+    }
+    return;
+  }
+  if (rtBufPrefill) {
+    if (rtBufQueued < realtimeBufferDepth()) return;
+    rtBufPrefill = false;
+    rtBufNextShow = now;
+    if (rtBufInterpolate) rtBufNextShow += interval; //blend in from the last shown frame
+    rtBufSegment = interval;
+  }
+  if ((long)(now - rtBufNextShow) < 0) {
+    if (rtBufInterpolate && millis() - strip.getLastShow() >= MIN_SHOW_DELAY) {
+      uint16_t left = rtBufNextShow - now;
+      byte t = (left >= rtBufSegment) ? 0 : 255 - (((uint32_t)left << 8) / rtBufSegment);
+      showRealtimeBlend(t);
+    }
+    return;
+  }
+
+  bool full = (rtBufQueued == realtimeBufferDepth());
+  strip.setRealtimePixels(0, rtBufSlot(rtBufHead), rtBufLeds, RTBUF_BPP, false);
+  strip.show();
+  if (rtBufInterpolate) memcpy(rtBufSlot(rtBufRing()), rtBufSlot(rtBufHead), (uint32_t)rtBufLeds * RTBUF_BPP);
+  rtBufHead = (rtBufHead +1) % rtBufRing();
+  rtBufQueued--;
+
+  //nudge the cadence if the sender clock drifts from ours, so the queue neither runs full nor dry
+  if (full) interval -= interval >> 4;
+  else if (!rtBufQueued) interval += interval >> 4;
+  rtBufNextShow += interval;
+  if ((long)(now - rtBufNextShow) > (long)interval) rtBufNextShow = now + interval; //fell behind (blocking loop), resync
+  rtBufSegment = rtBufNextShow - now;
+}
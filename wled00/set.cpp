@@ -1,4 +1,5 @@
 #include "wled.h"
+#include "http_api.h"
 
 /*
  * Receives client input
@@ -163,6 +164,9 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
     arlsDisableGammaCorrection = request->hasArg(F("RG"));
     t = request->arg(F("WO")).toInt();
     if (t >= -255  && t <= 255) arlsOffset = t;
+    t = request->arg(F("JB")).toInt();
+    if (t >= 0 && t <= 4) realtimeBufferFrames = (t == 1) ? 2 : t; //one frame cannot absorb any jitter
+    realtimeInterpolate = request->hasArg(F("JI"));
 
     alexaEnabled = request->hasArg(F("AL"));
     strlcpy(alexaInvocationName, request->arg(F("AI")).c_str(), 33);
@@ -339,24 +343,24 @@ void handleSettingsSet(AsyncWebServerRequest *request, byte subPage)
 
 
 
-//helper to get int value at a position in string
-int getNumVal(const String* req, uint16_t pos)
+//helper to get int value of a key
+int getNumVal(const HttpApiRequest& req, uint8_t key)
 {
-  return req->substring(pos+3).toInt();
+  return req.num(key);
 }
 
 
-//helper to get int value at a position in string
-bool updateVal(const String* req, const char* key, byte* val, byte minv, byte maxv)
+//helper to get int value of a key, "~" increments, "~-" decrements and "~<n>" adds n within the limits
+bool updateVal(const HttpApiRequest& req, uint8_t key, byte* val, byte minv, byte maxv)
 {
-  int pos = req->indexOf(key);
-  if (pos < 1) return false;
+  if (!req.has(key)) return false;
+  const char* v = req.val(key);
 
-  if (req->charAt(pos+3) == '~') {
-    int out = getNumVal(req, pos+1);
+  if (v[0] == '~') {
+    int out = atol(v +1);
     if (out == 0)
     {
-      if (req->charAt(pos+4) == '-')
+      if (v[1] == '-')
       {
         *val = (*val <= minv)? maxv : *val -1;
       } else {
@@ -370,7 +374,7 @@ bool updateVal(const String* req, const char* key, byte* val, byte minv, byte ma
     }
   } else
   {
-    *val = getNumVal(req, pos);
+    *val = getNumVal(req, key);
   }
   return true;
 }
@@ -381,9 +385,9 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
 {
   if (!(req.indexOf("win") >= 0)) return false;
 
-  int pos = 0;
   DEBUG_PRINT(F("API req: "));
   DEBUG_PRINTLN(req);
+  HttpApiRequest api(req.c_str(), req.length());
 
   strip.applyToAllSelected = false;
   //snapshot to check if request changed values later, temporary.
@@ -396,23 +400,21 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
 
   //segment select (sets main segment)
   byte prevMain = strip.getMainSegmentId();
-  pos = req.indexOf(F("SM="));
-  if (pos > 0) {
-    strip.mainSegment = getNumVal(&req, pos);
+  if (api.has(API_SM)) {
+    strip.mainSegment = getNumVal(api, API_SM);
   }
   byte selectedSeg = strip.getMainSegmentId();
   if (selectedSeg != prevMain) setValuesFromMainSeg();
 
-  pos = req.indexOf(F("SS="));
-  if (pos > 0) {
-    byte t = getNumVal(&req, pos);
+  if (api.has(API_SS)) {
+    byte t = getNumVal(api, API_SS);
     if (t < strip.getMaxSegments()) selectedSeg = t;
   }
 
   WS2812FX::Segment& mainseg = strip.getSegment(selectedSeg);
-  pos = req.indexOf(F("SV=")); //segment selected
-  if (pos > 0) {
-    byte t = getNumVal(&req, pos);
+  //segment selected
+  if (api.has(API_SV)) {
+    byte t = getNumVal(api, API_SV);
     if (t == 2) {
       for (uint8_t i = 0; i < strip.getMaxSegments(); i++)
       {
@@ -426,82 +428,81 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   uint16_t stopI = mainseg.stop;
   uint8_t grpI = mainseg.grouping;
   uint16_t spcI = mainseg.spacing;
-  pos = req.indexOf(F("&S=")); //segment start
-  if (pos > 0) {
-    startI = getNumVal(&req, pos);
+  //segment start
+  if (api.has(API_S)) {
+    startI = getNumVal(api, API_S);
   }
-  pos = req.indexOf(F("S2=")); //segment stop
-  if (pos > 0) {
-    stopI = getNumVal(&req, pos);
+  //segment stop
+  if (api.has(API_S2)) {
+    stopI = getNumVal(api, API_S2);
   }
-  pos = req.indexOf(F("GP=")); //segment grouping
-  if (pos > 0) {
-    grpI = getNumVal(&req, pos);
+  //segment grouping
+  if (api.has(API_GP)) {
+    grpI = getNumVal(api, API_GP);
     if (grpI == 0) grpI = 1;
   }
-  pos = req.indexOf(F("SP=")); //segment spacing
-  if (pos > 0) {
-    spcI = getNumVal(&req, pos);
+  //segment spacing
+  if (api.has(API_SP)) {
+    spcI = getNumVal(api, API_SP);
   }
   strip.setSegment(selectedSeg, startI, stopI, grpI, spcI);
 
    //set presets
-  pos = req.indexOf(F("P1=")); //sets first preset for cycle
-  if (pos > 0) presetCycleMin = getNumVal(&req, pos);
+  //sets first preset for cycle
+  if (api.has(API_P1)) presetCycleMin = getNumVal(api, API_P1);
 
-  pos = req.indexOf(F("P2=")); //sets last preset for cycle
-  if (pos > 0) presetCycleMax = getNumVal(&req, pos);
+  //sets last preset for cycle
+  if (api.has(API_P2)) presetCycleMax = getNumVal(api, API_P2);
 
   //preset cycle
-  pos = req.indexOf(F("CY="));
-  if (pos > 0)
+  if (api.has(API_CY))
   {
-    char cmd = req.charAt(pos+3);
+    char cmd = api.val(API_CY)[0];
     if (cmd == '2') presetCyclingEnabled = !presetCyclingEnabled;
     else presetCyclingEnabled = (cmd != '0');
     presetCycCurr = presetCycleMin;
   }
 
-  pos = req.indexOf(F("PT=")); //sets cycle time in ms
-  if (pos > 0) {
-    int v = getNumVal(&req, pos);
+  //sets cycle time in ms
+  if (api.has(API_PT)) {
+    int v = getNumVal(api, API_PT);
     if (v > 100) presetCycleTime = v/100;
   }
 
-  pos = req.indexOf(F("PS=")); //saves current in preset
-  if (pos > 0) savePreset(getNumVal(&req, pos));
+  //saves current in preset
+  if (api.has(API_PS)) savePreset(getNumVal(api, API_PS));
 
   //apply preset
-  if (updateVal(&req, "PL=", &presetCycCurr, presetCycleMin, presetCycleMax)) {
+  if (updateVal(api, API_PL, &presetCycCurr, presetCycleMin, presetCycleMax)) {
     applyPreset(presetCycCurr);
   }
 
   //set brightness
-  updateVal(&req, "&A=", &bri);
+  updateVal(api, API_A, &bri);
 
   //set colors
-  updateVal(&req, "&R=", &col[0]);
-  updateVal(&req, "&G=", &col[1]);
-  updateVal(&req, "&B=", &col[2]);
-  updateVal(&req, "&W=", &col[3]);
-  updateVal(&req, "R2=", &colSec[0]);
-  updateVal(&req, "G2=", &colSec[1]);
-  updateVal(&req, "B2=", &colSec[2]);
-  updateVal(&req, "W2=", &colSec[3]);
+  updateVal(api, API_R, &col[0]);
+  updateVal(api, API_G, &col[1]);
+  updateVal(api, API_B, &col[2]);
+  updateVal(api, API_W, &col[3]);
+  updateVal(api, API_R2, &colSec[0]);
+  updateVal(api, API_G2, &colSec[1]);
+  updateVal(api, API_B2, &colSec[2]);
+  updateVal(api, API_W2, &colSec[3]);
 
   #ifdef WLED_ENABLE_LOXONE
   //lox parser
-  pos = req.indexOf(F("LX=")); // Lox primary color
-  if (pos > 0) {
-    int lxValue = getNumVal(&req, pos);
+  // Lox primary color
+  if (api.has(API_LX)) {
+    int lxValue = getNumVal(api, API_LX);
     if (parseLx(lxValue, col)) {
       bri = 255;
       nightlightActive = false; //always disable nightlight when toggling
     }
   }
-  pos = req.indexOf(F("LY=")); // Lox secondary color
-  if (pos > 0) {
-    int lxValue = getNumVal(&req, pos);
+  // Lox secondary color
+  if (api.has(API_LY)) {
+    int lxValue = getNumVal(api, API_LY);
     if(parseLx(lxValue, colSec)) {
       bri = 255;
       nightlightActive = false; //always disable nightlight when toggling
@@ -511,36 +512,30 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   #endif
 
   //set hue
-  pos = req.indexOf(F("HU="));
-  if (pos > 0) {
-    uint16_t temphue = getNumVal(&req, pos);
+  if (api.has(API_HU)) {
+    uint16_t temphue = getNumVal(api, API_HU);
     byte tempsat = 255;
-    pos = req.indexOf(F("SA="));
-    if (pos > 0) {
-      tempsat = getNumVal(&req, pos);
+    if (api.has(API_SA)) {
+      tempsat = getNumVal(api, API_SA);
     }
-    colorHStoRGB(temphue,tempsat,(req.indexOf(F("H2"))>0)? colSec:col);
+    colorHStoRGB(temphue,tempsat,api.has(API_H2)? colSec:col);
   }
 
   //set white spectrum (kelvin)
-  pos = req.indexOf(F("&K="));
-  if (pos > 0) {
-    colorKtoRGB(getNumVal(&req, pos),(req.indexOf(F("K2"))>0)? colSec:col);
+  if (api.has(API_K)) {
+    colorKtoRGB(getNumVal(api, API_K),api.has(API_K2)? colSec:col);
   }
 
   //set color from HEX or 32bit DEC
-  pos = req.indexOf(F("CL="));
-  if (pos > 0) {
-    colorFromDecOrHexString(col, (char*)req.substring(pos + 3).c_str());
+  if (api.has(API_CL)) {
+    colorFromDecOrHexString(col, (char*)api.val(API_CL));
   }
-  pos = req.indexOf(F("C2="));
-  if (pos > 0) {
-    colorFromDecOrHexString(colSec, (char*)req.substring(pos + 3).c_str());
+  if (api.has(API_C2)) {
+    colorFromDecOrHexString(colSec, (char*)api.val(API_C2));
   }
-  pos = req.indexOf(F("C3="));
-  if (pos > 0) {
+  if (api.has(API_C3)) {
     byte t[4];
-    colorFromDecOrHexString(t, (char*)req.substring(pos + 3).c_str());
+    colorFromDecOrHexString(t, (char*)api.val(API_C3));
     if (selectedSeg != strip.getMainSegmentId()) {
       strip.applyToAllSelected = true;
       strip.setColor(2, t[0], t[1], t[2], t[3]);
@@ -550,14 +545,12 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   }
 
   //set to random hue SR=0->1st SR=1->2nd
-  pos = req.indexOf(F("SR"));
-  if (pos > 0) {
-    _setRandomColor(getNumVal(&req, pos));
+  if (api.has(API_SR)) {
+    _setRandomColor(getNumVal(api, API_SR));
   }
 
   //swap 2nd & 1st
-  pos = req.indexOf(F("SC"));
-  if (pos > 0) {
+  if (api.has(API_SC)) {
     byte temp;
     for (uint8_t i=0; i<4; i++)
     {
@@ -568,40 +561,34 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   }
 
   //set effect parameters
-  if (updateVal(&req, "FX=", &effectCurrent, 0, strip.getModeCount()-1)) presetCyclingEnabled = false;
-  updateVal(&req, "SX=", &effectSpeed);
-  updateVal(&req, "IX=", &effectIntensity);
-  updateVal(&req, "FP=", &effectPalette, 0, strip.getPaletteCount()-1);
+  if (updateVal(api, API_FX, &effectCurrent, 0, strip.getModeCount()-1)) presetCyclingEnabled = false;
+  updateVal(api, API_SX, &effectSpeed);
+  updateVal(api, API_IX, &effectIntensity);
+  updateVal(api, API_FP, &effectPalette, 0, strip.getPaletteCount()-1);
 
   //set advanced overlay
-  pos = req.indexOf(F("OL="));
-  if (pos > 0) {
-    overlayCurrent = getNumVal(&req, pos);
+  if (api.has(API_OL)) {
+    overlayCurrent = getNumVal(api, API_OL);
   }
 
   //apply macro (deprecated, added for compatibility with pre-0.11 automations)
-  pos = req.indexOf(F("&M="));
-  if (pos > 0) {
-    applyPreset(getNumVal(&req, pos) + 16);
+  if (api.has(API_M)) {
+    applyPreset(getNumVal(api, API_M) + 16);
   }
 
   //toggle send UDP direct notifications
-  pos = req.indexOf(F("SN="));
-  if (pos > 0) notifyDirect = (req.charAt(pos+3) != '0');
+  if (api.has(API_SN)) notifyDirect = (api.val(API_SN)[0] != '0');
 
   //toggle receive UDP direct notifications
-  pos = req.indexOf(F("RN="));
-  if (pos > 0) receiveNotifications = (req.charAt(pos+3) != '0');
+  if (api.has(API_RN)) receiveNotifications = (api.val(API_RN)[0] != '0');
 
   //receive live data via UDP/Hyperion
-  pos = req.indexOf(F("RD="));
-  if (pos > 0) receiveDirect = (req.charAt(pos+3) != '0');
+  if (api.has(API_RD)) receiveDirect = (api.val(API_RD)[0] != '0');
 
   //main toggle on/off (parse before nightlight, #1214)
-  pos = req.indexOf(F("&T="));
-  if (pos > 0) {
+  if (api.has(API_T)) {
     nightlightActive = false; //always disable nightlight when toggling
-    switch (getNumVal(&req, pos))
+    switch (getNumVal(api, API_T))
     {
       case 0: if (bri != 0){briLast = bri; bri = 0;} break; //off, only if it was previously on
       case 1: if (bri == 0) bri = briLast; break; //on, only if it was previously off
@@ -611,16 +598,15 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
 
   //toggle nightlight mode
   bool aNlDef = false;
-  if (req.indexOf(F("&ND")) > 0) aNlDef = true;
-  pos = req.indexOf(F("NL="));
-  if (pos > 0)
+  if (api.has(API_ND)) aNlDef = true;
+  if (api.has(API_NL))
   {
-    if (req.charAt(pos+3) == '0')
+    if (api.val(API_NL)[0] == '0')
     {
       nightlightActive = false;
     } else {
       nightlightActive = true;
-      if (!aNlDef) nightlightDelayMins = getNumVal(&req, pos);
+      if (!aNlDef) nightlightDelayMins = getNumVal(api, API_NL);
       nightlightStartTime = millis();
     }
   } else if (aNlDef)
@@ -630,17 +616,15 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   }
 
   //set nightlight target brightness
-  pos = req.indexOf(F("NT="));
-  if (pos > 0) {
-    nightlightTargetBri = getNumVal(&req, pos);
+  if (api.has(API_NT)) {
+    nightlightTargetBri = getNumVal(api, API_NT);
     nightlightActiveOld = false; //re-init
   }
 
   //toggle nightlight fade
-  pos = req.indexOf(F("NF="));
-  if (pos > 0)
+  if (api.has(API_NF))
   {
-    nightlightMode = getNumVal(&req, pos);
+    nightlightMode = getNumVal(api, API_NF);
 
     nightlightActiveOld = false; //re-init
   }
@@ -648,29 +632,24 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
 
   #if AUXPIN >= 0
   //toggle general purpose output
-  pos = req.indexOf(F("AX="));
-  if (pos > 0) {
-    auxTime = getNumVal(&req, pos);
+  if (api.has(API_AX)) {
+    auxTime = getNumVal(api, API_AX);
     auxActive = true;
     if (auxTime == 0) auxActive = false;
   }
   #endif
 
-  pos = req.indexOf(F("TT="));
-  if (pos > 0) transitionDelay = getNumVal(&req, pos);
+  if (api.has(API_TT)) transitionDelay = getNumVal(api, API_TT);
 
   //Segment reverse
-  pos = req.indexOf(F("RV="));
-  if (pos > 0) strip.getSegment(selectedSeg).setOption(SEG_OPTION_REVERSED, req.charAt(pos+3) != '0');
+  if (api.has(API_RV)) strip.getSegment(selectedSeg).setOption(SEG_OPTION_REVERSED, api.val(API_RV)[0] != '0');
 
   //Segment reverse
-  pos = req.indexOf(F("MI="));
-  if (pos > 0) strip.getSegment(selectedSeg).setOption(SEG_OPTION_MIRROR, req.charAt(pos+3) != '0');
+  if (api.has(API_MI)) strip.getSegment(selectedSeg).setOption(SEG_OPTION_MIRROR, api.val(API_MI)[0] != '0');
 
   //Segment brightness/opacity
-  pos = req.indexOf(F("SB="));
-  if (pos > 0) {
-    byte segbri = getNumVal(&req, pos);
+  if (api.has(API_SB)) {
+    byte segbri = getNumVal(api, API_SB);
     strip.getSegment(selectedSeg).setOption(SEG_OPTION_ON, segbri, selectedSeg);
     if (segbri) {
       strip.getSegment(selectedSeg).setOpacity(segbri, selectedSeg);
@@ -678,55 +657,49 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   }
 
   //set time (unix timestamp)
-  pos = req.indexOf(F("ST="));
-  if (pos > 0) {
-    setTime(getNumVal(&req, pos));
+  if (api.has(API_ST)) {
+    setTime(getNumVal(api, API_ST));
   }
 
   //set countdown goal (unix timestamp)
-  pos = req.indexOf(F("CT="));
-  if (pos > 0) {
-    countdownTime = getNumVal(&req, pos);
+  if (api.has(API_CT)) {
+    countdownTime = getNumVal(api, API_CT);
     if (countdownTime - now() > 0) countdownOverTriggered = false;
   }
 
-  pos = req.indexOf(F("LO="));
-  if (pos > 0) {
-    realtimeOverride = getNumVal(&req, pos);
+  if (api.has(API_LO)) {
+    realtimeOverride = getNumVal(api, API_LO);
     if (realtimeOverride > 2) realtimeOverride = REALTIME_OVERRIDE_ALWAYS;
   }
 
-  pos = req.indexOf(F("RB"));
-  if (pos > 0) doReboot = true;
+  if (api.has(API_RB)) doReboot = true;
 
   //cronixie
   #ifndef WLED_DISABLE_CRONIXIE
   //mode, 1 countdown
-  pos = req.indexOf(F("NM="));
-  if (pos > 0) countdownMode = (req.charAt(pos+3) != '0');
+  if (api.has(API_NM)) countdownMode = (api.val(API_NM)[0] != '0');
   
-  pos = req.indexOf(F("NX=")); //sets digits to code
-  if (pos > 0) {
-    strlcpy(cronixieDisplay, req.substring(pos + 3, pos + 9).c_str(), 6);
+  //sets digits to code
+  if (api.has(API_NX)) {
+    strlcpy(cronixieDisplay, api.val(API_NX), 6);
     setCronixie();
   }
 
-  pos = req.indexOf(F("NB="));
-  if (pos > 0) //sets backlight
+  if (api.has(API_NB)) //sets backlight
   {
-    cronixieBacklight = (req.charAt(pos+3) != '0');
+    cronixieBacklight = (api.val(API_NB)[0] != '0');
     overlayRefreshedTime = 0;
   }
   #endif
 
-  pos = req.indexOf(F("U0=")); //user var 0
-  if (pos > 0) {
-    userVar0 = getNumVal(&req, pos);
+  //user var 0
+  if (api.has(API_U0)) {
+    userVar0 = getNumVal(api, API_U0);
   }
 
-  pos = req.indexOf(F("U1=")); //user var 1
-  if (pos > 0) {
-    userVar1 = getNumVal(&req, pos);
+  //user var 1
+  if (api.has(API_U1)) {
+    userVar1 = getNumVal(api, API_U1);
   }
   //you can add more if you need
 
@@ -763,13 +736,12 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply)
   if (!apply) return true; //when called by JSON API, do not call colorUpdated() here
   
   //internal call, does not send XML response
-  pos = req.indexOf(F("IN"));
-  if (pos < 1) XML_response(request);
+  if (!api.has(API_IN)) XML_response(request);
 
   strip.applyToAllSelected = false;
 
-  pos = req.indexOf(F("&NN")); //do not send UDP notifications this time
-  colorUpdated((pos > 0) ? NOTIFIER_CALL_MODE_NO_NOTIFY : NOTIFIER_CALL_MODE_DIRECT_CHANGE);
+  //do not send UDP notifications this time
+  colorUpdated(api.has(API_NN) ? NOTIFIER_CALL_MODE_NO_NOTIFY : NOTIFIER_CALL_MODE_DIRECT_CHANGE);
 
   return true;
 }
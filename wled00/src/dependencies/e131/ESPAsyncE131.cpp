@@ -41,6 +41,7 @@ ESPAsyncE131::ESPAsyncE131(e131_packet_callback_function callback) {
 bool ESPAsyncE131::begin(bool multicast, uint16_t port, uint16_t universe, uint8_t n) {
   bool success = false;
 
+  _multicast = multicast;
   if (multicast) {
 		success = initMulticast(port, universe, n);
 	} else {
@@ -50,6 +51,35 @@ bool ESPAsyncE131::begin(bool multicast, uint16_t port, uint16_t universe, uint8
   return success;
 }
 
+void ESPAsyncE131::setUniverses(uint16_t first, uint8_t n, uint16_t extra) {
+  _uniFirst = first;
+  _uniCount = n;
+  _uniExtra = extra;
+
+  if (!_multicast || first != _mcUniverse || n == _mcCount) return; //listening group only changes with begin()
+  if (n > _mcCount) joinGroups(_mcUniverse, _mcCount, n, true);
+  else              joinGroups(_mcUniverse, n, _mcCount, false);
+  _mcCount = n;
+}
+
+void ESPAsyncE131::joinGroups(uint16_t universe, uint8_t from, uint8_t to, bool join) {
+  ip4_addr_t ifaddr;
+  ip4_addr_t multicast_addr;
+
+  ifaddr.addr = static_cast<uint32_t>(Network.localIP());
+  for (uint8_t i = from; i < to; i++) {
+    if (i == 0) continue; //joined by listenMulticast()
+    multicast_addr.addr = static_cast<uint32_t>(IPAddress(239, 255,
+      (((universe + i) >> 8) & 0xff), (((universe + i) >> 0) & 0xff)));
+    if (join) igmp_joingroup(&ifaddr, &multicast_addr);
+    else      igmp_leavegroup(&ifaddr, &multicast_addr);
+  }
+}
+
+size_t ESPAsyncE131::sendTo(const uint8_t* data, size_t len, const IPAddress& ip, uint16_t port) {
+  return udp.writeTo(data, len, ip, port);
+}
+
 /////////////////////////////////////////////////////////
 //
 // Private init() members
@@ -73,16 +103,9 @@ bool ESPAsyncE131::initMulticast(uint16_t port, uint16_t universe, uint8_t n) {
     ((universe >> 0) & 0xff));
 
   if (udp.listenMulticast(address, port)) {
-    ip4_addr_t ifaddr;
-    ip4_addr_t multicast_addr;
-
-    ifaddr.addr = static_cast<uint32_t>(Network.localIP());
-    for (uint8_t i = 1; i < n; i++) {
-        multicast_addr.addr = static_cast<uint32_t>(IPAddress(239, 255,
-          (((universe + i) >> 8) & 0xff), (((universe + i) >> 0)
-          & 0xff)));
-      igmp_joingroup(&ifaddr, &multicast_addr);
-    }
+    joinGroups(universe, 1, n, true);
+    _mcUniverse = universe;
+    _mcCount = n;
 
     udp.onPacket(std::bind(&ESPAsyncE131::parsePacket, this, std::placeholders::_1));
 
@@ -110,8 +133,15 @@ void ESPAsyncE131::parsePacket(AsyncUDPPacket _packet) {
 	if (protocol == P_ARTNET) {
 		if (memcmp(sbuff->art_id, ESPAsyncE131::ART_ID, sizeof(sbuff->art_id)))
 			error = true; //not "Art-Net"
-		if (sbuff->art_opcode != ARTNET_OPCODE_OPDMX)
+		if (sbuff->art_opcode == ARTNET_OPCODE_OPSYNC)
+			protocol = P_ARTNET_SYNC;
+		else if (sbuff->art_opcode == ARTNET_OPCODE_OPPOLL)
+			protocol = P_ARTNET_POLL;
+		else if (sbuff->art_opcode != ARTNET_OPCODE_OPDMX)
 			error = true; //not a DMX packet
+	} else if (htonl(sbuff->root_vector) == ESPAsyncE131::VECTOR_ROOT_EXTENDED
+	        && htonl(sbuff->sync_vector) == ESPAsyncE131::VECTOR_FRAME_SYNC) {
+		protocol = P_E131_SYNC;
 	} else { //E1.31 error handling
 		if (htonl(sbuff->root_vector) != ESPAsyncE131::VECTOR_ROOT)
 			error = true;
@@ -126,6 +156,20 @@ void ESPAsyncE131::parsePacket(AsyncUDPPacket _packet) {
   if (error && _packet.localPort() == DDP_DEFAULT_PORT) { //DDP packet
     error = false;
     protocol = P_DDP;
+    //drop packets shorter than their header or announcing more data than they carry
+    size_t headerLen = DDP_HEADER_LEN;
+    if (_packet.length() >= DDP_HEADER_LEN && (sbuff->flags & DDP_TIMECODE_FLAG)) headerLen += 4;
+    if (_packet.length() < headerLen || htons(sbuff->dataLen) > _packet.length() - headerLen)
+      error = true;
+  }
+
+  // drop data for universes we don't handle before any further work
+  if (!error && _uniCount && (protocol == P_E131 || protocol == P_ARTNET)) {
+    uint16_t uni = (protocol == P_E131) ? htons(sbuff->universe) : sbuff->art_universe;
+    if ((uni < _uniFirst || uni >= _uniFirst + _uniCount) && (!_uniExtra || uni != _uniExtra)) {
+      _filtered++;
+      return;
+    }
   }
 
   if (!error) {
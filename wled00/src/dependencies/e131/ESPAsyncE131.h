@@ -50,14 +50,38 @@ typedef struct ip_addr ip4_addr_t;
 #define ARTNET_DEFAULT_PORT 6454
 #define DDP_DEFAULT_PORT    4048
 
+#define DDP_HEADER_LEN 10
+
 #define DDP_PUSH_FLAG 0x01
+#define DDP_QUERY_FLAG 0x02
+#define DDP_REPLY_FLAG 0x04
+#define DDP_STORAGE_FLAG 0x08
 #define DDP_TIMECODE_FLAG 0x10
-
-#define ARTNET_OPCODE_OPDMX 0x5000
-
-#define P_E131   0
-#define P_ARTNET 1
-#define P_DDP    2
+#define DDP_VERSION_1 0x40
+
+// DDP data type: bits 5-3 pixel type, bits 2-0 bits per element
+#define DDP_TYPE_RGB  1
+#define DDP_TYPE_RGBW 3
+#define DDP_SIZE_16BIT 4
+
+// DDP destination IDs
+#define DDP_ID_DISPLAY 1
+#define DDP_ID_CONFIG  250
+#define DDP_ID_STATUS  251
+#define DDP_ID_DMX     254
+#define DDP_ID_ALL     255
+
+#define ARTNET_OPCODE_OPDMX       0x5000
+#define ARTNET_OPCODE_OPSYNC      0x5200
+#define ARTNET_OPCODE_OPPOLL      0x2000
+#define ARTNET_OPCODE_OPPOLLREPLY 0x2100
+
+#define P_E131        0
+#define P_ARTNET      1
+#define P_DDP         2
+#define P_E131_SYNC   3 // E1.31 universe synchronization packet
+#define P_ARTNET_SYNC 4 // ArtSync packet
+#define P_ARTNET_POLL 5 // ArtPoll packet
 
 // E1.31 Packet Offsets
 #define E131_ROOT_PREAMBLE_SIZE 0
@@ -100,7 +124,7 @@ typedef union {
       uint32_t frame_vector;
       uint8_t  source_name[64];
       uint8_t  priority;
-      uint16_t reserved;
+      uint16_t synchronization_address; // reserved before E1.31-2016
       uint8_t  sequence_number;
       uint8_t  options;
       uint16_t universe;
@@ -115,6 +139,15 @@ typedef union {
       uint8_t  property_values[513];
     } __attribute__((packed));
 	
+    struct { //E1.31 synchronization packet, root layer same as above
+      uint8_t  sync_root_layer[38];
+      uint16_t sync_flength;
+      uint32_t sync_vector;
+      uint8_t  sync_sequence_number;
+      uint16_t sync_address;
+      uint16_t sync_reserved;
+    } __attribute__((packed));
+
 	struct { //Art-Net packet
     uint8_t  art_id[8];
     uint16_t art_opcode;
@@ -137,16 +170,16 @@ typedef union {
     uint8_t data[1];
   } __attribute__((packed));
 
-  /*struct { //DDP Time code Header (unsupported)
-    uint8_t flags;
-    uint8_t sequenceNum;
-    uint8_t dataType;
-    uint8_t destination;
-    uint32_t channelOffset;
-    uint16_t dataLen;
+  struct { //DDP Time code Header
+    uint8_t tcFlags;
+    uint8_t tcSequenceNum;
+    uint8_t tcDataType;
+    uint8_t tcDestination;
+    uint32_t tcChannelOffset;
+    uint16_t tcDataLen;
     uint32_t timeCode;
-    uint8_t data[1];
-  } __attribute__((packed));*/
+    uint8_t tcData[1];
+  } __attribute__((packed));
 
   uint8_t raw[1458];
 } e131_packet_t;
@@ -160,12 +193,26 @@ class ESPAsyncE131 {
     static const uint8_t ACN_ID[];
 	  static const uint8_t ART_ID[];
     static const uint32_t VECTOR_ROOT = 4;
+    static const uint32_t VECTOR_ROOT_EXTENDED = 8;
     static const uint32_t VECTOR_FRAME = 2;
+    static const uint32_t VECTOR_FRAME_SYNC = 1;
     static const uint8_t VECTOR_DMP = 2;
 
     e131_packet_t   *sbuff;     // Pointer to scratch packet buffer
     AsyncUDP        udp;        // AsyncUDP
 
+    // Universe filter, applied before the callback (0 universes = accept all)
+    uint16_t        _uniFirst = 0;
+    uint16_t        _uniCount = 0;
+    uint16_t        _uniExtra = 0;
+    uint32_t        _filtered = 0;
+
+    // Multicast groups joined in addition to the one listened on
+    bool            _multicast = false;
+    uint16_t        _mcUniverse = 0;
+    uint8_t         _mcCount = 0;
+    void joinGroups(uint16_t universe, uint8_t from, uint8_t to, bool join);
+
     // Internal Initializers
     bool initUnicast(uint16_t port);
     bool initMulticast(uint16_t port, uint16_t universe, uint8_t n = 1);
@@ -180,6 +227,16 @@ class ESPAsyncE131 {
 
     // Generic UDP listener, no physical or IP configuration
     bool begin(bool multicast, uint16_t port = E131_DEFAULT_PORT, uint16_t universe = 1, uint8_t n = 1);
+
+    // Only pass data for universes first to first+n-1 (and extra, if not 0) to the callback.
+    // In multicast mode, joins and leaves groups so exactly these universes are received
+    void setUniverses(uint16_t first, uint8_t n, uint16_t extra = 0);
+
+    // E1.31/Art-Net data packets rejected by the universe filter
+    uint32_t getFilteredCount() { return _filtered; }
+
+    // Send from the listening socket (DDP replies)
+    size_t sendTo(const uint8_t* data, size_t len, const IPAddress& ip, uint16_t port);
 };
 
 #endif  // ESPASYNCE131_H_
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "wled.h"
+
+/*
+ * Server-Sent Events (/events) pushing state changes to clients that only listen, e.g. dashboards and home automation.
+ * Each update is serialized once, section by section, so no document for the whole state is needed.
+ * AsyncEventSource has no shared message buffers like the WebSocket server, it copies the event into the queue of each client.
+ *
+ * Event "state": {"state":{...},"rev":n}, sent when a client connects and whenever a delta cannot express the change.
+ * Event "delta": {"rev":n,"base":m,"state":{changed fields}}, as the WebSocket delta messages.
+ * The event id is the state revision. A client whose last id is not the base of a delta missed an event
+ * (the server drops events for clients with a full queue) and should fetch /json/state.
+ */
+#ifdef WLED_ENABLE_SSE
+
+#define SSE_MIN_INTERVAL 250 //ms, state changes in between are coalesced into one event
+
+StateDeltaBase sseDeltaBase;  //fields of the last event sent
+bool sseDue = false;          //updateInterfaces() was called since the last event
+bool sseFullDue = false;      //a client connected and needs the full state
+uint32_t sseCheckedRevision = 0; //revision the state was last compared at
+unsigned long sseLastSent = 0;
+
+void sseConnected(AsyncEventSourceClient * client)
+{
+  sseFullDue = true;
+}
+
+void sendDataSse()
+{
+  sseDue = true;
+}
+
+void handleSse()
+{
+  if (!events.count()) {
+    sseDeltaBase.count = 0;
+    sseDue = false;
+    return;
+  }
+  if (!sseDue && !sseFullDue && stateRevision == sseCheckedRevision) return;
+  if (millis() - sseLastSent < SSE_MIN_INTERVAL) return;
+
+  //first pass hashes the sections and measures the full state
+  StateFieldHash hashes[STATE_DELTA_FIELDS];
+  byte n;
+  size_t len = serializeStateSections(nullptr, hashes, n, nullptr, 0);
+  bool changed = stateChanged(sseDeltaBase, hashes, n);
+  if (changed && stateRevision == sseDeltaBase.rev) stateRevision++; //changed without colorUpdated()
+  sseCheckedRevision = stateRevision;
+  sseDue = false;
+  if (!changed && !sseFullDue) return;
+
+  //a delta cannot express removed fields or segments
+  bool delta = !sseFullDue && n <= STATE_DELTA_FIELDS && n >= sseDeltaBase.count && sseDeltaBase.count;
+  const StateDeltaBase* base = delta ? &sseDeltaBase : nullptr;
+  if (delta) len = serializeStateSections(base, hashes, n, nullptr, 0);
+  len += 10; //room for the revision to gain digits
+  char* buf = (char*)malloc(len +1);
+  if (!buf) { sseDue = true; return; } //retried with the next loop
+  bool fits = serializeStateSections(base, hashes, n, buf, len +1) <= len;
+  if (!fits || (delta && n < sseDeltaBase.count)) { //state changed in between
+    free(buf);
+    sseDue = true;
+    return;
+  }
+
+  events.send(buf, delta ? "delta" : "state", stateRevision);
+  free(buf);
+
+  setStateDeltaBase(sseDeltaBase, hashes, n);
+  sseFullDue = false;
+  sseLastSent = millis();
+}
+
+#else
+void handleSse() {}
+void sendDataSse() {}
+#endif
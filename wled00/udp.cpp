@@ -1,4 +1,5 @@
 #include "wled.h"
+#include "bin_control.h"
 
 /*
  * UDP sync notifier / Realtime / Hyperion / TPM2.NET
@@ -7,6 +8,13 @@
 #define WLEDPACKETSIZE 29
 #define UDP_IN_MAXSIZE 1472
 
+#define UDP_PACKET_NONE    0
+#define UDP_PACKET_HANDLED 1
+#define UDP_PACKET_DROPPED 2
+
+#define UDP_DRAIN_MAX_PACKETS 32  //packets read per loop at most
+#define UDP_DRAIN_BUDGET_MS    8  //time per loop spent receiving before other tasks get a turn
+
 void notify(byte callMode, bool followUp)
 {
   if (!udpConnected) return;
@@ -100,6 +108,8 @@ void sendTPM2Ack() {
 }
 
 
+static byte handleUdpPacket();
+
 void handleNotifications()
 {
   //send second notification if enabled
@@ -107,6 +117,8 @@ void handleNotifications()
     notify(notificationSentCallMode,true);
   }
   
+  handleE131Frame();
+  handleRealtimeBuffer();
   if (e131NewData && millis() - strip.getLastShow() > 15)
   {
     e131NewData = false;
@@ -122,9 +134,30 @@ void handleNotifications()
     realtimeIP[0] = 0;
   }
 
-  //receive UDP notifications
-  if (!udpConnected) return;
-    
+  //receive UDP notifications, draining all pending packets within the time budget
+  unsigned long drainStart = millis();
+  for (uint8_t n = 0; udpConnected && n < UDP_DRAIN_MAX_PACKETS; n++)
+  {
+    byte result = handleUdpPacket();
+    if (result == UDP_PACKET_NONE) break;
+    udpPacketsReceived++;
+    if (result == UDP_PACKET_HANDLED) udpPacketsProcessed++;
+    else udpPacketsDropped++;
+    if (millis() - drainStart >= UDP_DRAIN_BUDGET_MS) break;
+  }
+
+  //realtime packets (UDP or WebSocket) of the same frame are coalesced into a single show()
+  if (realtimeShowPending)
+  {
+    realtimeShowPending = false;
+    strip.show();
+  }
+}
+
+
+//reads and applies one packet from the notifier, secondary notifier or raw RGB port
+static byte handleUdpPacket()
+{
   bool isSupp = false;
   uint16_t packetSize = notifierUdp.parsePacket();
   if (!packetSize && udp2Connected) {
@@ -136,31 +169,26 @@ void handleNotifications()
   if (!packetSize && udpRgbConnected) {
     packetSize = rgbUdp.parsePacket();
     if (packetSize) {
-      if (!receiveDirect) return;
-      if (packetSize > UDP_IN_MAXSIZE || packetSize < 3) return;
+      if (!receiveDirect) return UDP_PACKET_DROPPED;
+      if (packetSize > UDP_IN_MAXSIZE || packetSize < 3) return UDP_PACKET_DROPPED;
       realtimeIP = rgbUdp.remoteIP();
       DEBUG_PRINTLN(rgbUdp.remoteIP());
       uint8_t lbuf[packetSize];
       rgbUdp.read(lbuf, packetSize);
       realtimeLock(realtimeTimeoutMs, REALTIME_MODE_HYPERION);
-      if (realtimeOverride) return;
-      uint16_t id = 0;
-      for (uint16_t i = 0; i < packetSize -2; i += 3)
-      {
-        setRealtimePixel(id, lbuf[i], lbuf[i+1], lbuf[i+2], 0);
-        
-        id++; if (id >= ledCount) break;
-      }
-      strip.show();
-      return;
+      if (realtimeOverride) return UDP_PACKET_DROPPED;
+      setRealtimePixels(0, lbuf, packetSize / 3, 3);
+      realtimeShow();
+      return UDP_PACKET_HANDLED;
     } 
   }
 
-  if (!(receiveNotifications || receiveDirect)) return;
+  if (!packetSize) return UDP_PACKET_NONE;
+  if (!(receiveNotifications || receiveDirect)) return UDP_PACKET_DROPPED;
   
   //notifier and UDP realtime
-  if (!packetSize || packetSize > UDP_IN_MAXSIZE) return;
-  if (!isSupp && notifierUdp.remoteIP() == Network.localIP()) return; //don't process broadcasts we send ourselves
+  if (packetSize > UDP_IN_MAXSIZE) return UDP_PACKET_DROPPED;
+  if (!isSupp && notifierUdp.remoteIP() == Network.localIP()) return UDP_PACKET_DROPPED; //don't process broadcasts we send ourselves
 
   uint8_t udpIn[packetSize +1];
   if (isSupp) notifier2Udp.read(udpIn, packetSize);
@@ -170,8 +198,8 @@ void handleNotifications()
   if (udpIn[0] == 0 && !realtimeMode && receiveNotifications)
   {
     //ignore notification if received within a second after sending a notification ourselves
-    if (millis() - notificationSentTime < 1000) return;
-    if (udpIn[1] > 199) return; //do not receive custom versions
+    if (millis() - notificationSentTime < 1000) return UDP_PACKET_DROPPED;
+    if (udpIn[1] > 199) return UDP_PACKET_DROPPED; //do not receive custom versions
     
     bool someSel = (receiveNotificationBrightness || receiveNotificationColor || receiveNotificationEffects);
     //apply colors from notification
@@ -223,10 +251,10 @@ void handleNotifications()
     
     if (receiveNotificationBrightness || !someSel) bri = udpIn[2];
     colorUpdated(NOTIFIER_CALL_MODE_NOTIFICATION);
-    return;
+    return UDP_PACKET_HANDLED;
   }
 
-  if (!receiveDirect) return;
+  if (!receiveDirect) return UDP_PACKET_DROPPED;
   
   //TPM2.NET
   if (udpIn[0] == 0x9c)
@@ -235,13 +263,14 @@ void handleNotifications()
     //if the number of LEDs in your installation doesn't allow that, please include padding bytes at the end of the last packet
     byte tpmType = udpIn[1];
     if (tpmType == 0xaa) { //TPM2.NET polling, expect answer
-      sendTPM2Ack(); return;
+      sendTPM2Ack(); return UDP_PACKET_HANDLED;
     }
-    if (tpmType != 0xda) return; //return if notTPM2.NET data
+    if (tpmType != 0xda) return UDP_PACKET_DROPPED; //return if notTPM2.NET data
+    if (packetSize < 7) return UDP_PACKET_DROPPED; //6 byte header and end byte
 
     realtimeIP = (isSupp) ? notifier2Udp.remoteIP() : notifierUdp.remoteIP();
     realtimeLock(realtimeTimeoutMs, REALTIME_MODE_TPM2NET);
-    if (realtimeOverride) return;
+    if (realtimeOverride) return UDP_PACKET_DROPPED;
 
     tpmPacketCount++; //increment the packet count
     if (tpmPacketCount == 1) tpmPayloadFrameSize = (udpIn[2] << 8) + udpIn[3]; //save frame size for the whole payload if this is the first packet
@@ -249,21 +278,18 @@ void handleNotifications()
     byte numPackets = udpIn[5];
 
     uint16_t id = (tpmPayloadFrameSize/3)*(packetNum-1); //start LED
-    for (uint16_t i = 6; i < tpmPayloadFrameSize + 4; i += 3)
-    {
-      if (id < ledCount)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-        id++;
-      }
-      else break;
+    if (id < ledCount) {
+      uint16_t count = tpmPayloadFrameSize / 3;
+      if (count > (packetSize - 7) / 3) count = (packetSize - 7) / 3; //never read past the received payload
+      if (count > ledCount - id) count = ledCount - id;
+      setRealtimePixels(id, udpIn + 6, count, 3);
     }
     if (tpmPacketCount == numPackets) //reset packet count and show if all packets were received
     {
       tpmPacketCount = 0;
-      strip.show();
+      realtimeShow();
     }
-    return;
+    return UDP_PACKET_HANDLED;
   }
 
   //UDP realtime: 1 warls 2 drgb 3 drgbw
@@ -271,17 +297,18 @@ void handleNotifications()
   {
     realtimeIP = (isSupp) ? notifier2Udp.remoteIP() : notifierUdp.remoteIP();
     DEBUG_PRINTLN(realtimeIP);
-    if (packetSize < 2) return;
+    if (packetSize < 2) return UDP_PACKET_DROPPED;
 
     if (udpIn[1] == 0)
     {
       realtimeTimeout = 0;
-      return;
+      return UDP_PACKET_HANDLED;
     } else {
       realtimeLock(udpIn[1]*1000 +1, REALTIME_MODE_UDP);
     }
-    if (realtimeOverride) return;
+    if (realtimeOverride) return UDP_PACKET_DROPPED;
 
+    bool frameEnd = true;
     if (udpIn[0] == 1) //warls
     {
       for (uint16_t i = 2; i < packetSize -3; i += 4)
@@ -290,34 +317,40 @@ void handleNotifications()
       }
     } else if (udpIn[0] == 2) //drgb
     {
-      uint16_t id = 0;
-      for (uint16_t i = 2; i < packetSize -2; i += 3)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-
-        id++; if (id >= ledCount) break;
-      }
+      uint16_t count = (packetSize - 2) / 3;
+      if (count > ledCount) count = ledCount;
+      setRealtimePixels(0, udpIn + 2, count, 3);
     } else if (udpIn[0] == 3) //drgbw
     {
-      uint16_t id = 0;
-      for (uint16_t i = 2; i < packetSize -3; i += 4)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], udpIn[i+3]);
-        
-        id++; if (id >= ledCount) break;
-      }
-    } else if (udpIn[0] == 4) //dnrgb
+      uint16_t count = (packetSize - 2) / 4;
+      if (count > ledCount) count = ledCount;
+      setRealtimePixels(0, udpIn + 2, count, 4);
+    } else if (udpIn[0] == 4 && packetSize > 4) //dnrgb
     {
       uint16_t id = ((udpIn[3] << 0) & 0xFF) + ((udpIn[2] << 8) & 0xFF00);
-      for (uint16_t i = 4; i < packetSize -2; i += 3)
-      {
-          if (id >= ledCount) break;
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-        id++;
+      uint16_t count = (packetSize - 4) / 3;
+      if (id < ledCount) {
+        if (count > ledCount - id) count = ledCount - id;
+        setRealtimePixels(id, udpIn + 4, count, 3);
+        //a buffered frame spanning several packets is only queued once its last LED arrived
+        if (realtimeBufferActive() && id + count < ledCount) frameEnd = false;
       }
     }
-    strip.show();
-    return;
+    if (frameEnd) realtimeShow();
+    return UDP_PACKET_HANDLED;
+  }
+
+  //compact binary control
+  if (udpIn[0] == BIN_CONTROL_TYPE) {
+    uint8_t ack[sizeof(BinControlAck)];
+    size_t ackLen = handleBinaryControl(udpIn, packetSize, ack);
+    if (ackLen) {
+      WiFiUDP& u = isSupp ? notifier2Udp : notifierUdp;
+      u.beginPacket(u.remoteIP(), u.remotePort());
+      u.write(ack, ackLen);
+      u.endPacket();
+    }
+    return UDP_PACKET_HANDLED;
   }
 
   // API over UDP
@@ -328,20 +361,37 @@ void handleNotifications()
     apireq += (char*)udpIn;
     handleSet(nullptr, apireq);
   } else if (udpIn[0] == '{') { //JSON API
-    DynamicJsonDocument jsonBuffer(2048);
-    DeserializationError error = deserializeJson(jsonBuffer, udpIn);
-    JsonObject root = jsonBuffer.as<JsonObject>();
-    if (!error && !root.isNull()) deserializeState(root);
+    JsonStateParser* parser = new JsonStateParser();
+    if (parser->feed(udpIn, packetSize) && parser->end()) deserializeState(parser->root(), parser);
+    delete parser;
+  } else {
+    return UDP_PACKET_DROPPED;
   }
+  return UDP_PACKET_HANDLED;
 }
 
 
+//analog PWM output applies color gamma itself at 16 bit (see WS2812FX::setRgbwPwm()), so its buffer keeps the raw data
+static bool realtimeGamma()
+{
+  #ifdef WLED_USE_ANALOG_LEDS
+  return false;
+  #else
+  return !arlsDisableGammaCorrection && strip.gammaCorrectCol;
+  #endif
+}
+
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
 {
   uint16_t pix = i + arlsOffset;
   if (pix < ledCount)
   {
-    if (!arlsDisableGammaCorrection && strip.gammaCorrectCol)
+    if (realtimeBufferActive())
+    {
+      bool gc = realtimeGamma();
+      if (gc) realtimeBufferPixel(pix, strip.gamma8(r), strip.gamma8(g), strip.gamma8(b), strip.gamma8(w));
+      else    realtimeBufferPixel(pix, r, g, b, w);
+    } else if (realtimeGamma())
     {
       strip.setPixelColor(pix, strip.gamma8(r), strip.gamma8(g), strip.gamma8(b), strip.gamma8(w));
     } else {
@@ -349,3 +399,20 @@ void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
     }
   }
 }
+
+//sets count consecutive pixels from packed RGB (stride 3) or RGBW (stride 4) data
+void setRealtimePixels(uint16_t start, const byte* data, uint16_t count, byte stride)
+{
+  int32_t pix = (int32_t)start + arlsOffset;
+  if (pix < 0) { //negative offset, drop the pixels that fall off the start
+    if (-pix >= count) return;
+    data += -pix * stride;
+    count += pix;
+    pix = 0;
+  }
+  if (pix >= ledCount) return;
+  if (pix + count > ledCount) count = ledCount - pix;
+  bool gc = realtimeGamma();
+  if (realtimeBufferActive()) realtimeBufferPixels(pix, data, count, stride, gc);
+  else strip.setRealtimePixels(pix, data, count, stride, gc);
+}
@@ -7,6 +7,7 @@
 void UsermodManager::loop()      { for (byte i = 0; i < numMods; i++) ums[i]->loop();  }
 
 void UsermodManager::setup()     { for (byte i = 0; i < numMods; i++) ums[i]->setup(); }
+void UsermodManager::addEffects() { for (byte i = 0; i < numMods; i++) ums[i]->addEffects(); }
 void UsermodManager::connected() { for (byte i = 0; i < numMods; i++) ums[i]->connected(); }
 
 void UsermodManager::addToJsonState(JsonObject& obj)    { for (byte i = 0; i < numMods; i++) ums[i]->addToJsonState(obj); }
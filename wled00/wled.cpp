@@ -170,7 +170,7 @@ void WLED::loop()
   handleOverlays();
   yield();
 #ifdef WLED_USE_ANALOG_LEDS
-  strip.setRgbwPwm();
+  strip.setRgbwPwm(strip.gammaCorrectCol && !(realtimeMode && arlsDisableGammaCorrection));
 #endif
 
   if (doReboot)
@@ -219,6 +219,7 @@ void WLED::loop()
   }
   yield();
   handleWs();
+  handleSse();
   handleStatusLED();
 
 // DEBUG serial logging
@@ -247,7 +248,7 @@ void WLED::loop()
 
 void WLED::setup()
 {
-  Serial.begin(115200);
+  beginSerial();
   Serial.setTimeout(50);
   DEBUG_PRINTLN();
   DEBUG_PRINT("---WLED ");
@@ -266,6 +267,7 @@ void WLED::setup()
   DEBUG_PRINT("heap ");
   DEBUG_PRINTLN(ESP.getFreeHeap());
   registerUsermods();
+  usermods.addEffects();
 
   //strip.init(EEPROM.read(372), ledCount, EEPROM.read(2204));        // init LEDs quickly
   //strip.setBrightness(0);
@@ -287,6 +289,10 @@ void WLED::setup()
   } else deEEP();
   updateFSInfo();
   deserializeConfig();
+  if (serialBaud != 115200) {
+    Serial.flush();
+    Serial.updateBaudRate(serialBaud);
+  }
 
 #if STATUSLED && STATUSLED != LEDPIN
   pinMode(STATUSLED, OUTPUT);
@@ -421,7 +427,8 @@ void WLED::initAP(bool resetAP)
     if (udpPort2 > 0 && udpPort2 != ntpLocalPort && udpPort2 != udpPort && udpPort2 != udpRgbPort) {
       udp2Connected = notifier2Udp.begin(udpPort2);
     }
-    e131.begin(false, e131Port, e131Universe, E131_MAX_UNIVERSE_COUNT);
+    initE131Universes();
+    e131.begin(false, e131Port, e131Universe, e131UniverseCount);
   
     dnsServer.setErrorReplyCode(DNSReplyCode::NoError);
     dnsServer.start(53, "*", WiFi.softAPIP());
@@ -548,7 +555,8 @@ void WLED::initInterfaces()
     ntpConnected = ntpUdp.begin(ntpLocalPort);
 
   initBlynk(blynkApiKey, blynkHost, blynkPort);
-  e131.begin(e131Multicast, e131Port, e131Universe, E131_MAX_UNIVERSE_COUNT);
+  initE131Universes();
+  e131.begin(e131Multicast, e131Port, e131Universe, e131UniverseCount);
   reconnectHue();
   initMqtt();
   interfacesInited = true;
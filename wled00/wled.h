@@ -38,6 +38,9 @@
 #ifndef WLED_DISABLE_WEBSOCKETS
   #define WLED_ENABLE_WEBSOCKETS
 #endif
+#ifndef WLED_DISABLE_SSE
+  #define WLED_ENABLE_SSE          // state change events on /events
+#endif
 
 #define WLED_ENABLE_FS_EDITOR      // enable /edit page for editing FS content. Will also be disabled with OTA lock
 
@@ -261,6 +264,9 @@ WLED_GLOBAL int arlsOffset _INIT(0);                              // realtime LE
 WLED_GLOBAL bool receiveDirect _INIT(true);                       // receive UDP realtime
 WLED_GLOBAL bool arlsDisableGammaCorrection _INIT(true);          // activate if gamma correction is handled by the source
 WLED_GLOBAL bool arlsForceMaxBri _INIT(false);                    // enable to force max brightness if source has very dark colors that would be black
+WLED_GLOBAL uint32_t serialBaud _INIT(115200);                    // Adalight/TPM2 serial baud rate, up to 3 Mbaud
+WLED_GLOBAL byte realtimeBufferFrames _INIT(0);                   // UDP realtime frames held back to smooth out network jitter (0 = off, 2-4)
+WLED_GLOBAL bool realtimeInterpolate _INIT(false);                // blend between UDP realtime frames at the strip frame rate
 
 #ifdef WLED_ENABLE_DMX
 WLED_GLOBAL DMXESPSerial dmx;
@@ -271,7 +277,13 @@ WLED_GLOBAL uint16_t e131Port _INIT(5568);                        // DMX in port
 WLED_GLOBAL byte DMXMode _INIT(DMX_MODE_MULTIPLE_RGB);            // DMX mode (s.a.)
 WLED_GLOBAL uint16_t DMXAddress _INIT(1);                         // DMX start address of fixture, a.k.a. first Channel [for E1.31 (sACN) protocol]
 WLED_GLOBAL byte DMXOldDimmer _INIT(0);                           // only update brightness on change
-WLED_GLOBAL byte e131LastSequenceNumber[E131_MAX_UNIVERSE_COUNT]; // to detect packet loss
+WLED_GLOBAL E131UniverseStats* e131UniverseStats _INIT(nullptr);  // per universe sequence and statistics, sized from LED count and DMX mode
+WLED_GLOBAL byte e131UniverseCount _INIT(0);                      // number of universes in e131UniverseStats
+WLED_GLOBAL byte ddpLastSequenceNumber _INIT(0);                  // to reject late DDP packets
+WLED_GLOBAL byte ddpPacketsPerPush _INIT(0);                      // packets that made up the last DDP frame
+WLED_GLOBAL byte ddpPacketsSincePush _INIT(0);
+WLED_GLOBAL unsigned long ddpShowAt _INIT(0);                     // millis() when the staged DDP frame is due (0 = show right away), guarded by e131Lock
+WLED_GLOBAL bool ddpTimecoded _INIT(false);                       // the DDP stream carries timecodes, its frames are queued in the realtime ring
 WLED_GLOBAL bool e131Multicast _INIT(false);                      // multicast or unicast
 WLED_GLOBAL bool e131SkipOutOfSequence _INIT(false);              // freeze instead of flickering
 
@@ -459,6 +471,7 @@ WLED_GLOBAL uint16_t tpmPayloadFrameSize _INIT(0);
 // mqtt
 WLED_GLOBAL long lastMqttReconnectAttempt _INIT(0);
 WLED_GLOBAL long lastInterfaceUpdate _INIT(0);
+WLED_GLOBAL uint32_t stateRevision _INIT(0);                      // incremented on each state change, sent with WebSocket state messages
 WLED_GLOBAL byte interfaceUpdateCallMode _INIT(NOTIFIER_CALL_MODE_INIT);
 WLED_GLOBAL char mqttStatusTopic[40] _INIT("");        // this must be global because of async handlers
 
@@ -484,6 +497,8 @@ WLED_GLOBAL bool ntpConnected _INIT(false);
 WLED_GLOBAL time_t localTime _INIT(0);
 WLED_GLOBAL unsigned long ntpLastSyncTime _INIT(999000000L);
 WLED_GLOBAL unsigned long ntpPacketSentTime _INIT(999000000L);
+WLED_GLOBAL unsigned long ntpSyncMillis _INIT(0);      // millis() at the last NTP response (0 = never synced)
+WLED_GLOBAL uint32_t ntpSyncTimecode _INIT(0);         // NTP time of the last response, 16 bit seconds and 16 bit fraction
 WLED_GLOBAL IPAddress ntpServerIP;
 WLED_GLOBAL uint16_t ntpLocalPort _INIT(2390);
 WLED_GLOBAL uint16_t rolloverMillis _INIT(0);
@@ -517,6 +532,9 @@ WLED_GLOBAL AsyncWebServer server _INIT_N(((80)));
 #ifdef WLED_ENABLE_WEBSOCKETS
 WLED_GLOBAL AsyncWebSocket ws _INIT_N((("/ws")));
 #endif
+#ifdef WLED_ENABLE_SSE
+WLED_GLOBAL AsyncEventSource events _INIT_N((("/events")));
+#endif
 WLED_GLOBAL AsyncClient* hueClient _INIT(NULL);
 WLED_GLOBAL AsyncMqttClient* mqtt _INIT(NULL);
 
@@ -526,6 +544,50 @@ WLED_GLOBAL WiFiUDP ntpUdp;
 WLED_GLOBAL ESPAsyncE131 e131 _INIT_N(((handleE131Packet)));
 WLED_GLOBAL bool e131NewData _INIT(false);
 
+// E1.31/Art-Net frame assembly
+WLED_GLOBAL byte e131FrameNumber _INIT(1);                        // universes tagged with this number belong to the frame being assembled
+WLED_GLOBAL byte e131FrameUniverses _INIT(0);                     // number of universes received for the frame being assembled
+WLED_GLOBAL unsigned long e131FrameStart _INIT(0);                // arrival of the first universe of the frame
+WLED_GLOBAL byte* e131Staging _INIT(nullptr);                     // two frames of pixels: the one being assembled and the last complete one
+WLED_GLOBAL uint16_t e131StagingLeds _INIT(0);                    // LEDs per staging slot
+WLED_GLOBAL byte e131StagingBpp _INIT(0);                         // bytes per LED in the staging slots (3 or 4, 0 if not staging)
+WLED_GLOBAL byte e131AssembleSlot _INIT(0);                       // staging slot universes are written to
+WLED_GLOBAL bool e131FrameReady _INIT(false);                     // the other slot holds a complete frame not yet copied to the strip
+WLED_GLOBAL uint16_t e131SyncAddress _INIT(0);                    // E1.31 synchronization universe announced by the source
+WLED_GLOBAL unsigned long e131SyncLastSeen _INIT(0);              // last time the source used E1.31 sync or ArtSync
+WLED_GLOBAL uint32_t e131FramesComplete _INIT(0);                 // frames shown with all universes
+WLED_GLOBAL uint32_t e131FramesPartial _INIT(0);                  // frames shown with missing universes (timeout or early sync)
+WLED_GLOBAL uint32_t e131FramesDropped _INIT(0);                  // frames overwritten before they could be shown
+WLED_GLOBAL uint16_t artPollReplyCount _INIT(0);                  // node report counter
+
+// UDP receive statistics
+WLED_GLOBAL uint32_t udpPacketsReceived _INIT(0);
+WLED_GLOBAL uint32_t udpPacketsProcessed _INIT(0);
+WLED_GLOBAL uint32_t udpPacketsDropped _INIT(0);                  // disabled, malformed, own broadcast or realtime override
+WLED_GLOBAL bool realtimeShowPending _INIT(false);                // realtime frame waiting to be shown after the receive loop
+
+// web server admission control
+WLED_GLOBAL byte webHeavyActive _INIT(0);                          // requests currently holding a JSON document or parser
+WLED_GLOBAL uint32_t webRequestsRejected _INIT(0);                // answered with 503 because of the limit or low heap
+
+// UDP realtime jitter buffer
+WLED_GLOBAL byte* rtBufSlots _INIT(nullptr);                      // ring of frames, RGBW per LED
+WLED_GLOBAL byte rtBufAllocated _INIT(0);                         // number of slots in the ring
+WLED_GLOBAL bool rtBufInterpolate _INIT(false);                   // slots were laid out for interpolation
+WLED_GLOBAL uint16_t rtBufLeds _INIT(0);                          // LEDs per slot
+WLED_GLOBAL byte rtBufHead _INIT(0);                              // oldest queued frame
+WLED_GLOBAL byte rtBufQueued _INIT(0);                            // frames waiting to be shown
+WLED_GLOBAL byte rtBufLast _INIT(0);                              // most recently received frame
+WLED_GLOBAL bool rtBufWriting _INIT(false);                       // a frame is being received
+WLED_GLOBAL bool rtBufPrefill _INIT(true);                        // waiting for the queue to fill before presenting
+WLED_GLOBAL unsigned long rtBufLastArrival _INIT(0);
+WLED_GLOBAL unsigned long rtBufNextShow _INIT(0);
+WLED_GLOBAL uint16_t rtBufInterval _INIT(0);                      // averaged frame period in ms
+WLED_GLOBAL uint16_t rtBufSegment _INIT(0);                       // duration of the current interpolation step
+WLED_GLOBAL uint32_t rtBufUnderruns _INIT(0);                     // frame due but queue empty
+WLED_GLOBAL uint32_t rtBufOverruns _INIT(0);                      // queue full, oldest frame dropped (newest for timecoded frames)
+WLED_GLOBAL unsigned long rtBufDue[RTBUF_MAX_RING] _INIT_N(({0})); // millis() each queued timecoded frame is due
+
 // led fx library object
 WLED_GLOBAL WS2812FX strip _INIT(WS2812FX());
 
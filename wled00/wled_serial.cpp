@@ -1,103 +1,62 @@
 #include "wled.h"
+#include "wled_serial.h"
 
 /*
  * Adalight and TPM2 handler
  */
 
-enum class AdaState {
-  Header_A,
-  Header_d,
-  Header_a,
-  Header_CountHi,
-  Header_CountLo,
-  Header_CountCheck,
-  Data_Red,
-  Data_Green,
-  Data_Blue,
-  TPM2_Header_Type,
-  TPM2_Header_CountHi,
-  TPM2_Header_CountLo
+#ifdef WLED_ENABLE_ADALIGHT
+
+#define SERIAL_READ_CHUNK 256  //bytes moved from the UART ring buffer per read
+#define SERIAL_BUDGET_MS    8  //time per loop spent parsing before other tasks get a turn
+
+class RealtimeSerialSink : public SerialStreamSink {
+  public:
+    void pixels(uint16_t start, const uint8_t* rgb, uint16_t count)
+    {
+      if (!realtimeOverride) setRealtimePixels(start, rgb, count, 3);
+    }
+
+    void frame()
+    {
+      if (!realtimeMode && bri == 0) strip.setBrightness(briLast);
+      realtimeLock(realtimeTimeoutMs, REALTIME_MODE_ADALIGHT);
+
+      if (!realtimeOverride) strip.show();
+    }
+
+    void ping()
+    {
+      Serial.write(TPM2_ACK);
+    }
 };
 
+static RealtimeSerialSink serialSink;
+static SerialStreamParser serialParser(serialSink);
+
+#endif
+
+//applies the configured baud rate, the larger receive buffer must be set before the UART is started
+void beginSerial()
+{
+  #ifdef WLED_ENABLE_ADALIGHT
+  Serial.setRxBufferSize(WLED_SERIAL_RX_BUFFER_SIZE);
+  #endif
+  Serial.begin(serialBaud);
+}
+
 void handleSerial()
 {
   #ifdef WLED_ENABLE_ADALIGHT
-  static auto state = AdaState::Header_A;
-  static uint16_t count = 0;
-  static uint16_t pixel = 0;
-  static byte check = 0x00;
-  static byte red   = 0x00;
-  static byte green = 0x00;
-  
-  while (Serial.available() > 0)
-  {
-    yield();
-    byte next = Serial.read();
-    switch (state) {
-      case AdaState::Header_A:
-        if (next == 'A') state = AdaState::Header_d;
-        else if (next == 0xC9) { //TPM2 start byte
-          state = AdaState::TPM2_Header_Type;
-        }
-        break;
-      case AdaState::Header_d:
-        if (next == 'd') state = AdaState::Header_a;
-        else             state = AdaState::Header_A;
-        break;
-      case AdaState::Header_a:
-        if (next == 'a') state = AdaState::Header_CountHi;
-        else             state = AdaState::Header_A;
-        break;
-      case AdaState::Header_CountHi:
-        pixel = 0;
-        count = next * 0x100;
-        check = next;
-        state = AdaState::Header_CountLo;
-        break;
-      case AdaState::Header_CountLo:
-        count += next + 1;
-        check = check ^ next ^ 0x55;
-        state = AdaState::Header_CountCheck;
-        break;
-      case AdaState::Header_CountCheck:
-        if (check == next) state = AdaState::Data_Red;
-        else               state = AdaState::Header_A;
-        break;
-      case AdaState::TPM2_Header_Type:
-        state = AdaState::Header_A; //(unsupported) TPM2 command or invalid type
-        if (next == 0xDA) state = AdaState::TPM2_Header_CountHi; //TPM2 data
-        else if (next == 0xAA) Serial.write(0xAC); //TPM2 ping
-        break;
-      case AdaState::TPM2_Header_CountHi:
-        pixel = 0;
-        count = (next * 0x100) /3;
-        state = AdaState::TPM2_Header_CountLo;
-        break;
-      case AdaState::TPM2_Header_CountLo:
-        count += next /3;
-        state = AdaState::Data_Red;
-        break;
-      case AdaState::Data_Red:
-        red   = next;
-        state = AdaState::Data_Green;
-        break;
-      case AdaState::Data_Green:
-        green = next;
-        state = AdaState::Data_Blue;
-        break;
-      case AdaState::Data_Blue:
-        byte blue  = next;
-        if (!realtimeOverride) setRealtimePixel(pixel++, red, green, blue, 0);
-        if (--count > 0) state = AdaState::Data_Red;
-        else {
-          if (!realtimeMode && bri == 0) strip.setBrightness(briLast);
-          realtimeLock(realtimeTimeoutMs, REALTIME_MODE_ADALIGHT);
+  byte buf[SERIAL_READ_CHUNK];
+  unsigned long start = millis();
 
-          if (!realtimeOverride) strip.show();
-          state = AdaState::Header_A;
-        }
-        break;
-    }
+  int available;
+  while ((available = Serial.available()) > 0)
+  {
+    size_t len = Serial.readBytes(buf, (available < SERIAL_READ_CHUNK) ? available : SERIAL_READ_CHUNK);
+    serialParser.feed(buf, len);
+    if (millis() - start >= SERIAL_BUDGET_MS) break;
   }
   #endif
 }
@@ -0,0 +1,171 @@
+#ifndef WLED_SERIAL_H
+#define WLED_SERIAL_H
+
+/*
+ * Adalight and TPM2 stream parser.
+ * Independent of Arduino, so it can be compiled on a host and fed recorded captures.
+ * Received bytes are passed in chunks, complete pixel runs are handed to the sink
+ * without copying, only pixels split across two chunks go through a 3 byte carry.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define TPM2_START       0xC9
+#define TPM2_END         0x36
+#define TPM2_TYPE_DATA   0xDA
+#define TPM2_TYPE_CMD    0xC0
+#define TPM2_TYPE_PING   0xAA
+#define TPM2_ACK         0xAC
+
+class SerialStreamSink {
+  public:
+    virtual void pixels(uint16_t start, const uint8_t* rgb, uint16_t count) = 0; //packed RGB
+    virtual void frame() = 0;  //all pixels of a frame received
+    virtual void ping() = 0;   //TPM2 request for an acknowledgement
+};
+
+class SerialStreamParser {
+  public:
+    enum class State : uint8_t {
+      Header_A,
+      Header_d,
+      Header_a,
+      Header_CountHi,
+      Header_CountLo,
+      Header_CountCheck,
+      Data,
+      TPM2_Header_Type,
+      TPM2_Header_SizeHi,
+      TPM2_Header_SizeLo,
+      TPM2_Skip,
+      TPM2_End
+    };
+
+    SerialStreamParser(SerialStreamSink& sink) : _sink(sink) {}
+
+    void reset()
+    {
+      _state = State::Header_A;
+      _carryLen = 0;
+    }
+
+    State getState() { return _state; }
+
+    void feed(const uint8_t* buf, size_t len)
+    {
+      size_t i = 0;
+      while (i < len) {
+        if (_state == State::Data) { //pixel payload, consumed in runs
+          size_t run = len - i;
+          if (run > _remaining) run = _remaining;
+          if (_carryLen || run < 3) {
+            _carry[_carryLen++] = buf[i++]; _remaining--;
+            if (_carryLen == 3) {
+              _sink.pixels(_pixel++, _carry, 1);
+              _carryLen = 0;
+            }
+          } else {
+            uint16_t n = run / 3;
+            _sink.pixels(_pixel, buf + i, n);
+            _pixel += n; i += n * 3; _remaining -= n * 3;
+          }
+          if (!_remaining) endData();
+          continue;
+        }
+        if (_state == State::TPM2_Skip) { //command payload, not supported
+          size_t run = len - i;
+          if (run > _remaining) run = _remaining;
+          i += run; _remaining -= run;
+          if (!_remaining) _state = State::TPM2_End;
+          continue;
+        }
+        parseHeader(buf[i++]);
+      }
+    }
+
+  private:
+    SerialStreamSink& _sink;
+    State _state = State::Header_A;
+    bool _tpm2 = false;
+    bool _tpm2Data = false;
+    uint16_t _pixel = 0;
+    uint32_t _remaining = 0; //payload bytes left
+    uint8_t _check = 0;
+    uint8_t _carry[3];
+    uint8_t _carryLen = 0;
+
+    void startData(uint32_t bytes)
+    {
+      _pixel = 0;
+      _carryLen = 0;
+      _remaining = bytes;
+      _state = State::Data;
+      if (!bytes) endData();
+    }
+
+    //a trailing partial pixel (TPM2 size not a multiple of 3) is discarded
+    void endData()
+    {
+      _carryLen = 0;
+      if (_tpm2) { _state = State::TPM2_End; return; }
+      _sink.frame();
+      _state = State::Header_A;
+    }
+
+    void parseHeader(uint8_t next)
+    {
+      switch (_state) {
+        case State::Header_A:
+          if (next == 'A') _state = State::Header_d;
+          else if (next == TPM2_START) _state = State::TPM2_Header_Type;
+          break;
+        case State::Header_d:
+          _state = (next == 'd') ? State::Header_a : State::Header_A;
+          break;
+        case State::Header_a:
+          _state = (next == 'a') ? State::Header_CountHi : State::Header_A;
+          break;
+        case State::Header_CountHi:
+          _remaining = next << 8;
+          _check = next;
+          _state = State::Header_CountLo;
+          break;
+        case State::Header_CountLo:
+          _remaining += next;
+          _check = _check ^ next ^ 0x55;
+          _state = State::Header_CountCheck;
+          break;
+        case State::Header_CountCheck:
+          _tpm2 = false;
+          if (_check == next) startData((_remaining + 1) * 3); //Adalight sends LED count - 1
+          else _state = State::Header_A;
+          break;
+        case State::TPM2_Header_Type:
+          _tpm2 = true;
+          _tpm2Data = (next == TPM2_TYPE_DATA);
+          if (next == TPM2_TYPE_DATA || next == TPM2_TYPE_CMD || next == TPM2_TYPE_PING) _state = State::TPM2_Header_SizeHi;
+          else _state = State::Header_A; //invalid type
+          if (next == TPM2_TYPE_PING) _sink.ping();
+          break;
+        case State::TPM2_Header_SizeHi:
+          _remaining = next << 8;
+          _state = State::TPM2_Header_SizeLo;
+          break;
+        case State::TPM2_Header_SizeLo:
+          _remaining += next;
+          if (_tpm2Data) startData(_remaining);
+          else if (_remaining) _state = State::TPM2_Skip;
+          else _state = State::TPM2_End;
+          break;
+        case State::TPM2_End:
+          if (next == TPM2_END && _tpm2Data) _sink.frame(); //a frame with a bad end byte is not shown
+          _state = State::Header_A;
+          break;
+        default:
+          _state = State::Header_A;
+      }
+    }
+};
+
+#endif
@@ -32,6 +32,33 @@ bool captivePortal(AsyncWebServerRequest *request)
   return false;
 }
 
+//admits a request that allocates a JSON document or parser, the slot is released when the connection closes
+//requests changing the state may take the last slot, so a busy UI polling /json can not lock them out
+bool admitHeavyRequest(AsyncWebServerRequest *request, bool write)
+{
+  byte limit = write ? WEB_MAX_HEAVY_REQUESTS : WEB_MAX_HEAVY_REQUESTS -1;
+  if (webHeavyActive >= limit || ESP.getFreeHeap() < WEB_HEAVY_MIN_HEAP) {
+    webRequestsRejected++;
+    return false;
+  }
+  webHeavyActive++;
+  request->onDisconnect([]() { webHeavyActive--; });
+  return true;
+}
+
+//the /json paths serveJson() builds a document for, effect and palette names and metadata are sent from flash
+static bool jsonNeedsDocument(const String& url)
+{
+  return url.length() <= 6 || url.indexOf("state") > 0 || url.indexOf("info") > 0 || url.indexOf("si") > 0 || url.indexOf("live") > 0;
+}
+
+void serveBusy(AsyncWebServerRequest *request)
+{
+  AsyncWebServerResponse *response = request->beginResponse(503, "application/json", F("{\"error\":10}"));
+  response->addHeader(F("Retry-After"), WEB_RETRY_AFTER);
+  request->send(response);
+}
+
 void initServer()
 {
   //CORS compatiblity
@@ -40,9 +67,14 @@ void initServer()
   DefaultHeaders::Instance().addHeader(F("Access-Control-Allow-Headers"), "*");
 
   server.on("/liveview", HTTP_GET, [](AsyncWebServerRequest *request){
-    request->send_P(200, "text/html", PAGE_liveview);
+    serveStaticPage(request, PAGE_liveview);
   });
   
+  //values for the static settings pages, before "/settings" which would handle it as a subpage
+  server.on("/settings/s.js", HTTP_GET, [](AsyncWebServerRequest *request){
+    serveSettingsJS(request);
+  });
+
   //settings page
   server.on("/settings", HTTP_GET, [](AsyncWebServerRequest *request){
     serveSettings(request);
@@ -51,7 +83,7 @@ void initServer()
   server.on("/favicon.ico", HTTP_GET, [](AsyncWebServerRequest *request){
     if(!handleFileRead(request, "/favicon.ico"))
     {
-      request->send_P(200, "image/x-icon", favicon, 156);
+      serveStaticAsset(request, "image/x-icon", favicon, 156);
     }
   });
   
@@ -73,28 +105,34 @@ void initServer()
   });
 
   server.on("/json", HTTP_GET, [](AsyncWebServerRequest *request){
+    if (jsonNeedsDocument(request->url()) && !admitHeavyRequest(request, false)) {
+      serveBusy(request); return;
+    }
     serveJson(request);
   });
 
-  AsyncCallbackJsonWebHandler* handler = new AsyncCallbackJsonWebHandler("/json", [](AsyncWebServerRequest *request) {
-    bool verboseResponse = false;
-    { //scope JsonDocument so it releases its buffer
-      DynamicJsonDocument jsonBuffer(JSON_BUFFER_SIZE);
-      DeserializationError error = deserializeJson(jsonBuffer, (uint8_t*)(request->_tempObject));
-      JsonObject root = jsonBuffer.as<JsonObject>();
-      if (error || root.isNull()) {
-        request->send(400, "application/json", F("{\"error\":9}")); return;
-      }
-      fileDoc = &jsonBuffer;
-      verboseResponse = deserializeState(root);
-      fileDoc = nullptr;
+  //the body is parsed while it arrives, the parser lives in the request's temp object (freed with the request)
+  server.on("/json", HTTP_POST, [](AsyncWebServerRequest *request) {
+    JsonStateParser* parser = (JsonStateParser*)(request->_tempObject);
+    if (!parser && request->contentLength()) { //not admitted
+      serveBusy(request); return;
+    }
+    if (!parser || !parser->end()) {
+      request->send(400, "application/json", F("{\"error\":9}")); return;
     }
+    bool verboseResponse = deserializeState(parser->root(), parser);
     if (verboseResponse) { //if JSON contains "v"
       serveJson(request); return; 
     } 
     request->send(200, "application/json", F("{\"success\":true}"));
+  }, nullptr, [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+    if (!index && !request->_tempObject && admitHeavyRequest(request, true)) {
+      void* mem = malloc(sizeof(JsonStateParser));
+      if (mem) request->_tempObject = new (mem) JsonStateParser();
+    }
+    JsonStateParser* parser = (JsonStateParser*)(request->_tempObject);
+    if (parser) parser->feed(data, len);
   });
-  server.addHandler(handler);
 
   server.on("/version", HTTP_GET, [](AsyncWebServerRequest *request){
     request->send(200, "text/plain", (String)VERSION);
@@ -109,7 +147,7 @@ void initServer()
     });
   
   server.on("/u", HTTP_GET, [](AsyncWebServerRequest *request){
-    request->send_P(200, "text/html", PAGE_usermod);
+    serveStaticPage(request, PAGE_usermod);
     });
     
   server.on("/url", HTTP_GET, [](AsyncWebServerRequest *request){
@@ -136,7 +174,7 @@ void initServer()
     //init ota page
     #ifndef WLED_DISABLE_OTA
     server.on("/update", HTTP_GET, [](AsyncWebServerRequest *request){
-      request->send_P(200, "text/html", PAGE_update);
+      serveStaticPage(request, PAGE_update);
     });
     
     server.on("/update", HTTP_POST, [](AsyncWebServerRequest *request){
@@ -197,6 +235,10 @@ void initServer()
   #ifdef WLED_ENABLE_WEBSOCKETS
   server.addHandler(&ws);
   #endif
+  #ifdef WLED_ENABLE_SSE
+  events.onConnect(sseConnected);
+  server.addHandler(&events);
+  #endif
   
   //called when the url is not defined here, ajax-in; get-settings
   server.onNotFound([](AsyncWebServerRequest *request){
@@ -229,36 +271,117 @@ void serveIndexOrWelcome(AsyncWebServerRequest *request)
   }
 }
 
-bool handleIfNoneMatchCacheHeader(AsyncWebServerRequest* request)
+//content hashes of the assets served from flash, computed once on their first request
+static struct {
+  const uint8_t* data;
+  uint32_t hash;
+} assetEtags[ASSET_ETAG_SLOTS];
+
+static uint32_t assetHash(const uint8_t* data, size_t len)
 {
-  AsyncWebHeader* header = request->getHeader("If-None-Match");
-  if (header && header->value() == String(VERSION)) {
-    request->send(304);
-    return true;
+  byte slot = 0;
+  for (; slot < ASSET_ETAG_SLOTS && assetEtags[slot].data; slot++) {
+    if (assetEtags[slot].data == data) return assetEtags[slot].hash;
   }
-  return false;
+  uint32_t hash = 2166136261UL; //FNV-1a
+  for (size_t i = 0; i < len; i++) {
+    hash ^= pgm_read_byte(data + i);
+    hash *= 16777619UL;
+  }
+  if (slot < ASSET_ETAG_SLOTS) {
+    assetEtags[slot].data = data;
+    assetEtags[slot].hash = hash;
+  }
+  return hash;
 }
 
-bool setStaticContentCacheHeaders(AsyncWebServerResponse *response)
+//the ETag changes with the content, so browsers can revalidate on every load and get a bodyless 304 until a firmware update
+//the URLs are not versioned, so the assets can not be marked immutable without serving stale pages after an update
+void setStaticContentCacheHeaders(AsyncWebServerResponse *response, const char* etag)
 {
-  response->addHeader(F("Cache-Control"),"max-age=2592000");
-  response->addHeader(F("ETag"), String(VERSION));
+  response->addHeader(F("Cache-Control"), F("no-cache"));
+  response->addHeader(F("ETag"), etag);
 }
 
-void serveIndex(AsyncWebServerRequest* request)
+//parses a single "bytes=first-last" range into [start, end), returns 1 if valid, -1 if not satisfiable and 0 to ignore it
+static int8_t parseRange(const String& value, size_t len, size_t* start, size_t* end)
 {
-  if (handleFileRead(request, "/index.htm")) return;
+  if (!value.startsWith(F("bytes=")) || value.indexOf(',') >= 0) return 0; //multiple ranges are served in full
+  const char* r = value.c_str() + 6;
+  const char* dash = strchr(r, '-');
+  if (!dash) return 0;
+
+  if (dash == r) { //last n bytes
+    unsigned long n = strtoul(dash +1, nullptr, 10);
+    if (!n) return -1;
+    *start = (n < len) ? len - n : 0;
+    *end = len;
+    return 1;
+  }
+  unsigned long first = strtoul(r, nullptr, 10);
+  unsigned long last = dash[1] ? strtoul(dash +1, nullptr, 10) : len -1;
+  if (first >= len) return -1;
+  if (last < first) return 0;
+  if (last >= len) last = len -1;
+  *start = first;
+  *end = last +1;
+  return 1;
+}
+
+void serveStaticAsset(AsyncWebServerRequest* request, const char* contentType, const uint8_t* data, size_t len, bool gzip)
+{
+  char etag[11];
+  sprintf_P(etag, PSTR("\"%08x\""), (unsigned)assetHash(data, len));
 
-  if (handleIfNoneMatchCacheHeader(request)) return;
+  AsyncWebHeader* header = request->getHeader("If-None-Match");
+  if (header && (header->value().indexOf(etag) >= 0 || header->value() == "*")) {
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    setStaticContentCacheHeaders(response, etag);
+    request->send(response);
+    return;
+  }
 
-  AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", PAGE_index, PAGE_index_L);
+  size_t start = 0, end = len;
+  int code = 200;
+  header = request->getHeader("Range");
+  AsyncWebHeader* ifRange = request->getHeader("If-Range");
+  if (header && (!ifRange || ifRange->value() == etag)) {
+    int8_t range = parseRange(header->value(), len, &start, &end);
+    if (range < 0) {
+      char cr[20];
+      sprintf_P(cr, PSTR("bytes */%u"), (unsigned)len);
+      AsyncWebServerResponse *response = request->beginResponse(416);
+      response->addHeader(F("Content-Range"), cr);
+      request->send(response);
+      return;
+    }
+    if (range > 0) code = 206;
+  }
 
-  response->addHeader(F("Content-Encoding"),"gzip");
-  setStaticContentCacheHeaders(response);
-  
+  AsyncWebServerResponse *response = request->beginResponse_P(code, contentType, data + start, end - start);
+  if (code == 206) {
+    char cr[40];
+    sprintf_P(cr, PSTR("bytes %u-%u/%u"), (unsigned)start, (unsigned)(end -1), (unsigned)len);
+    response->addHeader(F("Content-Range"), cr);
+  }
+  response->addHeader(F("Accept-Ranges"), F("bytes"));
+  if (gzip) response->addHeader(F("Content-Encoding"),"gzip");
+  setStaticContentCacheHeaders(response, etag);
   request->send(response);
 }
 
+void serveStaticPage(AsyncWebServerRequest* request, const char* page)
+{
+  serveStaticAsset(request, "text/html", (const uint8_t*)page, strlen_P(page));
+}
+
+void serveIndex(AsyncWebServerRequest* request)
+{
+  if (handleFileRead(request, "/index.htm")) return;
+
+  serveStaticAsset(request, "text/html", PAGE_index, PAGE_index_L, true);
+}
+
 
 String msgProcessor(const String& var)
 {
@@ -304,25 +427,6 @@ void serveMessage(AsyncWebServerRequest* request, uint16_t code, const String& h
 }
 
 
-String settingsProcessor(const String& var)
-{
-  if (var == "CSS") {
-    char buf[2048];
-    getSettingsJS(optionType, buf);
-    return String(buf);
-  }
-  
-  #ifdef WLED_ENABLE_DMX
-
-  if (var == "DMXMENU") {
-    return String(F("<form action=/settings/dmx><button type=submit>DMX Output</button></form>"));
-  }
-  
-  #endif
-  if (var == "SCSS") return String(FPSTR(PAGE_settingsCss));
-  return String();
-}
-
 String dmxProcessor(const String& var)
 {
   String mapJS;
@@ -344,6 +448,20 @@ String dmxProcessor(const String& var)
 }
 
 
+//GetV() of the settings pages, which fills in the current values
+void serveSettingsJS(AsyncWebServerRequest* request)
+{
+  char buf[OMAX];
+  buf[0] = 0;
+  byte subPage = request->arg(F("p")).toInt();
+  if (subPage != 1 || !(wifiLock && otaLock)) getSettingsJS(subPage, buf);
+
+  AsyncWebServerResponse *response = request->beginResponse(200, "application/javascript", buf);
+  response->addHeader(F("Cache-Control"), F("no-store"));
+  request->send(response);
+}
+
+
 void serveSettings(AsyncWebServerRequest* request, bool post)
 {
   byte subPage = 0;
@@ -395,18 +513,18 @@ void serveSettings(AsyncWebServerRequest* request, bool post)
    if (subPage == 255) {serveIndex(request); return;}
   #endif
 
-  optionType = subPage;
-  
   switch (subPage)
   {
-    case 1:   request->send_P(200, "text/html", PAGE_settings_wifi, settingsProcessor); break;
-    case 2:   request->send_P(200, "text/html", PAGE_settings_leds, settingsProcessor); break;
-    case 3:   request->send_P(200, "text/html", PAGE_settings_ui  , settingsProcessor); break;
-    case 4:   request->send_P(200, "text/html", PAGE_settings_sync, settingsProcessor); break;
-    case 5:   request->send_P(200, "text/html", PAGE_settings_time, settingsProcessor); break;
-    case 6:   request->send_P(200, "text/html", PAGE_settings_sec , settingsProcessor); break;
-    case 7:   request->send_P(200, "text/html", PAGE_settings_dmx , settingsProcessor); break;
-    case 255: request->send_P(200, "text/html", PAGE_welcome); break;
-    default:  request->send_P(200, "text/html", PAGE_settings     , settingsProcessor); 
+    case 1:   serveStaticAsset(request, "text/html", PAGE_settings_wifi, PAGE_settings_wifi_length, true); break;
+    case 2:   serveStaticAsset(request, "text/html", PAGE_settings_leds, PAGE_settings_leds_length, true); break;
+    case 3:   serveStaticAsset(request, "text/html", PAGE_settings_ui  , PAGE_settings_ui_length  , true); break;
+    case 4:   serveStaticAsset(request, "text/html", PAGE_settings_sync, PAGE_settings_sync_length, true); break;
+    case 5:   serveStaticAsset(request, "text/html", PAGE_settings_time, PAGE_settings_time_length, true); break;
+    case 6:   serveStaticAsset(request, "text/html", PAGE_settings_sec , PAGE_settings_sec_length , true); break;
+    #ifdef WLED_ENABLE_DMX
+    case 7:   serveStaticAsset(request, "text/html", PAGE_settings_dmx , PAGE_settings_dmx_length , true); break;
+    #endif
+    case 255: serveStaticPage(request, PAGE_welcome); break;
+    default:  serveStaticAsset(request, "text/html", PAGE_settings     , PAGE_settings_length     , true);
   }
 }
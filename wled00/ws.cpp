@@ -1,25 +1,296 @@
 #include "wled.h"
+#include "bin_control.h"
+#include "ws_live.h"
 
 /*
  * WebSockets server for bidirectional communication
  */
 #ifdef WLED_ENABLE_WEBSOCKETS
 
-uint16_t wsLiveClientId = 0;
 unsigned long wsLastLiveTime = 0;
-//uint8_t* wsFrameBuffer = nullptr;
+uint8_t* wsFrameBuffer = nullptr; //reassembly of fragmented binary messages
+size_t wsFrameBufferSize = 0;
+size_t wsFrameLen = 0;
+bool wsFrameOverflow = false;
+uint32_t wsFrameClient = 0; //client whose message is being reassembled
+uint8_t* wsPixels = nullptr; //two frames of pushed pixels (RGBW): the one being received and the last complete one
+uint16_t wsPixelsLeds = 0;   //LEDs per slot
+byte wsPixelsSlot = 0;       //slot messages are written to
+bool wsPixelsReady = false;  //the other slot holds a complete frame not yet copied to the strip
+uint32_t wsPixelsClient = 0; //client that pushed the last frame
+IPAddress wsPixelsIP;
+JsonStateParser* wsTextParser = nullptr; //text message being parsed
+uint32_t wsTextClient = 0;
 
 #define WS_LIVE_INTERVAL 40
+#define WS_LIVE_MAX_CLIENTS 4
+
+//clients receiving the liveview, either as legacy JSON or binary
+struct WsLiveClient {
+  uint32_t id;         //0 = unused
+  bool binary;
+  bool delta;          //send changed pixels only
+  bool due;            //a frame is to be sent once the client's queue is empty
+  uint16_t maxLeds;    //resolution requested by the client
+  uint16_t sampled;    //pixels in the last frame sent, the reference for delta frames
+  uint8_t* last;       //last frame sent, RGB
+};
+WsLiveClient wsLiveClients[WS_LIVE_MAX_CLIENTS];
+
+#define WS_MAX_CLIENTS 8         //matches the server's client limit
+#define WS_SHARED_BUFFERS 8
+#define WS_STATE_CACHE_MS 1000   //a state message is reused for single clients this long if the state did not change
+
+struct WsClientState {
+  uint32_t id;
+  bool delta;          //client asked for delta messages
+  uint32_t ack;        //revision the client acknowledged last
+  bool reply;          //a state message is to be sent from the loop
+};
+WsClientState wsClientStates[WS_MAX_CLIENTS];
+bool wsReplyUntracked = false; //a client without a slot asked for the state, answered with a broadcast
+
+StateDeltaBase wsDeltaBase; //fields of the last state message, the base for delta messages
+
+AsyncWebSocketMessageBuffer* wsSharedBuffers[WS_SHARED_BUFFERS];
+AsyncWebSocketMessageBuffer* wsStateBuffer = nullptr; //last full state message
+uint32_t wsStateBufferRev = 0;
+unsigned long wsStateBufferTime = 0;
+
+//binary messages start with a type byte
+#define WS_BIN_PIXELS 0x01
+//pixels: type, flags, offset (BE), count (BE), then packed RGB or RGBW data
+#define WS_BIN_PIXELS_HEADER 6
+#define WS_BIN_FLAG_RGBW 0x01 //4 bytes per pixel
+#define WS_BIN_FLAG_MORE 0x02 //more messages of the same frame follow, do not show yet
+//liveview frames (WS_BIN_LIVE) are encoded in ws_live.h
+
+#ifdef ARDUINO_ARCH_ESP32
+static SemaphoreHandle_t wsPixelsMutex = nullptr;
+#endif
+
+//messages are handled in the async_tcp task on ESP32, so the pixel slots shared with the main loop are only touched holding this lock
+static void wsPixelsLock()
+{
+  #ifdef ARDUINO_ARCH_ESP32
+  if (!wsPixelsMutex) wsPixelsMutex = xSemaphoreCreateMutex(); //first taken by the main loop in handleWs()
+  xSemaphoreTake(wsPixelsMutex, portMAX_DELAY);
+  #endif
+}
+
+static void wsPixelsUnlock()
+{
+  #ifdef ARDUINO_ARCH_ESP32
+  xSemaphoreGive(wsPixelsMutex);
+  #endif
+}
+
+static byte* wsPixelsSlotData(byte slot)
+{
+  return wsPixels + (uint32_t)slot * wsPixelsLeds * 4;
+}
+
+//allocated once the first frame is pushed, and freed when the client pushing frames disconnects
+static bool allocWsPixels()
+{
+  if (wsPixels && wsPixelsLeds == ledCount) return true;
+  free(wsPixels);
+  wsPixels = (uint8_t*)calloc((uint32_t)2 * ledCount, 4);
+  wsPixelsLeds = wsPixels ? ledCount : 0;
+  wsPixelsSlot = 0;
+  wsPixelsReady = false;
+  return wsPixels != nullptr;
+}
+
+//raw pixel frames pushed by a client, handled like a UDP realtime stream
+//the pixels are staged here and copied to the strip by the main loop, like E1.31 universes
+void handleWsPixels(AsyncWebSocketClient * client, const uint8_t *data, size_t len)
+{
+  if (!receiveDirect || len < WS_BIN_PIXELS_HEADER) return;
+  byte flags = data[1];
+  byte stride = (flags & WS_BIN_FLAG_RGBW) ? 4 : 3;
+  uint16_t offset = (data[2] << 8) | data[3];
+  uint16_t count  = (data[4] << 8) | data[5];
+  if (count > (len - WS_BIN_PIXELS_HEADER) / stride) count = (len - WS_BIN_PIXELS_HEADER) / stride;
+  data += WS_BIN_PIXELS_HEADER;
+
+  wsPixelsLock();
+  if (allocWsPixels()) {
+    if (offset >= wsPixelsLeds) count = 0;
+    else if (count > wsPixelsLeds - offset) count = wsPixelsLeds - offset;
+    byte* p = wsPixelsSlotData(wsPixelsSlot) + (uint32_t)offset * 4;
+    for (uint16_t i = 0; i < count; i++) {
+      p[0] = data[0]; p[1] = data[1]; p[2] = data[2]; p[3] = (stride > 3) ? data[3] : 0;
+      p += 4; data += stride;
+    }
+    if (!(flags & WS_BIN_FLAG_MORE)) {
+      //the next frame starts as a copy of this one, so pixels it does not update keep their color
+      wsPixelsSlot ^= 1;
+      memcpy(wsPixelsSlotData(wsPixelsSlot), wsPixelsSlotData(wsPixelsSlot ^ 1), (uint32_t)wsPixelsLeds * 4);
+      wsPixelsReady = true;
+      wsPixelsClient = client->id();
+      wsPixelsIP = client->remoteIP();
+    }
+  }
+  wsPixelsUnlock();
+}
+
+//called from the main loop, copies the last complete pushed frame to the strip
+static void handleWsPixelFrame()
+{
+  wsPixelsLock();
+  if (wsPixelsReady) {
+    wsPixelsReady = false;
+    realtimeIP = wsPixelsIP;
+    realtimeLock(realtimeTimeoutMs, REALTIME_MODE_WEBSOCKET);
+    if (!realtimeOverride) {
+      setRealtimePixels(0, wsPixelsSlotData(wsPixelsSlot ^ 1), wsPixelsLeds, 4);
+      realtimeShow();
+    }
+  }
+  wsPixelsUnlock();
+}
+
+void handleWsBinary(AsyncWebSocketClient * client, const uint8_t *data, size_t len)
+{
+  if (!len) return;
+  switch (data[0]) {
+    case WS_BIN_PIXELS: handleWsPixels(client, data, len); break;
+    case BIN_CONTROL_TYPE: {
+      uint8_t ack[sizeof(BinControlAck)];
+      size_t ackLen = handleBinaryControl(data, len, ack);
+      if (ackLen) client->binary(ack, ackLen);
+      break;
+    }
+  }
+}
+
+void removeLiveClient(uint32_t id)
+{
+  for (byte i = 0; i < WS_LIVE_MAX_CLIENTS; i++) {
+    WsLiveClient &lc = wsLiveClients[i];
+    if (lc.id != id) continue;
+    free(lc.last);
+    lc = WsLiveClient();
+  }
+}
+
+//"lv":true starts the JSON liveview, "lv":{"bin":true,"max":600,"delta":true} the binary one, "lv":false stops it
+void setLiveClient(AsyncWebSocketClient * client, JsonVariant lv)
+{
+  removeLiveClient(client->id());
+  if (lv.isNull() || !(lv.is<JsonObject>() || lv.as<bool>())) return;
+
+  for (byte i = 0; i < WS_LIVE_MAX_CLIENTS; i++) {
+    WsLiveClient &lc = wsLiveClients[i];
+    if (lc.id) continue;
+    lc.id = client->id();
+    lc.due = true;
+    lc.maxLeds = MAX_LIVE_LEDS;
+    if (lv.is<JsonObject>()) {
+      lc.binary = lv["bin"] | true;
+      lc.delta  = lc.binary && (lv["delta"] | false);
+      lc.maxLeds = lv["max"] | lc.maxLeds;
+      if (!lc.binary || !lc.maxLeds) lc.maxLeds = MAX_LIVE_LEDS; //JSON is limited by its buffer
+    }
+    return;
+  }
+}
+
+//sends the sampled strip as a binary frame, or as a delta against the previous frame if smaller
+static bool serveLiveLedsBinary(WsLiveClient &lc, AsyncWebSocketClient * wsc)
+{
+  uint16_t n = (ledCount -1) / lc.maxLeds +1; //only serve every n'th LED
+  uint16_t sampled = (ledCount -1) / n +1;
+  size_t fullLen = WS_BIN_LIVE_HEADER + (size_t)sampled * 3;
+
+  uint8_t* buf = (uint8_t*)malloc(fullLen);
+  if (!buf) return false;
+  if (lc.delta && lc.sampled != sampled) { //resolution changed, start over with a full frame
+    free(lc.last);
+    lc.last = (uint8_t*)malloc((size_t)sampled * 3);
+    lc.sampled = 0;
+  }
+  bool delta = lc.delta && lc.last && lc.sampled == sampled;
+
+  size_t len = encodeLiveFrame(buf, sampled, n, lc.last, delta, [n](uint16_t p) { return strip.getPixelColor(p * n); });
+  if (lc.delta && lc.last) lc.sampled = sampled;
+  if ((buf[1] & WS_BIN_LIVE_DELTA) && len == WS_BIN_LIVE_HEADER) { free(buf); return true; } //nothing changed
+  wsc->binary(buf, len);
+  free(buf);
+  return true;
+}
+
+//the largest binary message expected is a full RGBW frame
+//text messages are state changes, parsed incrementally so split messages need no reassembly buffer
+static bool beginWsText(AsyncWebSocketClient * client)
+{
+  if (wsTextParser && wsTextClient != client->id()) return false;
+  if (!wsTextParser) wsTextParser = new JsonStateParser();
+  else wsTextParser->begin();
+  wsTextClient = client->id();
+  return true;
+}
+
+static void requestWsReply(uint32_t id);
+
+static void endWsText(AsyncWebSocketClient * client)
+{
+  bool valid = wsTextParser->end();
+  bool verboseResponse = false;
+  if (valid) {
+    JsonObject root = wsTextParser->root();
+    if (root.containsKey("lv"))
+    {
+      setLiveClient(client, root["lv"]);
+    }
+    setDeltaClient(client->id(), root);
+
+    verboseResponse = deserializeState(root, wsTextParser);
+  }
+  delete wsTextParser;
+  wsTextParser = nullptr;
+  wsTextClient = 0;
+  if (!valid) return;
+  if (verboseResponse || millis() - lastInterfaceUpdate < 1900) requestWsReply(client->id()); //update if it takes longer than 100ms until next "broadcast"
+}
+
+static bool allocWsFrameBuffer()
+{
+  size_t size = (size_t)ledCount * 4 + WS_BIN_PIXELS_HEADER;
+  if (wsFrameBuffer && wsFrameBufferSize >= size) return true;
+  free(wsFrameBuffer);
+  wsFrameBuffer = (uint8_t*)malloc(size);
+  wsFrameBufferSize = wsFrameBuffer ? size : 0;
+  return wsFrameBuffer != nullptr;
+}
 
 void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len)
 {
   if(type == WS_EVT_CONNECT){
     //client connected
-    sendDataWs(client);
+    trackWsClient(client->id(), true);
+    requestWsReply(client->id());
     //client->ping();
   } else if(type == WS_EVT_DISCONNECT){
     //client disconnected
-    if (client->id() == wsLiveClientId) wsLiveClientId = 0;
+    removeLiveClient(client->id());
+    trackWsClient(client->id(), false);
+    if (wsTextClient == client->id()) { //drop its unfinished message
+      delete wsTextParser;
+      wsTextParser = nullptr;
+      wsTextClient = 0;
+    }
+    if (wsFrameClient == client->id()) wsFrameClient = 0;
+    if (wsPixelsClient == client->id()) { //stopped pushing frames
+      wsPixelsLock();
+      free(wsPixels);
+      wsPixels = nullptr;
+      wsPixelsLeds = 0;
+      wsPixelsReady = false;
+      wsPixelsClient = 0;
+      wsPixelsUnlock();
+    }
   } else if(type == WS_EVT_DATA){
     //data packet
     AwsFrameInfo * info = (AwsFrameInfo*)arg;
@@ -27,40 +298,43 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
       //the whole message is in a single frame and we got all of it's data (max. 1450byte)
       if(info->opcode == WS_TEXT)
       {
-        bool verboseResponse = false;
-        { //scope JsonDocument so it releases its buffer
-          DynamicJsonDocument jsonBuffer(JSON_BUFFER_SIZE);
-          DeserializationError error = deserializeJson(jsonBuffer, data, len);
-          JsonObject root = jsonBuffer.as<JsonObject>();
-          if (error || root.isNull()) return;
-
-          if (root.containsKey("lv"))
-          {
-            wsLiveClientId = root["lv"] ? client->id() : 0;
-          }
-
-          verboseResponse = deserializeState(root);
-        }
-        if (verboseResponse || millis() - lastInterfaceUpdate < 1900) sendDataWs(client); //update if it takes longer than 100ms until next "broadcast"
+        if (beginWsText(client)) {
+          wsTextParser->feed(data, len);
+          endWsText(client);
+        } else client->text(F("{\"error\":9}")); //another client's split message is being parsed
+      } else if (info->opcode == WS_BINARY)
+      {
+        handleWsBinary(client, data, len);
       }
     } else {
       //message is comprised of multiple frames or the frame is split into multiple packets
-      //if(info->index == 0){
-        //if (!wsFrameBuffer && len < 4096) wsFrameBuffer = new uint8_t[4096];
-      //}
-
-      //if (wsFrameBuffer && len < 4096 && info->index + info->)
-      //{
-
-      //}
-
-      if((info->index + len) == info->len){
-        if(info->final){
-          if(info->message_opcode == WS_TEXT) {
-            client->text(F("{\"error\":9}")); //we do not handle split packets right now
+      //reassemble into the frame buffer, one client at a time. Messages of other clients are dropped meanwhile
+      if (info->message_opcode == WS_BINARY) {
+        if (info->num == 0 && info->index == 0 && (!wsFrameClient || wsFrameClient == client->id())) {
+          wsFrameClient = client->id();
+          wsFrameLen = 0;
+          wsFrameOverflow = !allocWsFrameBuffer();
+        }
+        if (wsFrameClient == client->id()) {
+          if (!wsFrameOverflow && wsFrameLen + len <= wsFrameBufferSize) {
+            memcpy(wsFrameBuffer + wsFrameLen, data, len);
+            wsFrameLen += len;
+          } else wsFrameOverflow = true; //too large, dropped
+          if ((info->index + len) == info->len && info->final) {
+            if (!wsFrameOverflow) handleWsBinary(client, wsFrameBuffer, wsFrameLen);
+            wsFrameClient = 0;
           }
         }
       }
+
+      if (info->message_opcode == WS_TEXT) { //parsed while the frames arrive
+        if (info->num == 0 && info->index == 0 && !beginWsText(client)) {
+          client->text(F("{\"error\":9}")); //another client's split message is being parsed
+        } else if (wsTextParser && wsTextClient == client->id()) {
+          wsTextParser->feed(data, len);
+          if ((info->index + len) == info->len && info->final) endWsText(client);
+        }
+      }
     }
   } else if(type == WS_EVT_ERROR){
     //error was received from the other end
@@ -71,10 +345,100 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
   }
 }
 
+//state messages are serialized once into buffers shared by all clients and freed once no client queue holds them
+static AsyncWebSocketMessageBuffer* newSharedBuffer(size_t len)
+{
+  byte slot = WS_SHARED_BUFFERS;
+  for (byte i = 0; i < WS_SHARED_BUFFERS; i++) {
+    if (!wsSharedBuffers[i]) { slot = i; break; }
+  }
+  if (slot == WS_SHARED_BUFFERS) return nullptr;
+  AsyncWebSocketMessageBuffer* buffer = new AsyncWebSocketMessageBuffer(len);
+  if (!buffer->get()) { delete buffer; return nullptr; } //out of memory
+  wsSharedBuffers[slot] = buffer;
+  return buffer;
+}
+
+static void sweepSharedBuffers()
+{
+  if (wsStateBuffer && millis() - wsStateBufferTime > WS_STATE_CACHE_MS) wsStateBuffer = nullptr;
+  for (byte i = 0; i < WS_SHARED_BUFFERS; i++) {
+    AsyncWebSocketMessageBuffer* buffer = wsSharedBuffers[i];
+    if (!buffer || buffer == wsStateBuffer || buffer->count()) continue;
+    delete buffer;
+    wsSharedBuffers[i] = nullptr;
+  }
+}
+
+static AsyncWebSocketMessageBuffer* serializeDelta(JsonObject state, const StateFieldHash* hashes, byte n)
+{
+  size_t len = serializeStateDelta(state, hashes, n, wsDeltaBase, nullptr);
+  if (!len) return nullptr;
+  AsyncWebSocketMessageBuffer* buffer = newSharedBuffer(len);
+  if (!buffer) return nullptr;
+  serializeStateDelta(state, hashes, n, wsDeltaBase, (char*)buffer->get());
+  return buffer;
+}
+
+static WsClientState* findWsClient(uint32_t id)
+{
+  for (byte i = 0; i < WS_MAX_CLIENTS; i++) {
+    if (wsClientStates[i].id == id) return &wsClientStates[i];
+  }
+  return nullptr;
+}
+
+void trackWsClient(uint32_t id, bool connected)
+{
+  WsClientState* cs = findWsClient(connected ? 0 : id);
+  if (!cs) return;
+  *cs = WsClientState();
+  if (connected) cs->id = id;
+}
+
+//"delta":true makes a client receive only the changed state fields, as long as it acknowledges ("ack":rev) the messages it received
+void setDeltaClient(uint32_t id, JsonObject root)
+{
+  WsClientState* cs = findWsClient(id);
+  if (!cs) return;
+  if (root.containsKey("delta")) cs->delta = root["delta"];
+  if (root.containsKey("ack")) cs->ack = root["ack"];
+}
+
+//the shared buffers, the delta base and stateRevision are only touched from the loop, replies from the network task are deferred
+static void requestWsReply(uint32_t id)
+{
+  WsClientState* cs = findWsClient(id);
+  if (cs) cs->reply = true;
+  else wsReplyUntracked = true;
+}
+
+static void sendWsReplies()
+{
+  if (wsReplyUntracked) {
+    wsReplyUntracked = false;
+    sendDataWs();
+  }
+  for (byte i = 0; i < WS_MAX_CLIENTS; i++) {
+    WsClientState &cs = wsClientStates[i];
+    if (!cs.id || !cs.reply) continue;
+    cs.reply = false;
+    AsyncWebSocketClient * c = ws.client(cs.id);
+    if (c) sendDataWs(c);
+  }
+}
+
 void sendDataWs(AsyncWebSocketClient * client)
 {
   if (!ws.count()) return;
+  if (client && wsStateBuffer && wsStateBufferRev == stateRevision) { //nothing changed since the last message
+    client->text(wsStateBuffer);
+    return;
+  }
+
   AsyncWebSocketMessageBuffer * buffer;
+  AsyncWebSocketMessageBuffer * delta = nullptr;
+  uint32_t base = wsDeltaBase.rev;
 
   { //scope JsonDocument so it releases its buffer
     DynamicJsonDocument doc(JSON_BUFFER_SIZE);
@@ -82,29 +446,71 @@ void sendDataWs(AsyncWebSocketClient * client)
     serializeState(state);
     JsonObject info  = doc.createNestedObject("info");
     serializeInfo(info);
-    size_t len = measureJson(doc);
-    buffer = ws.makeBuffer(len);
-    if (!buffer) return; //out of memory
 
+    StateFieldHash hashes[STATE_DELTA_FIELDS];
+    byte n = hashStateFields(state, hashes);
+    if (stateChanged(wsDeltaBase, hashes, n) && stateRevision == wsDeltaBase.rev) stateRevision++; //changed without colorUpdated()
+    doc["rev"] = stateRevision;
+
+    size_t len = measureJson(doc);
+    buffer = newSharedBuffer(len);
+    if (buffer) {
+      wsStateBuffer = buffer;
+      wsStateBufferRev = stateRevision;
+      wsStateBufferTime = millis();
+    } else { //all shared buffers in use, fall back to one owned by the server
+      buffer = ws.makeBuffer(len);
+      if (!buffer) return; //out of memory
+    }
     serializeJson(doc, (char *)buffer->get(), len +1);
-  } 
+
+    //clients tracked and at least one in delta mode, else there is no need to send individually
+    bool individual = !client && ws.count() <= WS_MAX_CLIENTS;
+    bool anyDelta = false;
+    for (byte i = 0; i < WS_MAX_CLIENTS; i++) anyDelta |= (wsClientStates[i].id && wsClientStates[i].delta);
+    if (individual && anyDelta && wsStateBuffer == buffer) delta = serializeDelta(state, hashes, n);
+
+    //a broadcast is the base for the next delta, a reply to one client is not what the others have
+    if (!client) setStateDeltaBase(wsDeltaBase, hashes, n);
+  }
+
   if (client) {
     client->text(buffer);
-  } else {
+  } else if (!delta) {
     ws.textAll(buffer);
+  } else {
+    for (byte i = 0; i < WS_MAX_CLIENTS; i++) {
+      WsClientState &cs = wsClientStates[i];
+      if (!cs.id) continue;
+      AsyncWebSocketClient * c = ws.client(cs.id);
+      if (!c) continue;
+      c->text((cs.delta && cs.ack == base) ? delta : buffer);
+    }
   }
 }
 
 void handleWs()
 {
+  handleWsPixelFrame();
+  sendWsReplies();
   if (millis() - wsLastLiveTime > WS_LIVE_INTERVAL)
   {
     ws.cleanupClients();
-    bool success = true;
-    if (wsLiveClientId)
-      success = serveLiveLeds(nullptr, wsLiveClientId);
+    sweepSharedBuffers();
+    for (byte i = 0; i < WS_LIVE_MAX_CLIENTS; i++) {
+      if (wsLiveClients[i].id) wsLiveClients[i].due = true;
+    }
     wsLastLiveTime = millis();
-    if (!success) wsLastLiveTime -= 20; //try again in 20ms if failed due to non-empty WS queue
+  }
+
+  //clients with a non-empty queue are skipped until they caught up
+  for (byte i = 0; i < WS_LIVE_MAX_CLIENTS; i++) {
+    WsLiveClient &lc = wsLiveClients[i];
+    if (!lc.id || !lc.due) continue;
+    AsyncWebSocketClient * wsc = ws.client(lc.id);
+    if (!wsc) { removeLiveClient(lc.id); continue; }
+    if (wsc->queueLength() > 0) continue;
+    lc.due = !(lc.binary ? serveLiveLedsBinary(lc, wsc) : serveLiveLeds(nullptr, lc.id));
   }
 }
 
@@ -0,0 +1,66 @@
+#ifndef WLED_WS_LIVE_H
+#define WLED_WS_LIVE_H
+
+/*
+ * Binary liveview frames sent over WebSocket.
+ * Independent of Arduino, so that replaying delta frames can be checked on a host.
+ *
+ * Frame: type, flags, pixels in frame (BE), sampling step (BE), then RGB data of every sampled pixel.
+ * Delta frames carry runs of changed pixels instead: start (BE), length (1-255), RGB data.
+ * A client applies them to the frame it has, which is the last one it was sent.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define WS_BIN_LIVE 0x02
+#define WS_BIN_LIVE_HEADER 6
+#define WS_BIN_LIVE_DELTA 0x01
+
+//writes the frame to buf (WS_BIN_LIVE_HEADER + sampled * 3 bytes) and returns its length
+//pixel(p) returns sampled pixel p as 0xRRGGBB. last (sampled * 3 bytes, or nullptr) is updated to what the client has after this frame
+//with delta set, only the pixels differing from last are sent, unless that would not be smaller than a full frame
+template <typename PixelFn>
+size_t encodeLiveFrame(uint8_t* buf, uint16_t sampled, uint16_t step, uint8_t* last, bool delta, PixelFn pixel)
+{
+  size_t fullLen = WS_BIN_LIVE_HEADER + (size_t)sampled * 3;
+  buf[0] = WS_BIN_LIVE;
+  buf[1] = 0;
+  buf[2] = sampled >> 8; buf[3] = sampled & 0xFF;
+  buf[4] = step >> 8;    buf[5] = step & 0xFF;
+  size_t len = WS_BIN_LIVE_HEADER;
+
+  if (delta && last) {
+    buf[1] = WS_BIN_LIVE_DELTA;
+    size_t runHeader = 0; //position of the open run's header
+    for (uint16_t p = 0; p < sampled; p++) {
+      uint32_t c = pixel(p);
+      uint8_t* ref = last + p * 3;
+      if (ref[0] == (uint8_t)(c >> 16) && ref[1] == (uint8_t)(c >> 8) && ref[2] == (uint8_t)c) {
+        runHeader = 0;
+        continue;
+      }
+      if (!runHeader || buf[runHeader +2] == 255) {
+        if (len + 6 > fullLen) { delta = false; break; } //delta would not be smaller
+        runHeader = len;
+        buf[len++] = p >> 8; buf[len++] = p & 0xFF; buf[len++] = 0;
+      } else if (len + 3 > fullLen) { delta = false; break; }
+      buf[runHeader +2]++;
+      buf[len++] = c >> 16; buf[len++] = c >> 8; buf[len++] = c;
+      ref[0] = c >> 16; ref[1] = c >> 8; ref[2] = c;
+    }
+    if (delta) return len;
+  }
+
+  buf[1] = 0;
+  len = WS_BIN_LIVE_HEADER;
+  for (uint16_t p = 0; p < sampled; p++) {
+    uint32_t c = pixel(p);
+    buf[len++] = c >> 16; buf[len++] = c >> 8; buf[len++] = c;
+  }
+  if (last) memcpy(last, buf + WS_BIN_LIVE_HEADER, (size_t)sampled * 3); //a delta given up half way left last partly updated
+  return len;
+}
+
+#endif
@@ -186,6 +186,7 @@ void getSettingsJS(byte subPage, char* dest)
   olen = 0;
 
   if (subPage <1 || subPage >7) return;
+  oappend(SET_F("function GetV(){var d=document;"));
 
   if (subPage == 1) {
     sappends('s',SET_F("CS"),clientSSID);
@@ -325,6 +326,8 @@ void getSettingsJS(byte subPage, char* dest)
     sappend('c',SET_F("FB"),arlsForceMaxBri);
     sappend('c',SET_F("RG"),arlsDisableGammaCorrection);
     sappend('v',SET_F("WO"),arlsOffset);
+    sappend('v',SET_F("JB"),realtimeBufferFrames);
+    sappend('c',SET_F("JI"),realtimeInterpolate);
     sappend('c',SET_F("AL"),alexaEnabled);
     sappends('s',SET_F("AI"),alexaInvocationName);
     sappend('c',SET_F("SA"),notifyAlexa);
@@ -461,5 +464,5 @@ void getSettingsJS(byte subPage, char* dest)
     sappend('i',SET_F("CH15"),DMXFixtureMap[14]);
     }
   #endif
-  oappend(SET_F("}</script>"));
+  oappend("}");
 }